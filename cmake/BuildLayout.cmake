@@ -0,0 +1,88 @@
+# This script builds and runs the benchmarks with several code layouts, and
+# merges the results into one report with the spread of each function. Use the
+# `layout` target:
+#   cmake --build . --target layout
+#
+# Each layout is built with a different LAYOUT_SEED (see CMakeLists.txt), which
+# shifts the code by a padding object and rotates the link order, so a result
+# which depends on a lucky (or unlucky) code alignment shows a large spread.
+# The layouts are built in one directory, only the runs are rebuilt.
+#
+# Input variables:
+#   SOURCE_DIR      the source directory
+#   BINARY_DIR      the output directory, each layout writes to a subdirectory
+#   GENERATOR       the cmake generator
+#   LAYOUT_COUNT    the layout count, seeds are 1 to LAYOUT_COUNT
+#   LAYOUT_RUNS     the runs, separated by comma
+#   LAYOUT_ARGS     extra cmake arguments, separated by comma
+#   LAYOUT_MERGE    only merge the existing reports if ON
+
+
+if(NOT SOURCE_DIR OR NOT BINARY_DIR)
+    message(FATAL_ERROR "SOURCE_DIR and BINARY_DIR are required")
+endif()
+if(NOT LAYOUT_COUNT OR LAYOUT_COUNT LESS 2)
+    set(LAYOUT_COUNT 8)
+endif()
+if(NOT LAYOUT_RUNS)
+    set(LAYOUT_RUNS "itoa,dtoa")
+endif()
+string(REPLACE "," ";" LAYOUT_RUNS "${LAYOUT_RUNS}")
+string(REPLACE "," ";" LAYOUT_ARGS "${LAYOUT_ARGS}")
+
+include("${CMAKE_CURRENT_LIST_DIR}/MergeReports.cmake")
+
+set(build_dir "${BINARY_DIR}/build")
+set(seeds "")
+
+foreach(seed RANGE 1 ${LAYOUT_COUNT})
+    set(seed_dir "${BINARY_DIR}/seed_${seed}")
+    set(seed_failed OFF)
+    if(NOT LAYOUT_MERGE)
+        message(STATUS "Code layout: build seed ${seed}")
+        set(seed_args -DCMAKE_BUILD_TYPE=Release "-DLAYOUT_SEED=${seed}" ${LAYOUT_ARGS})
+        if(GENERATOR)
+            list(APPEND seed_args -G "${GENERATOR}")
+        endif()
+        execute_process(COMMAND ${CMAKE_COMMAND} -S "${SOURCE_DIR}" -B "${build_dir}" ${seed_args}
+            RESULT_VARIABLE result)
+        if(NOT result EQUAL 0)
+            message(FATAL_ERROR "Code layout: configure failed (${result})")
+        endif()
+        file(MAKE_DIRECTORY "${seed_dir}")
+        foreach(run ${LAYOUT_RUNS})
+            if(NOT seed_failed)
+                execute_process(COMMAND ${CMAKE_COMMAND} --build "${build_dir}" --config Release --target "run_${run}"
+                    RESULT_VARIABLE result)
+                if(NOT result EQUAL 0)
+                    message(WARNING "Code layout: build failed (${result}): seed ${seed} ${run}")
+                    set(seed_failed ON)
+                endif()
+            endif()
+            if(NOT seed_failed)
+                set(run_path "${build_dir}/run_${run}${CMAKE_EXECUTABLE_SUFFIX}")
+                if(NOT EXISTS "${run_path}")
+                    set(run_path "${build_dir}/Release/run_${run}${CMAKE_EXECUTABLE_SUFFIX}")
+                endif()
+                message(STATUS "Code layout: run seed ${seed} ${run}")
+                execute_process(COMMAND "${run_path}" -o "${seed_dir}/report_${run}.html"
+                    WORKING_DIRECTORY "${build_dir}" RESULT_VARIABLE result)
+                if(NOT result EQUAL 0)
+                    message(WARNING "Code layout: run failed (${result}): seed ${seed} ${run}")
+                    set(seed_failed ON)
+                endif()
+            endif()
+        endforeach()
+    endif()
+    if(NOT seed_failed)
+        list(APPEND seeds "seed_${seed}")
+    endif()
+endforeach()
+
+list(LENGTH seeds seed_count)
+if(seed_count LESS 2)
+    message(FATAL_ERROR "Code layout: less than 2 layouts are built")
+endif()
+merge_layout_reports("${BINARY_DIR}" "${BINARY_DIR}/report_layout.html"
+    "${LAYOUT_RUNS}" "${seeds}")
+message(STATUS "Code layout: report written to ${BINARY_DIR}/report_layout.html")
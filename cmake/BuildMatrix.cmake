@@ -0,0 +1,220 @@
+# This script builds and runs the benchmarks in several build configurations,
+# and merges the results into one report. Use the `matrix` target:
+#   cmake --build . --target matrix
+#
+# A configuration is named as "<compiler>-<opt>[-lto][-pgo][-shared]":
+#   compiler    gcc or clang (override the executable with MATRIX_CC_<compiler>
+#               and MATRIX_CXX_<compiler>, such as -DMATRIX_CC_gcc=gcc-12)
+#   opt         optimization level, such as O2, O3, Os
+#   lto         link time optimization
+#   pgo         profile guided optimization, trained with the benchmark itself
+#   shared      link the vendor libraries as shared libraries
+#
+# Input variables:
+#   SOURCE_DIR      the source directory
+#   BINARY_DIR      the output directory, each config is built in a subdirectory
+#   GENERATOR       the cmake generator
+#   MATRIX_CONFIGS  the configurations, separated by comma
+#   MATRIX_RUNS     the runs, separated by comma
+#   MATRIX_ARGS     extra cmake arguments for each config, separated by comma
+#   MATRIX_MERGE    only merge the existing reports if ON
+
+
+if(NOT SOURCE_DIR OR NOT BINARY_DIR)
+    message(FATAL_ERROR "SOURCE_DIR and BINARY_DIR are required")
+endif()
+if(NOT MATRIX_CONFIGS)
+    set(MATRIX_CONFIGS "gcc-O2,gcc-O3,gcc-O3-lto,gcc-O3-pgo,gcc-O3-shared,clang-O2,clang-O3,clang-O3-lto,clang-O3-pgo,clang-O3-shared")
+endif()
+if(NOT MATRIX_RUNS)
+    set(MATRIX_RUNS "itoa,dtoa,atoi,strtod")
+endif()
+string(REPLACE "," ";" MATRIX_CONFIGS "${MATRIX_CONFIGS}")
+string(REPLACE "," ";" MATRIX_RUNS "${MATRIX_RUNS}")
+string(REPLACE "," ";" MATRIX_ARGS "${MATRIX_ARGS}")
+
+include("${CMAKE_CURRENT_LIST_DIR}/MergeReports.cmake")
+
+
+# Run a command, stop the config if failed
+macro(matrix_execute)
+    execute_process(COMMAND ${ARGN} RESULT_VARIABLE matrix_result)
+    if(NOT matrix_result EQUAL 0)
+        message(WARNING "Build matrix: command failed (${matrix_result}): ${ARGN}")
+        set(config_failed ON)
+    endif()
+endmacro(matrix_execute)
+
+
+# Configure and build the runs of a config with extra flags
+macro(matrix_build FLAGS LINK_FLAGS)
+    set(config_args
+        -DCMAKE_BUILD_TYPE=Release
+        "-DCMAKE_C_COMPILER=${config_cc}"
+        "-DCMAKE_CXX_COMPILER=${config_cxx}"
+        "-DCMAKE_C_FLAGS_RELEASE=-${config_opt} -DNDEBUG"
+        "-DCMAKE_CXX_FLAGS_RELEASE=-${config_opt} -DNDEBUG"
+        "-DCMAKE_C_FLAGS=${FLAGS}"
+        "-DCMAKE_CXX_FLAGS=${FLAGS}"
+        "-DCMAKE_EXE_LINKER_FLAGS=${LINK_FLAGS}"
+        "-DCMAKE_SHARED_LINKER_FLAGS=${LINK_FLAGS}"
+        "-DCMAKE_INTERPROCEDURAL_OPTIMIZATION=${config_lto}"
+        "-DVENDOR_SHARED=${config_shared}"
+        ${MATRIX_ARGS}
+    )
+    if(GENERATOR)
+        list(APPEND config_args -G "${GENERATOR}")
+    endif()
+    matrix_execute(${CMAKE_COMMAND} -S "${SOURCE_DIR}" -B "${config_dir}" ${config_args})
+    foreach(run ${MATRIX_RUNS})
+        if(NOT config_failed)
+            matrix_execute(${CMAKE_COMMAND} --build "${config_dir}" --config Release --target "run_${run}")
+        endif()
+    endforeach()
+endmacro(matrix_build)
+
+
+# Run the benchmarks of a config, the reports are written to the config directory
+macro(matrix_run REPORT_PREFIX)
+    foreach(run ${MATRIX_RUNS})
+        if(NOT config_failed)
+            set(run_path "${config_dir}/run_${run}${CMAKE_EXECUTABLE_SUFFIX}")
+            if(NOT EXISTS "${run_path}")
+                set(run_path "${config_dir}/Release/run_${run}${CMAKE_EXECUTABLE_SUFFIX}")
+            endif()
+            message(STATUS "Build matrix: run ${config} ${run}")
+            matrix_execute("${run_path}" -o "${config_dir}/${REPORT_PREFIX}_${run}.html"
+                WORKING_DIRECTORY "${config_dir}")
+        endif()
+    endforeach()
+endmacro(matrix_run)
+
+
+
+# ------------------------------------------------------------------------------
+# build and run each config
+set(configs "")
+set(configs_flags "")
+
+foreach(config ${MATRIX_CONFIGS})
+    string(REPLACE "-" ";" config_parts "${config}")
+    list(GET config_parts 0 config_compiler)
+    list(GET config_parts 1 config_opt)
+    list(REMOVE_AT config_parts 0 1)
+    set(config_lto OFF)
+    set(config_pgo OFF)
+    set(config_shared OFF)
+    foreach(part ${config_parts})
+        if(part STREQUAL "lto")
+            set(config_lto ON)
+        elseif(part STREQUAL "pgo")
+            set(config_pgo ON)
+        elseif(part STREQUAL "shared")
+            set(config_shared ON)
+        else()
+            message(FATAL_ERROR "Build matrix: unknown option '${part}' in config '${config}'")
+        endif()
+    endforeach()
+
+    # find compiler
+    if(config_compiler STREQUAL "gcc")
+        set(cc_names gcc)
+        set(cxx_names g++)
+    elseif(config_compiler STREQUAL "clang")
+        set(cc_names clang)
+        set(cxx_names clang++)
+    else()
+        message(FATAL_ERROR "Build matrix: unknown compiler '${config_compiler}' in config '${config}'")
+    endif()
+    if(MATRIX_CC_${config_compiler})
+        set(cc_names ${MATRIX_CC_${config_compiler}})
+    endif()
+    if(MATRIX_CXX_${config_compiler})
+        set(cxx_names ${MATRIX_CXX_${config_compiler}})
+    endif()
+    unset(config_cc)
+    unset(config_cc CACHE)
+    unset(config_cxx)
+    unset(config_cxx CACHE)
+    find_program(config_cc NAMES ${cc_names})
+    find_program(config_cxx NAMES ${cxx_names})
+    if(NOT config_cc OR NOT config_cxx)
+        message(STATUS "Build matrix: skip ${config}, compiler not found")
+        continue()
+    endif()
+
+    # flags description for report
+    set(config_desc "-${config_opt}")
+    if(config_lto)
+        string(APPEND config_desc " LTO")
+    endif()
+    if(config_pgo)
+        string(APPEND config_desc " PGO")
+    endif()
+    if(config_shared)
+        string(APPEND config_desc " shared vendor libraries")
+    endif()
+
+    set(config_dir "${BINARY_DIR}/${config}")
+    set(config_failed OFF)
+    if(MATRIX_MERGE)
+        # use existing reports
+    elseif(NOT config_pgo)
+        message(STATUS "Build matrix: build ${config}")
+        matrix_build("" "")
+        matrix_run("report")
+    else()
+        # build instrumented binaries and train with the benchmark datasets,
+        # then rebuild in the same directory with the profile
+        set(profile_dir "${config_dir}/pgo_profile")
+        file(REMOVE_RECURSE "${profile_dir}")
+        file(MAKE_DIRECTORY "${profile_dir}")
+        if(config_compiler STREQUAL "clang")
+            set(gen_flags "-fprofile-instr-generate=${profile_dir}/%p.profraw")
+        else()
+            set(gen_flags "-fprofile-generate=${profile_dir}")
+        endif()
+        message(STATUS "Build matrix: build ${config} (instrumented)")
+        matrix_build("${gen_flags}" "${gen_flags}")
+        matrix_run("train")
+
+        if(config_compiler STREQUAL "clang")
+            unset(config_profdata)
+            unset(config_profdata CACHE)
+            get_filename_component(cc_dir "${config_cc}" DIRECTORY)
+            find_program(config_profdata NAMES llvm-profdata HINTS "${cc_dir}")
+            if(NOT config_profdata)
+                message(WARNING "Build matrix: llvm-profdata not found, skip ${config}")
+                set(config_failed ON)
+            endif()
+            if(NOT config_failed)
+                file(GLOB profraw_files "${profile_dir}/*.profraw")
+                matrix_execute("${config_profdata}" merge -output=${profile_dir}/default.profdata ${profraw_files})
+            endif()
+            set(use_flags "-fprofile-instr-use=${profile_dir}/default.profdata")
+        else()
+            set(use_flags "-fprofile-use=${profile_dir} -fprofile-correction -Wno-missing-profile")
+        endif()
+        if(NOT config_failed)
+            message(STATUS "Build matrix: build ${config} (profile guided)")
+            matrix_build("${use_flags}" "${use_flags}")
+            matrix_run("report")
+        endif()
+    endif()
+
+    if(NOT config_failed)
+        list(APPEND configs "${config}")
+        list(APPEND configs_flags "${config_desc}")
+    endif()
+endforeach()
+
+
+
+# ------------------------------------------------------------------------------
+# merge reports
+if(NOT configs)
+    message(FATAL_ERROR "Build matrix: no config is built")
+endif()
+merge_reports("${BINARY_DIR}" "${BINARY_DIR}/report_matrix.html"
+    "${MATRIX_RUNS}" "${configs}" "${configs_flags}")
+message(STATUS "Build matrix: report written to ${BINARY_DIR}/report_matrix.html")
@@ -0,0 +1,365 @@
+# This module contains some functions to merge the html reports of runs
+# built in different configurations (see BuildMatrix.cmake) or code layouts
+# (see BuildLayout.cmake)
+
+
+# Read the charts of a report generated by yybench, the results are set to:
+#   <PREFIX>_TITLES             chart titles
+#   <PREFIX>_<i>_NAMES          function names of the i-th chart
+#   <PREFIX>_<i>_VALUES         values of the i-th chart (javascript expressions)
+# The value of a line chart is the average of all points, a bar chart with
+# several series has one value per category and series: 'category (series)'.
+function(read_report_charts REPORT_PATH PREFIX)
+    set(titles "")
+    set(index -1)
+    if(EXISTS "${REPORT_PATH}")
+        file(READ "${REPORT_PATH}" html)
+        # semicolons are not needed here, and brackets would break cmake list
+        string(REPLACE ";" "" html "${html}")
+        string(REPLACE "[" "<lb>" html "${html}")
+        string(REPLACE "]" "<rb>" html "${html}")
+        string(REPLACE "\n" ";" lines "${html}")
+    else()
+        set(lines "")
+    endif()
+
+    foreach(line IN LISTS lines)
+        string(REPLACE "<lb>" "[" line "${line}")
+        string(REPLACE "<rb>" "]" line "${line}")
+        if(line MATCHES "^Highcharts\\.chart\\(")
+            math(EXPR index "${index} + 1")
+            set(names "")
+            set(values "")
+            set(categories "")
+            set(title "")
+        elseif(index LESS 0)
+            # skip the header
+        elseif(line MATCHES "^    title: { text: '(.*)' },?$")
+            set(title "${CMAKE_MATCH_1}")
+            list(APPEND titles "${title}")
+        elseif(line MATCHES "categories: \\[(.*)\\], type")
+            # bar chart: 'name1', 'name2', ...
+            string(REGEX REPLACE "^'|'$" "" categories "${CMAKE_MATCH_1}")
+            string(REPLACE "', '" ";" categories "${categories}")
+        elseif(line MATCHES "^        { data: \\[(.*)\\] },?$")
+            # bar chart: one value per category
+            set(names "${categories}")
+            string(REPLACE ", " ";" values "${CMAKE_MATCH_1}")
+        elseif(categories AND line MATCHES "^        { name: '(.*)', data: \\[(.*)\\] },?$")
+            # bar chart with several series: one value per category and series
+            set(series "${CMAKE_MATCH_1}")
+            string(REPLACE ", " ";" data "${CMAKE_MATCH_2}")
+            set(i 0)
+            foreach(category IN LISTS categories)
+                list(GET data ${i} value)
+                list(APPEND names "${category} (${series})")
+                list(APPEND values "${value}")
+                math(EXPR i "${i} + 1")
+            endforeach()
+        elseif(line MATCHES "^        { name: '(.*)', data: \\[(.*)\\] },?$")
+            # line chart: one series per function
+            list(APPEND names "${CMAKE_MATCH_1}")
+            list(APPEND values "avg([${CMAKE_MATCH_2}])")
+        elseif(line MATCHES "^}\\)")
+            set(${PREFIX}_${index}_NAMES "${names}" PARENT_SCOPE)
+            set(${PREFIX}_${index}_VALUES "${values}" PARENT_SCOPE)
+        endif()
+    endforeach()
+    set(${PREFIX}_TITLES "${titles}" PARENT_SCOPE)
+endfunction(read_report_charts)
+
+
+# Read one info line (such as "Compiler") from the navbar of a report
+function(read_report_info REPORT_PATH KEY OUT_VAR)
+    set(value "")
+    if(EXISTS "${REPORT_PATH}")
+        file(STRINGS "${REPORT_PATH}" lines REGEX "<a class='navbar-item'>${KEY}: ")
+        if(lines)
+            list(GET lines 0 line)
+            string(REGEX REPLACE ".*<a class='navbar-item'>${KEY}: (.*)</a>.*" "\\1" value "${line}")
+        endif()
+    endif()
+    set(${OUT_VAR} "${value}" PARENT_SCOPE)
+endfunction(read_report_info)
+
+
+# Merge the reports into one html file.
+# Each run/config report is at: <MATRIX_DIR>/<config>/report_<run>.html
+# For every chart of a run, a grouped bar chart is generated: the categories
+# are the functions, and the series are the configurations.
+function(merge_reports MATRIX_DIR OUTPUT_PATH RUNS CONFIGS CONFIG_FLAGS)
+    set(html "<!DOCTYPE html>
+<html>
+<head>
+<meta charset='utf-8'>
+<title>Build Matrix Report</title>
+<script src='https://cdnjs.cloudflare.com/ajax/libs/highcharts/8.2.0/highcharts.min.js'></script>
+<script src='https://cdnjs.cloudflare.com/ajax/libs/highcharts/8.2.0/modules/exporting.min.js'></script>
+<script src='https://cdnjs.cloudflare.com/ajax/libs/highcharts/8.2.0/modules/export-data.min.js'></script>
+<script src='https://cdnjs.cloudflare.com/ajax/libs/highcharts/8.2.0/modules/offline-exporting.min.js'></script>
+<link rel='stylesheet' type='text/css' href='https://cdnjs.cloudflare.com/ajax/libs/bulma/0.9.0/css/bulma.min.css'>
+</head>
+<body>
+<section class='section'>
+<div class='container'>
+<h1 class='title'>Build Matrix Report</h1>
+<table class='table is-narrow is-striped'>
+<thead><tr><th>Config</th><th>Compiler</th><th>Flags</th></tr></thead>
+<tbody>
+")
+    # config table
+    list(GET RUNS 0 first_run)
+    list(LENGTH CONFIGS config_count)
+    math(EXPR config_last "${config_count} - 1")
+    foreach(i RANGE ${config_last})
+        list(GET CONFIGS ${i} config)
+        list(GET CONFIG_FLAGS ${i} flags)
+        read_report_info("${MATRIX_DIR}/${config}/report_${first_run}.html" "Compiler" compiler)
+        string(APPEND html "<tr><td>${config}</td><td>${compiler}</td><td>${flags}</td></tr>\n")
+    endforeach()
+    string(APPEND html "</tbody>\n</table>\n<p>CPU cycles, lower is better. The value of a line chart (such as 'length') is the average of all points.</p>\n")
+
+    # read all reports
+    foreach(run ${RUNS})
+        foreach(config ${CONFIGS})
+            string(MAKE_C_IDENTIFIER "${run}_${config}" prefix)
+            read_report_charts("${MATRIX_DIR}/${config}/report_${run}.html" ${prefix})
+            foreach(title IN LISTS ${prefix}_TITLES)
+                list(FIND ${run}_titles "${title}" found)
+                if(found LESS 0)
+                    list(APPEND ${run}_titles "${title}")
+                endif()
+            endforeach()
+        endforeach()
+    endforeach()
+
+    # chart list
+    set(charts "")
+    set(chart_id 0)
+    foreach(run ${RUNS})
+        string(APPEND html "<h2 class='subtitle'>${run}</h2>\n<ul>\n")
+        foreach(title IN LISTS ${run}_titles)
+            string(APPEND html "<li><a href='#chart_${chart_id}'>${title}</a></li>\n")
+            math(EXPR chart_id "${chart_id} + 1")
+        endforeach()
+        string(APPEND html "</ul>\n")
+    endforeach()
+    string(APPEND html "</div>\n</section>\n")
+
+    # charts
+    set(chart_id 0)
+    foreach(run ${RUNS})
+        foreach(title IN LISTS ${run}_titles)
+            # categories: the functions of all configs, in the order of first found
+            set(names "")
+            foreach(config ${CONFIGS})
+                string(MAKE_C_IDENTIFIER "${run}_${config}" prefix)
+                list(FIND ${prefix}_TITLES "${title}" index)
+                if(index GREATER_EQUAL 0)
+                    foreach(name IN LISTS ${prefix}_${index}_NAMES)
+                        list(FIND names "${name}" found)
+                        if(found LESS 0)
+                            list(APPEND names "${name}")
+                        endif()
+                    endforeach()
+                endif()
+            endforeach()
+
+            # series: one per config
+            set(series "")
+            foreach(config ${CONFIGS})
+                string(MAKE_C_IDENTIFIER "${run}_${config}" prefix)
+                list(FIND ${prefix}_TITLES "${title}" index)
+                set(data "")
+                foreach(name IN LISTS names)
+                    set(value "null")
+                    if(index GREATER_EQUAL 0)
+                        list(FIND ${prefix}_${index}_NAMES "${name}" found)
+                        if(found GREATER_EQUAL 0)
+                            list(GET ${prefix}_${index}_VALUES ${found} value)
+                        endif()
+                    endif()
+                    list(APPEND data "${value}")
+                endforeach()
+                string(REPLACE ";" ", " data "${data}")
+                string(APPEND series "        { name: '${config}', data: [${data}] },\n")
+            endforeach()
+
+            list(LENGTH names name_count)
+            math(EXPR height "${name_count} * ${config_count} * 16 + 160")
+            string(REPLACE ";" "', '" categories "${names}")
+            string(APPEND html "<section class='section'>
+<div class='container'>
+<a name='chart_${chart_id}'></a>
+<div id='chart_id_${chart_id}' style='width: 100%; height: ${height}px'></div>
+</div>
+</section>
+<script>
+Highcharts.chart('chart_id_${chart_id}', {
+    chart: { type: 'bar' },
+    title: { text: '${run}: ${title}' },
+    credits: { enabled: false },
+    xAxis: { categories: ['${categories}'] },
+    yAxis: { title: { text: 'CPU cycles' } },
+    tooltip: { valueDecimals: 2, shared: true },
+    legend: { layout: 'vertical', align: 'right', verticalAlign: 'middle' },
+    plotOptions: { bar: { groupPadding: 0.1, pointPadding: 0.05, borderWidth: 0 } },
+    series: [
+${series}    ]
+})
+</script>
+")
+            math(EXPR chart_id "${chart_id} + 1")
+        endforeach()
+    endforeach()
+
+    # the average function must be defined before charts
+    string(REPLACE "<body>" "<body>\n<script>\nfunction avg(a) { return a.length ? a.reduce(function (s, x) { return s + x }, 0) / a.length : null }\n</script>" html "${html}")
+    string(APPEND html "</body>\n</html>\n")
+    file(WRITE "${OUTPUT_PATH}" "${html}")
+endfunction(merge_reports)
+
+
+# Merge the reports of several code layouts into one html file.
+# Each run/layout report is at: <LAYOUT_DIR>/<layout>/report_<run>.html
+# For every chart of a run, a grouped bar chart is generated: the categories
+# are the functions with the spread ((max - min) / median), and the series are
+# the min, median and max of all layouts.
+function(merge_layout_reports LAYOUT_DIR OUTPUT_PATH RUNS LAYOUTS)
+    list(LENGTH LAYOUTS layout_count)
+    string(REPLACE ";" ", " layout_list "${LAYOUTS}")
+    set(html "<!DOCTYPE html>
+<html>
+<head>
+<meta charset='utf-8'>
+<title>Code Layout Report</title>
+<script src='https://cdnjs.cloudflare.com/ajax/libs/highcharts/8.2.0/highcharts.min.js'></script>
+<script src='https://cdnjs.cloudflare.com/ajax/libs/highcharts/8.2.0/modules/exporting.min.js'></script>
+<script src='https://cdnjs.cloudflare.com/ajax/libs/highcharts/8.2.0/modules/export-data.min.js'></script>
+<script src='https://cdnjs.cloudflare.com/ajax/libs/highcharts/8.2.0/modules/offline-exporting.min.js'></script>
+<link rel='stylesheet' type='text/css' href='https://cdnjs.cloudflare.com/ajax/libs/bulma/0.9.0/css/bulma.min.css'>
+</head>
+<body>
+<script>
+function avg(a) { return a.length ? a.reduce(function (s, x) { return s + x }, 0) / a.length : null }
+function sorted(a) { return a.filter(function (x) { return x !== null }).sort(function (x, y) { return x - y }) }
+function min(a) { a = sorted(a); return a.length ? a[0] : null }
+function max(a) { a = sorted(a); return a.length ? a[a.length - 1] : null }
+function median(a) { a = sorted(a); return a.length ? (a[(a.length - 1) >> 1] + a[a.length >> 1]) / 2 : null }
+function spread(a) { var m = median(a); return m ? (max(a) - min(a)) / m * 100 : 0 }
+</script>
+<section class='section'>
+<div class='container'>
+<h1 class='title'>Code Layout Report</h1>
+")
+    list(GET RUNS 0 first_run)
+    list(GET LAYOUTS 0 first_layout)
+    read_report_info("${LAYOUT_DIR}/${first_layout}/report_${first_run}.html" "Compiler" compiler)
+    string(APPEND html "<p>Compiler: ${compiler}, layouts: ${layout_list}.</p>\n")
+    string(APPEND html "<p>CPU cycles, lower is better. Each layout shifts the code and rotates the link order (LAYOUT_SEED), a large spread means the result depends on the code alignment. The value of a line chart (such as 'length') is the average of all points.</p>\n")
+
+    # read all reports
+    foreach(run ${RUNS})
+        foreach(layout ${LAYOUTS})
+            string(MAKE_C_IDENTIFIER "${run}_${layout}" prefix)
+            read_report_charts("${LAYOUT_DIR}/${layout}/report_${run}.html" ${prefix})
+            foreach(title IN LISTS ${prefix}_TITLES)
+                list(FIND ${run}_titles "${title}" found)
+                if(found LESS 0)
+                    list(APPEND ${run}_titles "${title}")
+                endif()
+            endforeach()
+        endforeach()
+    endforeach()
+
+    # chart list
+    set(chart_id 0)
+    foreach(run ${RUNS})
+        string(APPEND html "<h2 class='subtitle'>${run}</h2>\n<ul>\n")
+        foreach(title IN LISTS ${run}_titles)
+            string(APPEND html "<li><a href='#chart_${chart_id}'>${title}</a></li>\n")
+            math(EXPR chart_id "${chart_id} + 1")
+        endforeach()
+        string(APPEND html "</ul>\n")
+    endforeach()
+    string(APPEND html "</div>\n</section>\n")
+
+    # charts
+    set(chart_id 0)
+    foreach(run ${RUNS})
+        foreach(title IN LISTS ${run}_titles)
+            # categories: the functions of all layouts, in the order of first found
+            set(names "")
+            foreach(layout ${LAYOUTS})
+                string(MAKE_C_IDENTIFIER "${run}_${layout}" prefix)
+                list(FIND ${prefix}_TITLES "${title}" index)
+                if(index GREATER_EQUAL 0)
+                    foreach(name IN LISTS ${prefix}_${index}_NAMES)
+                        list(FIND names "${name}" found)
+                        if(found LESS 0)
+                            list(APPEND names "${name}")
+                        endif()
+                    endforeach()
+                endif()
+            endforeach()
+
+            # values: one array per function, one value per layout
+            set(values "")
+            foreach(name IN LISTS names)
+                set(data "")
+                foreach(layout ${LAYOUTS})
+                    string(MAKE_C_IDENTIFIER "${run}_${layout}" prefix)
+                    list(FIND ${prefix}_TITLES "${title}" index)
+                    set(value "null")
+                    if(index GREATER_EQUAL 0)
+                        list(FIND ${prefix}_${index}_NAMES "${name}" found)
+                        if(found GREATER_EQUAL 0)
+                            list(GET ${prefix}_${index}_VALUES ${found} value)
+                        endif()
+                    endif()
+                    list(APPEND data "${value}")
+                endforeach()
+                string(REPLACE ";" ", " data "${data}")
+                string(APPEND values "        [${data}],\n")
+            endforeach()
+
+            list(LENGTH names name_count)
+            math(EXPR height "${name_count} * 3 * 16 + 160")
+            string(REPLACE ";" "', '" categories "${names}")
+            string(APPEND html "<section class='section'>
+<div class='container'>
+<a name='chart_${chart_id}'></a>
+<div id='chart_id_${chart_id}' style='width: 100%; height: ${height}px'></div>
+</div>
+</section>
+<script>
+(function () {
+    var names = ['${categories}'];
+    var values = [
+${values}    ];
+Highcharts.chart('chart_id_${chart_id}', {
+    chart: { type: 'bar' },
+    title: { text: '${run}: ${title}' },
+    subtitle: { text: '${layout_count} code layouts, spread: (max - min) / median' },
+    credits: { enabled: false },
+    xAxis: { categories: names.map(function (n, i) { return n + ' (' + spread(values[i]).toFixed(1) + '%)' }) },
+    yAxis: { title: { text: 'CPU cycles' } },
+    tooltip: { valueDecimals: 2, shared: true },
+    legend: { layout: 'vertical', align: 'right', verticalAlign: 'middle' },
+    plotOptions: { bar: { groupPadding: 0.1, pointPadding: 0.05, borderWidth: 0 } },
+    series: [
+        { name: 'min', data: values.map(min) },
+        { name: 'median', data: values.map(median) },
+        { name: 'max', data: values.map(max) }
+    ]
+})
+})();
+</script>
+")
+            math(EXPR chart_id "${chart_id} + 1")
+        endforeach()
+    endforeach()
+
+    string(APPEND html "</body>\n</html>\n")
+    file(WRITE "${OUTPUT_PATH}" "${html}")
+endfunction(merge_layout_reports)
@@ -0,0 +1,178 @@
+/*
+ Exact length atoi with a jump table: the length is known (see the exact length
+ contract in benchmark.h), so the code jumps to the per-length entry of a switch
+ (compiled as a jump table), each case adds one digit multiplied by its power
+ of 10. There's no loop and no digit-scanning branch, the digits are validated
+ all together at the end.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "benchmark.h"
+
+
+/* compiler builtin check (clang) */
+#ifndef yy_has_builtin
+#   ifdef __has_builtin
+#       define yy_has_builtin(x) __has_builtin(x)
+#   else
+#       define yy_has_builtin(x) 0
+#   endif
+#endif
+
+/* compiler attribute check (gcc/clang) */
+#ifndef yy_has_attribute
+#   ifdef __has_attribute
+#       define yy_has_attribute(x) __has_attribute(x)
+#   else
+#       define yy_has_attribute(x) 0
+#   endif
+#endif
+
+/* inline */
+#ifndef yy_inline
+#   if _MSC_VER >= 1200
+#       define yy_inline __forceinline
+#   elif defined(_MSC_VER)
+#       define yy_inline __inline
+#   elif yy_has_attribute(always_inline) || __GNUC__ >= 4
+#       define yy_inline __inline__ __attribute__((always_inline))
+#   elif defined(__clang__) || defined(__GNUC__)
+#       define yy_inline __inline__
+#   elif defined(__cplusplus) || (__STDC__ >= 1 && __STDC_VERSION__ >= 199901L)
+#       define yy_inline inline
+#   else
+#       define yy_inline
+#   endif
+#endif
+
+/* likely */
+#ifndef yy_likely
+#   if yy_has_builtin(__builtin_expect) || __GNUC__ >= 4
+#       define yy_likely(expr) __builtin_expect(!!(expr), 1)
+#   else
+#       define yy_likely(expr) (expr)
+#   endif
+#endif
+
+/* unlikely */
+#ifndef yy_unlikely
+#   if yy_has_builtin(__builtin_expect) || __GNUC__ >= 4
+#       define yy_unlikely(expr) __builtin_expect(!!(expr), 0)
+#   else
+#       define yy_unlikely(expr) (expr)
+#   endif
+#endif
+
+
+/* switch case fallthrough */
+#ifndef yy_fallthrough
+#   if yy_has_attribute(fallthrough)
+#       define yy_fallthrough __attribute__((fallthrough))
+#   else
+#       define yy_fallthrough
+#   endif
+#endif
+
+#define repeat_in_19_2(x) x(19) x(18) x(17) x(16) x(15) x(14) x(13) x(12) \
+                          x(11) x(10) x(9) x(8) x(7) x(6) x(5) x(4) x(3) \
+                          x(2)
+
+static const uint64_t pow10_table[] = {
+    1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL,
+    10000000ULL, 100000000ULL, 1000000000ULL, 10000000000ULL,
+    100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+    100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,
+    100000000000000000ULL, 1000000000000000000ULL, 10000000000000000000ULL
+};
+
+/** More than 20 digits: overflow if all are digits. */
+static atoi_result read_digits_long(const uint8_t *cur, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        if ((uint8_t)(cur[i] - '0') > 9) return atoi_result_fail;
+    }
+    return atoi_result_overflow;
+}
+
+/** Read exact `len` digits as uint64. */
+static yy_inline atoi_result read_digits(const uint8_t *cur, size_t len, uint64_t *out) {
+    const uint8_t *end = cur + len;
+    uint64_t val = 0, bad = 0, d, first = 0;
+    
+    if (yy_unlikely(len > 1 && *cur == '0')) return atoi_result_fail;
+    
+    /* d + 6 > 15 if d is not a digit */
+    switch (len) {
+        case 20:
+            first = (uint8_t)(end[-20] - '0');
+            bad |= first + 6;
+            yy_fallthrough;
+#define expr_case(i) \
+        case i: \
+            d = (uint8_t)(end[-i] - '0'); \
+            bad |= d + 6; \
+            val += d * pow10_table[i - 1]; \
+            yy_fallthrough;
+        repeat_in_19_2(expr_case)
+#undef expr_case
+        case 1:
+            d = (uint8_t)(end[-1] - '0');
+            bad |= d + 6;
+            val += d;
+            break;
+        case 0:
+            return atoi_result_fail;
+        default:
+            return read_digits_long(cur, len);
+    }
+    if (yy_unlikely(bad > 15)) return atoi_result_fail;
+    if (yy_unlikely(first)) {
+        /* 20 digits: [10000000000000000000, 18446744073709551615] */
+        if (first > 1 || val > UINT64_MAX - pow10_table[19]) return atoi_result_overflow;
+        val += pow10_table[19];
+    }
+    *out = val;
+    return atoi_result_suc;
+}
+
+uint32_t atoi_u32_jump_exact(const char *str, size_t len, char **endptr, atoi_result *res) {
+    uint64_t val = 0;
+    *res = read_digits((const uint8_t *)str, len, &val);
+    if (yy_unlikely(*res == atoi_result_suc && val > UINT32_MAX)) {
+        *res = atoi_result_overflow;
+    }
+    *endptr = (char *)str + (*res == atoi_result_fail ? 0 : len);
+    return (uint32_t)val;
+}
+
+int32_t atoi_i32_jump_exact(const char *str, size_t len, char **endptr, atoi_result *res) {
+    bool sign = (len > 0 && *str == '-');
+    uint64_t val = 0;
+    *res = read_digits((const uint8_t *)str + sign, len - sign, &val);
+    if (yy_unlikely(*res == atoi_result_suc && val > (uint64_t)INT32_MAX + sign)) {
+        *res = atoi_result_overflow;
+    }
+    *endptr = (char *)str + (*res == atoi_result_fail ? 0 : len);
+    return sign ? (int32_t)(0 - (uint32_t)val) : (int32_t)val;
+}
+
+uint64_t atoi_u64_jump_exact(const char *str, size_t len, char **endptr, atoi_result *res) {
+    uint64_t val = 0;
+    *res = read_digits((const uint8_t *)str, len, &val);
+    *endptr = (char *)str + (*res == atoi_result_fail ? 0 : len);
+    return val;
+}
+
+int64_t atoi_i64_jump_exact(const char *str, size_t len, char **endptr, atoi_result *res) {
+    bool sign = (len > 0 && *str == '-');
+    uint64_t val = 0;
+    *res = read_digits((const uint8_t *)str + sign, len - sign, &val);
+    if (yy_unlikely(*res == atoi_result_suc && val > (uint64_t)INT64_MAX + sign)) {
+        *res = atoi_result_overflow;
+    }
+    *endptr = (char *)str + (*res == atoi_result_fail ? 0 : len);
+    return sign ? (int64_t)(0 - val) : (int64_t)val;
+}
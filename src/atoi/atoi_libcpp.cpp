@@ -1,16 +1,16 @@
 /*
  Use C++17 std::from_chars()
+ The `len` is used as the end of input, no need to scan for the terminator.
  */
 
 #include <charconv>
-#include <cstring>
 #include "benchmark.h"
 
 extern "C" {
 
 uint32_t atoi_u32_libcpp(const char *str, size_t len, char **endptr, atoi_result *res)  {
     uint32_t val;
-    std::from_chars_result r = std::from_chars(str, str + strlen(str), val, 10);
+    std::from_chars_result r = std::from_chars(str, str + len, val, 10);
     *endptr = (char *)r.ptr;
     switch (r.ec) {
         case std::errc::result_out_of_range: *res = atoi_result_overflow; break;
@@ -22,7 +22,7 @@ uint32_t atoi_u32_libcpp(const char *str, size_t len, char **endptr, atoi_result
 
 int32_t atoi_i32_libcpp(const char *str, size_t len, char **endptr, atoi_result *res)  {
     int32_t val;
-    std::from_chars_result r = std::from_chars(str, str + strlen(str), val, 10);
+    std::from_chars_result r = std::from_chars(str, str + len, val, 10);
     *endptr = (char *)r.ptr;
     switch (r.ec) {
         case std::errc::result_out_of_range: *res = atoi_result_overflow; break;
@@ -34,7 +34,7 @@ int32_t atoi_i32_libcpp(const char *str, size_t len, char **endptr, atoi_result
 
 uint64_t atoi_u64_libcpp(const char *str, size_t len, char **endptr, atoi_result *res)  {
     uint64_t val;
-    std::from_chars_result r = std::from_chars(str, str + strlen(str), val, 10);
+    std::from_chars_result r = std::from_chars(str, str + len, val, 10);
     *endptr = (char *)r.ptr;
     switch (r.ec) {
         case std::errc::result_out_of_range: *res = atoi_result_overflow; break;
@@ -46,7 +46,7 @@ uint64_t atoi_u64_libcpp(const char *str, size_t len, char **endptr, atoi_result
 
 int64_t atoi_i64_libcpp(const char *str, size_t len, char **endptr, atoi_result *res)  {
     int64_t val;
-    std::from_chars_result r = std::from_chars(str, str + strlen(str), val, 10);
+    std::from_chars_result r = std::from_chars(str, str + len, val, 10);
     *endptr = (char *)r.ptr;
     switch (r.ec) {
         case std::errc::result_out_of_range: *res = atoi_result_overflow; break;
@@ -56,4 +56,32 @@ int64_t atoi_i64_libcpp(const char *str, size_t len, char **endptr, atoi_result
     return val;
 }
 
+/* exact length contract: the whole input should be consumed */
+
+uint32_t atoi_u32_libcpp_exact(const char *str, size_t len, char **endptr, atoi_result *res)  {
+    uint32_t val = atoi_u32_libcpp(str, len, endptr, res);
+    if (*endptr != str + len || (len > 1 && *str == '0')) *res = atoi_result_fail;
+    return val;
+}
+
+int32_t atoi_i32_libcpp_exact(const char *str, size_t len, char **endptr, atoi_result *res)  {
+    int32_t val = atoi_i32_libcpp(str, len, endptr, res);
+    size_t sign = (len > 0 && *str == '-');
+    if (*endptr != str + len || (len > sign + 1 && str[sign] == '0')) *res = atoi_result_fail;
+    return val;
+}
+
+uint64_t atoi_u64_libcpp_exact(const char *str, size_t len, char **endptr, atoi_result *res)  {
+    uint64_t val = atoi_u64_libcpp(str, len, endptr, res);
+    if (*endptr != str + len || (len > 1 && *str == '0')) *res = atoi_result_fail;
+    return val;
+}
+
+int64_t atoi_i64_libcpp_exact(const char *str, size_t len, char **endptr, atoi_result *res)  {
+    int64_t val = atoi_i64_libcpp(str, len, endptr, res);
+    size_t sign = (len > 0 && *str == '-');
+    if (*endptr != str + len || (len > sign + 1 && str[sign] == '0')) *res = atoi_result_fail;
+    return val;
+}
+
 }
@@ -0,0 +1,192 @@
+/*
+ Exact length atoi with SWAR (SIMD within a register): the length is known (see
+ the exact length contract in benchmark.h), so the digits are read with 8-byte
+ loads, and the bytes after the length are shifted out instead of being
+ scanned. A number of up to 20 digits needs at most 3 loads, and the digits
+ are validated with a mask test.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "benchmark.h"
+
+
+/* compiler builtin check (clang) */
+#ifndef yy_has_builtin
+#   ifdef __has_builtin
+#       define yy_has_builtin(x) __has_builtin(x)
+#   else
+#       define yy_has_builtin(x) 0
+#   endif
+#endif
+
+/* compiler attribute check (gcc/clang) */
+#ifndef yy_has_attribute
+#   ifdef __has_attribute
+#       define yy_has_attribute(x) __has_attribute(x)
+#   else
+#       define yy_has_attribute(x) 0
+#   endif
+#endif
+
+/* inline */
+#ifndef yy_inline
+#   if _MSC_VER >= 1200
+#       define yy_inline __forceinline
+#   elif defined(_MSC_VER)
+#       define yy_inline __inline
+#   elif yy_has_attribute(always_inline) || __GNUC__ >= 4
+#       define yy_inline __inline__ __attribute__((always_inline))
+#   elif defined(__clang__) || defined(__GNUC__)
+#       define yy_inline __inline__
+#   elif defined(__cplusplus) || (__STDC__ >= 1 && __STDC_VERSION__ >= 199901L)
+#       define yy_inline inline
+#   else
+#       define yy_inline
+#   endif
+#endif
+
+/* likely */
+#ifndef yy_likely
+#   if yy_has_builtin(__builtin_expect) || __GNUC__ >= 4
+#       define yy_likely(expr) __builtin_expect(!!(expr), 1)
+#   else
+#       define yy_likely(expr) (expr)
+#   endif
+#endif
+
+/* unlikely */
+#ifndef yy_unlikely
+#   if yy_has_builtin(__builtin_expect) || __GNUC__ >= 4
+#       define yy_unlikely(expr) __builtin_expect(!!(expr), 0)
+#   else
+#       define yy_unlikely(expr) (expr)
+#   endif
+#endif
+
+
+/* byte order (the loaded bytes are swapped on big-endian) */
+#ifndef yy_little_endian
+#   if (defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__) || \
+        defined(__LITTLE_ENDIAN__) || defined(_MSC_VER)
+#       define yy_little_endian 1
+#   else
+#       define yy_little_endian 0
+#   endif
+#endif
+
+/** More than 20 digits: overflow if all are digits. */
+static atoi_result read_digits_long(const uint8_t *cur, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        if ((uint8_t)(cur[i] - '0') > 9) return atoi_result_fail;
+    }
+    return atoi_result_overflow;
+}
+
+/**
+ Load 8 bytes and keep the first `n` (1 to 8) as digit values, in the highest
+ bytes, the lower bytes are filled with zero digits.
+ Returns the non-zero bits of 0x80 if there's any non-digit byte.
+ */
+static yy_inline uint64_t swar_load_digits(const uint8_t *cur, size_t n, uint64_t *bad) {
+    uint64_t val;
+    memcpy(&val, cur, 8);
+#if !yy_little_endian
+    val = ((val & 0x00000000000000FFULL) << 56) | ((val & 0x000000000000FF00ULL) << 40) |
+          ((val & 0x0000000000FF0000ULL) << 24) | ((val & 0x00000000FF000000ULL) << 8) |
+          ((val & 0x000000FF00000000ULL) >> 8) | ((val & 0x0000FF0000000000ULL) >> 24) |
+          ((val & 0x00FF000000000000ULL) >> 40) | ((val & 0xFF00000000000000ULL) >> 56);
+#endif
+    /* a borrow only goes to the higher bytes, which are either invalid or
+       shifted out */
+    val -= 0x3030303030303030ULL;
+    val <<= (8 - n) * 8;
+    *bad |= (val | (val + 0x7676767676767676ULL)) & 0x8080808080808080ULL;
+    return val;
+}
+
+/** Convert 8 digit values to integer (the lowest byte is the highest digit). */
+static yy_inline uint64_t swar_parse_digits(uint64_t val) {
+    const uint64_t mask = 0x000000FF000000FFULL;
+    const uint64_t mul1 = 0x000F424000000064ULL; /* 100 + (1000000 << 32) */
+    const uint64_t mul2 = 0x0000271000000001ULL; /* 1 + (10000 << 32) */
+    val = (val * 10) + (val >> 8);
+    val = (((val & mask) * mul1) + (((val >> 16) & mask) * mul2)) >> 32;
+    return val;
+}
+
+/** Read exact `len` digits as uint64. */
+static yy_inline atoi_result read_digits(const uint8_t *cur, size_t len, uint64_t *out) {
+    uint64_t val, hi, bad = 0;
+    
+    if (yy_unlikely(len > 1 && *cur == '0')) return atoi_result_fail;
+    if (yy_unlikely(len - 1 >= 20)) {
+        if (len == 0) return atoi_result_fail;
+        return read_digits_long(cur, len);
+    }
+    
+    if (len <= 8) {
+        val = swar_parse_digits(swar_load_digits(cur, len, &bad));
+        if (yy_unlikely(bad)) return atoi_result_fail;
+    } else if (len <= 16) {
+        hi = swar_parse_digits(swar_load_digits(cur, len - 8, &bad));
+        val = swar_parse_digits(swar_load_digits(cur + len - 8, 8, &bad));
+        if (yy_unlikely(bad)) return atoi_result_fail;
+        val += hi * 100000000;
+    } else {
+        /* 17 to 20 digits: at most 4 digits in the highest part */
+        hi = swar_parse_digits(swar_load_digits(cur, len - 16, &bad));
+        val = swar_parse_digits(swar_load_digits(cur + len - 16, 8, &bad)) * 100000000;
+        val += swar_parse_digits(swar_load_digits(cur + len - 8, 8, &bad));
+        if (yy_unlikely(bad)) return atoi_result_fail;
+        /* 18446744073709551615: the highest part is 1844 */
+        if (yy_unlikely(hi > 1844)) return atoi_result_overflow;
+        hi *= 10000000000000000ULL;
+        if (yy_unlikely(val > UINT64_MAX - hi)) return atoi_result_overflow;
+        val += hi;
+    }
+    *out = val;
+    return atoi_result_suc;
+}
+
+uint32_t atoi_u32_swar_exact(const char *str, size_t len, char **endptr, atoi_result *res) {
+    uint64_t val = 0;
+    *res = read_digits((const uint8_t *)str, len, &val);
+    if (yy_unlikely(*res == atoi_result_suc && val > UINT32_MAX)) {
+        *res = atoi_result_overflow;
+    }
+    *endptr = (char *)str + (*res == atoi_result_fail ? 0 : len);
+    return (uint32_t)val;
+}
+
+int32_t atoi_i32_swar_exact(const char *str, size_t len, char **endptr, atoi_result *res) {
+    bool sign = (len > 0 && *str == '-');
+    uint64_t val = 0;
+    *res = read_digits((const uint8_t *)str + sign, len - sign, &val);
+    if (yy_unlikely(*res == atoi_result_suc && val > (uint64_t)INT32_MAX + sign)) {
+        *res = atoi_result_overflow;
+    }
+    *endptr = (char *)str + (*res == atoi_result_fail ? 0 : len);
+    return sign ? (int32_t)(0 - (uint32_t)val) : (int32_t)val;
+}
+
+uint64_t atoi_u64_swar_exact(const char *str, size_t len, char **endptr, atoi_result *res) {
+    uint64_t val = 0;
+    *res = read_digits((const uint8_t *)str, len, &val);
+    *endptr = (char *)str + (*res == atoi_result_fail ? 0 : len);
+    return val;
+}
+
+int64_t atoi_i64_swar_exact(const char *str, size_t len, char **endptr, atoi_result *res) {
+    bool sign = (len > 0 && *str == '-');
+    uint64_t val = 0;
+    *res = read_digits((const uint8_t *)str + sign, len - sign, &val);
+    if (yy_unlikely(*res == atoi_result_suc && val > (uint64_t)INT64_MAX + sign)) {
+        *res = atoi_result_overflow;
+    }
+    *endptr = (char *)str + (*res == atoi_result_fail ? 0 : len);
+    return sign ? (int64_t)(0 - val) : (int64_t)val;
+}
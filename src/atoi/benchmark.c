@@ -4,6 +4,7 @@
  */
 #include "benchmark.h"
 #include "yybench.h"
+#include "bench_cpu.h"
 #include <inttypes.h>
 
 #ifndef BENCHMARK_DATA_PATH
@@ -32,6 +33,10 @@ static int atoi_group_num = 0;
 static atoi_group atoi_group_arr[128];
 static int atoi_group_name_max = 0;
 
+/* the functions with exact length contract (see benchmark.h) */
+static int atoi_exact_num = 0;
+static atoi_group atoi_exact_arr[128];
+
 static char *atoi_group_get_name_aligned(atoi_group group, bool align_right) {
     static char buf[64];
     int len, space, i;
@@ -53,13 +58,14 @@ static char *atoi_group_get_name_aligned(atoi_group group, bool align_right) {
 
 #define atoi_group_verify_type(type) \
 static bool atoi_group_verify_##type(atoi_group group, const char *str,         \
-                                     size_t _len, type _val, atoi_result _res) {\
+                                     size_t str_len, size_t _len,               \
+                                     type _val, atoi_result _res) {             \
     atoi_##type##_func func = group. type##_func;                              \
     type val;                                                                   \
     char *end;                                                                  \
     atoi_result res;                                                            \
                                                                                 \
-    val = func(str, strlen(str), &end, &res);                                   \
+    val = func(str, str_len, &end, &res);                                       \
     if (res != _res) {                                                          \
         printf("atoi_%s_%s not match, input:%s, expect:%s, return:%s\n",        \
                #type, group.name, str, atoi_result_desc(_res), atoi_result_desc(res)); \
@@ -85,9 +91,13 @@ atoi_group_verify_type(i64)
 
 
 
-static void atoi_group_verify_all(void) {
-    for (int g = 1; g < atoi_group_num; g++) {
-        atoi_group group = atoi_group_arr[g];
+/* for the exact length functions, the input is followed by digits */
+#define atoi_verify_pad(_len) \
+        if (exact) memcpy(buf + (_len), "987", 4);
+
+static void atoi_group_verify_all(atoi_group *groups, int num, bool exact) {
+    for (int g = 0; g < num; g++) {
+        atoi_group group = groups[g];
         bool suc = true;
         char buf[32];
         const char *str;
@@ -97,25 +107,35 @@ static void atoi_group_verify_all(void) {
         str = _str; \
         len = strlen(str); \
         memcpy(buf, str, len + 1); \
-        suc &= atoi_group_verify_##_type(group, buf, len, _num, atoi_result_##_ret); \
+        atoi_verify_pad(len) \
+        suc &= atoi_group_verify_##_type(group, buf, len, len, _num, atoi_result_##_ret); \
         buf[len + 1] = 'A'; \
         buf[len + 2] = '\0'; \
-        suc &= atoi_group_verify_##_type(group, buf, len, _num, atoi_result_##_ret); \
+        suc &= atoi_group_verify_##_type(group, buf, len, len, _num, atoi_result_##_ret); \
         
 #define verify_utype(_type, _str, _num, _ret) \
         str = _str; \
         len = strlen(str); \
         memcpy(buf, str, len + 1); \
-        suc &= atoi_group_verify_##_type(group, buf, len, _num, atoi_result_##_ret); \
+        atoi_verify_pad(len) \
+        suc &= atoi_group_verify_##_type(group, buf, len, len, _num, atoi_result_##_ret); \
         buf[len + 1] = 'A'; \
         buf[len + 2] = '\0'; \
-        suc &= atoi_group_verify_##_type(group, buf, len, _num, atoi_result_##_ret); \
+        suc &= atoi_group_verify_##_type(group, buf, len, len, _num, atoi_result_##_ret); \
         buf[0] = '-'; \
         memcpy(buf + 1, str, len + 1); \
-        suc &= atoi_group_verify_##_type(group, buf, 0, 0, atoi_result_fail); \
+        atoi_verify_pad(len + 1) \
+        suc &= atoi_group_verify_##_type(group, buf, len + 1, 0, 0, atoi_result_fail); \
         buf[len + 1] = 'A'; \
         buf[len + 2] = '\0'; \
-        suc &= atoi_group_verify_##_type(group, buf, 0, 0, atoi_result_fail); \
+        suc &= atoi_group_verify_##_type(group, buf, len + 1, 0, 0, atoi_result_fail); \
+        
+#define verify_fail(_type, _str) \
+        str = _str; \
+        len = strlen(str); \
+        memcpy(buf, str, len + 1); \
+        atoi_verify_pad(len) \
+        suc &= atoi_group_verify_##_type(group, buf, len, 0, 0, atoi_result_fail); \
         
         //  4294967295
         //  2147483647
@@ -181,23 +201,32 @@ static void atoi_group_verify_all(void) {
         verify_itype(u64, "28446744073709551615", 0, overflow)
         verify_itype(u64, "100000000000000000000", 0, overflow)
                 
-        suc &= atoi_group_verify_i32(group, "A", 0, 0, atoi_result_fail);
-        suc &= atoi_group_verify_u32(group, "A", 0, 0, atoi_result_fail);
-        suc &= atoi_group_verify_i64(group, "A", 0, 0, atoi_result_fail);
-        suc &= atoi_group_verify_u64(group, "A", 0, 0, atoi_result_fail);
-
-        suc &= atoi_group_verify_i32(group, "-", 0, 0, atoi_result_fail);
-        suc &= atoi_group_verify_u32(group, "-", 0, 0, atoi_result_fail);
-        suc &= atoi_group_verify_i64(group, "-", 0, 0, atoi_result_fail);
-        suc &= atoi_group_verify_u64(group, "-", 0, 0, atoi_result_fail);
+        verify_fail(i32, "A")
+        verify_fail(u32, "A")
+        verify_fail(i64, "A")
+        verify_fail(u64, "A")
+
+        verify_fail(i32, "-")
+        verify_fail(u32, "-")
+        verify_fail(i64, "-")
+        verify_fail(u64, "-")
         
-        suc &= atoi_group_verify_i32(group, "-A", 0, 0, atoi_result_fail);
-        suc &= atoi_group_verify_u32(group, "-A", 0, 0, atoi_result_fail);
-        suc &= atoi_group_verify_i64(group, "-A", 0, 0, atoi_result_fail);
-        suc &= atoi_group_verify_u64(group, "-A", 0, 0, atoi_result_fail);
+        verify_fail(i32, "-A")
+        verify_fail(u32, "-A")
+        verify_fail(i64, "-A")
+        verify_fail(u64, "-A")
         
-        suc &= atoi_group_verify_u32(group, "-1", 0, 0, atoi_result_fail);
-        suc &= atoi_group_verify_u64(group, "-1", 0, 0, atoi_result_fail);
+        verify_fail(u32, "-1")
+        verify_fail(u64, "-1")
+        
+        if (exact) {
+            verify_fail(u32, "01")
+            verify_fail(i32, "-01")
+            verify_fail(u64, "00")
+            verify_fail(i64, "-00")
+            verify_fail(u64, "")
+            verify_fail(i64, "")
+        }
         
         if (suc) printf("    %s [OK]\n", atoi_group_get_name_aligned(group, false));
     }
@@ -353,14 +382,42 @@ static void fill_rand_i64_len(char *buf, u32 count, u32 len) {
 }
 
 
+/* numbers separated by ',' (as in a CSV line or JSON array), the exact length
+   of each number is known, len: [1, 20], or 0 for random length */
+static void fill_exact_u64(char *buf, char **strs, u32 *lens, u32 count, u32 len) {
+    char *cur = buf;
+    for (u32 i = 0; i < count; i++) {
+        u64 v = rand_u64_len(len ? len : yy_random32_range(1, 20));
+        strs[i] = cur;
+        lens[i] = (u32)snprintf(cur, u64_max_buf_len, "%" PRIu64, v);
+        cur += lens[i];
+        *cur++ = ',';
+    }
+    *cur = '\0';
+}
+
+/* len: [1, 19], or 0 for random length */
+static void fill_exact_i64(char *buf, char **strs, u32 *lens, u32 count, u32 len) {
+    char *cur = buf;
+    for (u32 i = 0; i < count; i++) {
+        i64 v = rand_i64_len(len ? len : yy_random32_range(1, 19), yy_random32() % 2);
+        strs[i] = cur;
+        lens[i] = (u32)snprintf(cur, i64_max_buf_len, "%" PRIi64, v);
+        cur += lens[i];
+        *cur++ = ',';
+    }
+    *cur = '\0';
+}
+
+
 
 static void atoi_group_benchmark_all(const char *output_path) {
     
     static const int sample_count = 10000;
     static const int repeat_count = 64;
     
-    yy_chart *charts[8], *chart;
-    int chart_count = 8;
+    yy_chart *charts[12], *chart;
+    int chart_count = 12;
     u64 tsc_begin, tsc_end, tsc;
     f64 tsc_avg, tsc_avg_min, tsc_avg_sum, cycles;
     atoi_group group;
@@ -372,18 +429,25 @@ static void atoi_group_benchmark_all(const char *output_path) {
     char *endptr;
     
     printf("prepare...\n");
-    yy_cpu_setup_priority();
-    yy_cpu_spin(1.0);
-    yy_cpu_measure_freq();
+    bench_cpu_setup();
     
     char *buf = malloc(sample_count * u64_max_buf_len);
-    if (!buf) {
+    /* the exact length functions may read 8 bytes after the last number */
+    char *exact_buf = malloc(sample_count * u64_max_buf_len + 16);
+    char **exact_strs = malloc(sample_count * sizeof(char *));
+    u32 *exact_lens = malloc(sample_count * sizeof(u32));
+    if (!buf || !exact_buf || !exact_strs || !exact_lens) {
         printf("memory allocation failed.\n");
+        free(buf);
+        free(exact_buf);
+        free(exact_strs);
+        free(exact_lens);
         return;
     }
+    memset(exact_buf, 0, sample_count * u64_max_buf_len + 16);
     
     yy_report *report = yy_report_new();
-    yy_report_add_env_info(report);
+    bench_report_add_env_info(report);
     
     // create charts
     for (int i = 0; i < chart_count; i++) {
@@ -399,6 +463,10 @@ static void atoi_group_benchmark_all(const char *output_path) {
             case 5: op.title = "atoi i32 (random length)"; break;
             case 6: op.title = "atoi i64 (fixed length)"; break;
             case 7: op.title = "atoi i64 (random length)"; break;
+            case 8: op.title = "atoi u64 (exact length, fixed length)"; break;
+            case 9: op.title = "atoi u64 (exact length, random length)"; break;
+            case 10: op.title = "atoi i64 (exact length, fixed length)"; break;
+            case 11: op.title = "atoi i64 (exact length, random length)"; break;
             default: break;
         }
         if ((i % 2) == 0) { /* sequence (line chart) */
@@ -448,24 +516,27 @@ static void atoi_group_benchmark_all(const char *output_path) {
             fill_rand_##type##_len(buf, sample_count, len);                     \
                                                                                 \
             /* run benchmark */                                                 \
-            tsc_avg_min = HUGE_VAL;                                             \
-            for (int j = 0; j < repeat_count; j++) {                            \
-                tsc_begin = yy_time_get_ticks();                                \
-                for (int s = 0; s < sample_count; s++) {                        \
-                    type##_out = func(buf + s * type##_max_buf_len, type##_max_buf_len, &endptr, &res); \
+            for (int retry = 0; ; retry++) {                                    \
+                tsc_avg_min = HUGE_VAL;                                         \
+                for (int j = 0; j < repeat_count; j++) {                        \
+                    tsc_begin = yy_time_get_ticks();                            \
+                    for (int s = 0; s < sample_count; s++) {                    \
+                        type##_out = func(buf + s * type##_max_buf_len, type##_max_buf_len, &endptr, &res); \
+                    }                                                           \
+                    tsc_end = yy_time_get_ticks();                              \
+                    tsc = tsc_end - tsc_begin;                                  \
+                    tsc_avg = (double)tsc / sample_count;                       \
+                    if (tsc_avg < tsc_avg_min) tsc_avg_min = tsc_avg;           \
                 }                                                               \
-                tsc_end = yy_time_get_ticks();                                  \
-                tsc = tsc_end - tsc_begin;                                      \
-                tsc_avg = (double)tsc / sample_count;                           \
-                if (tsc_avg < tsc_avg_min) tsc_avg_min = tsc_avg;               \
+                if (bench_cpu_check_freq(retry)) break;                         \
             }                                                                   \
             tsc_avg_sum += tsc_avg_min;                                         \
-            cycles = tsc_avg_min * yy_cpu_get_cycle_per_tick();                 \
+            cycles = tsc_avg_min * bench_cpu_get_cycle_per_tick();                 \
             yy_chart_item_add_float(chart, (float)cycles);                      \
         }                                                                       \
         yy_chart_item_end(chart);                                               \
         tsc_avg_min = tsc_avg_sum / max_len;                                    \
-        cycles = tsc_avg_min * yy_cpu_get_cycle_per_tick();                     \
+        cycles = tsc_avg_min * bench_cpu_get_cycle_per_tick();                     \
     }
     
     
@@ -483,18 +554,66 @@ static void atoi_group_benchmark_all(const char *output_path) {
         if (!func) continue;                                                    \
                                                                                 \
         /* run benchmark */                                                     \
+        for (int retry = 0; ; retry++) {                                        \
+            tsc_avg_min = HUGE_VAL;                                             \
+            for (int j = 0; j < repeat_count; j++) {                            \
+                tsc_begin = yy_time_get_ticks();                                \
+                for (int s = 0; s < sample_count; s++) {                        \
+                    type##_out = func(buf + s * type##_max_buf_len, type##_max_buf_len, &endptr, &res); \
+                }                                                               \
+                tsc_end = yy_time_get_ticks();                                  \
+                tsc = tsc_end - tsc_begin;                                      \
+                tsc_avg = (double)tsc / sample_count;                           \
+                if (tsc_avg < tsc_avg_min) tsc_avg_min = tsc_avg;               \
+            }                                                                   \
+            if (bench_cpu_check_freq(retry)) break;                             \
+        }                                                                       \
+        cycles = tsc_avg_min * bench_cpu_get_cycle_per_tick();                     \
+        yy_chart_item_with_float(chart, group.name, (float)cycles);             \
+    }
+    
+    /* both the scanning functions (len as upper bound) and the exact length
+       functions read the same numbers, a number is followed by ',' */
+#define BENCHMARK_EXACT_RUN(type)                                               \
+    for (int retry = 0; ; retry++) {                                            \
         tsc_avg_min = HUGE_VAL;                                                 \
         for (int j = 0; j < repeat_count; j++) {                                \
             tsc_begin = yy_time_get_ticks();                                    \
             for (int s = 0; s < sample_count; s++) {                            \
-                type##_out = func(buf + s * type##_max_buf_len, type##_max_buf_len, &endptr, &res); \
+                type##_out = func(exact_strs[s], exact_lens[s], &endptr, &res); \
             }                                                                   \
             tsc_end = yy_time_get_ticks();                                      \
             tsc = tsc_end - tsc_begin;                                          \
             tsc_avg = (double)tsc / sample_count;                               \
             if (tsc_avg < tsc_avg_min) tsc_avg_min = tsc_avg;                   \
         }                                                                       \
-        cycles = tsc_avg_min * yy_cpu_get_cycle_per_tick();                     \
+        if (bench_cpu_check_freq(retry)) break;                                 \
+    }                                                                           \
+    cycles = tsc_avg_min * bench_cpu_get_cycle_per_tick();
+    
+#define BENCHMARK_EXACT(type, max_len, chart_idx)                               \
+    printf("run exact length %s\n", #type);                                     \
+    for (int i = 0; i < atoi_group_num + atoi_exact_num; i++) {                 \
+        atoi_##type##_func func;                                                \
+        if (i < atoi_group_num) group = atoi_group_arr[i];                      \
+        else group = atoi_exact_arr[i - atoi_group_num];                        \
+        func = group.type ## _func;                                             \
+        if (!func) continue;                                                    \
+                                                                                \
+        chart = charts[chart_idx];                                              \
+        yy_chart_item_begin(chart, group.name);                                 \
+        for (int len = 1; len <= max_len; len++) {                              \
+            yy_random_reset();                                                  \
+            fill_exact_##type(exact_buf, exact_strs, exact_lens, sample_count, len); \
+            BENCHMARK_EXACT_RUN(type)                                           \
+            yy_chart_item_add_float(chart, (float)cycles);                      \
+        }                                                                       \
+        yy_chart_item_end(chart);                                               \
+                                                                                \
+        chart = charts[chart_idx + 1];                                          \
+        yy_random_reset();                                                      \
+        fill_exact_##type(exact_buf, exact_strs, exact_lens, sample_count, 0);  \
+        BENCHMARK_EXACT_RUN(type)                                               \
         yy_chart_item_with_float(chart, group.name, (float)cycles);             \
     }
     
@@ -506,6 +625,8 @@ static void atoi_group_benchmark_all(const char *output_path) {
     BENCHMARK_RANDOM(i32, 5)
     BENCHMARK_SEQUENTIAL(i64, 19, 6)
     BENCHMARK_RANDOM(i64, 7)
+    BENCHMARK_EXACT(u64, 20, 8)
+    BENCHMARK_EXACT(i64, 19, 10)
     
     for (int i = 0; i < chart_count; i++) {
         yy_chart_sort_items_with_value(charts[i], false);
@@ -514,6 +635,8 @@ static void atoi_group_benchmark_all(const char *output_path) {
         yy_report_add_chart(report, charts[i]);
     }
     
+    bench_report_add_drift_info(report);
+    
     if (!yy_report_write_html_file(report, output_path)) {
         printf("[ERROR] report write failed: %s\n", output_path);
     } else {
@@ -524,6 +647,9 @@ static void atoi_group_benchmark_all(const char *output_path) {
     
     yy_report_free(report);
     free(buf);
+    free(exact_buf);
+    free(exact_strs);
+    free(exact_lens);
 }
 
 
@@ -531,6 +657,7 @@ static void atoi_group_benchmark_all(const char *output_path) {
 
 static void atoi_group_cleanup(void) {
     atoi_group_num = 0;
+    atoi_exact_num = 0;
     atoi_group_name_max = 0;
 }
 
@@ -553,13 +680,31 @@ static void atoi_group_register_all(void) {
     register_group_name(libcpp);
     register_group_name(lemire);
     register_group_name(yy);
+    
+#define register_exact_name(_name) \
+    extern u32 atoi_u32_##_name##_exact(const char *str, size_t len, char **endptr, atoi_result *res); \
+    extern i32 atoi_i32_##_name##_exact(const char *str, size_t len, char **endptr, atoi_result *res); \
+    extern u64 atoi_u64_##_name##_exact(const char *str, size_t len, char **endptr, atoi_result *res); \
+    extern i64 atoi_i64_##_name##_exact(const char *str, size_t len, char **endptr, atoi_result *res); \
+    atoi_exact_arr[atoi_exact_num].name = #_name "_exact"; \
+    atoi_exact_arr[atoi_exact_num].u32_func = atoi_u32_##_name##_exact; \
+    atoi_exact_arr[atoi_exact_num].i32_func = atoi_i32_##_name##_exact; \
+    atoi_exact_arr[atoi_exact_num].u64_func = atoi_u64_##_name##_exact; \
+    atoi_exact_arr[atoi_exact_num].i64_func = atoi_i64_##_name##_exact; \
+    if (atoi_group_name_max < (int)strlen(#_name "_exact")) atoi_group_name_max = (int)strlen(#_name "_exact"); \
+    atoi_exact_num++;
+    
+    register_exact_name(libcpp);
+    register_exact_name(jump);
+    register_exact_name(swar);
 }
 
 
 void benchmark(const char *output_path) {
     atoi_group_register_all();
     printf("------[verify]---------\n");
-    atoi_group_verify_all();
+    atoi_group_verify_all(atoi_group_arr + 1, atoi_group_num - 1, false); /* skip null */
+    atoi_group_verify_all(atoi_exact_arr, atoi_exact_num, true);
     printf("------[benchmark]------\n");
     atoi_group_benchmark_all(output_path);
     printf("------[finish]---------\n");
@@ -30,5 +30,15 @@ typedef int32_t (*atoi_i32_func)(const char *str, size_t len, char **endptr, ato
 typedef uint64_t (*atoi_u64_func)(const char *str, size_t len, char **endptr, atoi_result *res);
 typedef int64_t (*atoi_i64_func)(const char *str, size_t len, char **endptr, atoi_result *res);
 
+/**
+ Exact length contract (functions named with `_exact` suffix, same prototypes).
+ The `len` is the exact length of the number (as known by a tokenizer), not an
+ upper bound: the input is not terminated, and may be followed by other digits.
+ A leading zero followed by digits is fail, the `endptr` is `str + len` if the
+ result is suc or overflow.
+ The buffer should be padded, the function may read (but not use) up to 8 bytes
+ after `str + len`.
+ */
+
 
 #endif /* benchmark_h */
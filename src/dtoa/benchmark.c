@@ -5,7 +5,16 @@
 
 #include "benchmark_helper.h"
 #include "yybench.h"
+#include "bench_cpu.h"
+#include "bench_isolate.h"
+#include "bench_corun.h"
+#include "bench_sample.h"
+#include "bench_search.h"
+#include "bench_memo.h"
+#include "bench_direct.h"
+#include "dtoa_funcs.h"
 #include <inttypes.h>
+#include <float.h>
 
 #ifndef BENCHMARK_DATA_PATH
 extern const char *benchmark_get_data_path(void);
@@ -22,6 +31,16 @@ extern const char *benchmark_get_data_path(void);
  */
 typedef char *(*dtoa_func)(double val, char *buf);
 
+/**
+ A function prototype to convert an array of double to string, the numbers are
+ separated by ',' (such as a JSON array without brackets).
+ @param vals The double numbers.
+ @param count The number count.
+ @param buf A string buffer as least `count * 32 + 64` bytes.
+ @return The ending of this string (null-terminated).
+ */
+typedef char *(*dtoa_batch_func)(const double *vals, size_t count, char *buf);
+
 
 
 /*----------------------------------------------------------------------------*/
@@ -213,12 +232,40 @@ static yy_inline f64 rand_f64_subnormal(void) {
     return f;
 }
 
+/* worst-case inputs in data/worst_dtoa_*.txt, generated by search mode */
+static f64 *worst_vals = NULL;
+static int worst_count = 0;
+
+/** Get random worst-case double. */
+static yy_inline f64 rand_f64_worst(void) {
+    return worst_vals[yy_random32_uniform((u32)worst_count)];
+}
+
 /*----------------------------------------------------------------------------*/
 static int func_count = 0;
 static dtoa_func func_arr[128];
 static char *func_name_arr[128];
+static bench_isolate_func func_direct_arr[128]; /* see DTOA_DIRECT_MEASURE */
 static int func_name_max = 0;
 
+/* the functions which write hex-float string, such as `0x1.8p+3` */
+static int hex_func_count = 0;
+static dtoa_func hex_func_arr[128];
+static char *hex_func_name_arr[128];
+
+/* the functions which write the shortest digits of yy with an output style,
+   such as JavaScript or Python */
+static int fmt_func_count = 0;
+static dtoa_func fmt_func_arr[16];
+static char *fmt_func_name_arr[16];
+
+/* the functions which write an array of double, and the scalar functions to
+   compare with (called in a loop) */
+static int batch_func_count = 0;
+static dtoa_batch_func batch_func_arr[8];
+static char *batch_func_name_arr[8];
+static const char *batch_loop_name_arr[] = { "xjb_sse", "yy", "dragonbox" };
+
 // returns the function name aligned (inner memory)
 static char *get_name_aligned(const char *name, bool align_right) {
     static char buf[64];
@@ -237,13 +284,336 @@ static char *get_name_aligned(const char *name, bool align_right) {
 
 
 
+/*----------------------------------------------------------------------------*/
+
+/* returns the registered function with name, or NULL */
+static dtoa_func dtoa_func_find(const char *name) {
+    for (int i = 0; i < func_count; i++) {
+        if (strcmp(func_name_arr[i], name) == 0) return func_arr[i];
+    }
+    return NULL;
+}
+
+/* write an array of double with a scalar function, same as `dtoa_batch_func` */
+static char *dtoa_batch_loop(dtoa_func func, const f64 *vals, usize count, char *buf) {
+    char *cur = buf;
+    for (usize i = 0; i < count; i++) {
+        cur = func(vals[i], cur);
+        *cur++ = ',';
+    }
+    cur -= (count > 0);
+    *cur = '\0';
+    return cur;
+}
+
+
+
+/*----------------------------------------------------------------------------*/
+
+/* context of isolated measurement */
+typedef struct {
+    dtoa_func func;
+    int num;
+    int meansure_count;
+} dtoa_isolate_ctx;
+
+/* measure a function with input data at shifted address, returns min ticks */
+static u64 dtoa_isolate_measure(void *ctx, const void *data) {
+    dtoa_isolate_ctx *c = (dtoa_isolate_ctx *)ctx;
+    const f64 *vals = (const f64 *)data;
+    char buf[64];
+    u64 ticks_min = UINT64_MAX;
+    for (int r = 0; r < c->meansure_count; r++) {
+        u64 t1 = yy_time_get_ticks();
+        for (int v = 0; v < c->num; v++) {
+            c->func(vals[v], buf);
+        }
+        u64 t2 = yy_time_get_ticks();
+        u64 t = t2 - t1;
+        if (t < ticks_min) ticks_min = t;
+    }
+    return ticks_min;
+}
+
+
+
+/*----------------------------------------------------------------------------*/
+
+/* the loop of direct-call measurement, `call` is a function pointer or name,
+   the output is kept alive, as an inlined call may be removed otherwise */
+#define DTOA_DIRECT_LOOP(call) \
+    dtoa_isolate_ctx *c = (dtoa_isolate_ctx *)ctx; \
+    const f64 *vals = (const f64 *)data; \
+    char buf[64]; \
+    u64 ticks_min = UINT64_MAX; \
+    for (int r = 0; r < c->meansure_count; r++) { \
+        u64 t1 = yy_time_get_ticks(); \
+        for (int v = 0; v < c->num; v++) { \
+            call(vals[v], buf); \
+            bench_direct_escape(buf); \
+        } \
+        u64 t2 = yy_time_get_ticks(); \
+        u64 t = t2 - t1; \
+        if (t < ticks_min) ticks_min = t; \
+    } \
+    return ticks_min;
+
+/* measure a function through the pointer in context, returns min ticks */
+static u64 dtoa_indirect_measure(void *ctx, const void *data) {
+    DTOA_DIRECT_LOOP(c->func)
+}
+
+/* measure a function by name, returns min ticks */
+#define DTOA_DIRECT_MEASURE(name) \
+extern char *dtoa_##name(double val, char *buf); \
+static u64 dtoa_direct_measure_##name(void *ctx, const void *data) { \
+    DTOA_DIRECT_LOOP(dtoa_##name) \
+}
+
+/* one for each function in `dtoa_func_register_all()` */
+DTOA_DIRECT_MEASURE(null)
+DTOA_FUNC_LIST(DTOA_DIRECT_MEASURE)
+
+
+
+/*----------------------------------------------------------------------------*/
+
+/* memoization: distinct numbers in the pool, numbers of each thread, sets of
+   the cache (4 ways, 16K entries), the pool is larger than the cache */
+#define DTOA_MEMO_POOL_COUNT 262144
+#define DTOA_MEMO_NUM 100000
+#define DTOA_MEMO_SET_COUNT 4096
+
+/* the functions used with the cache */
+static const char *memo_name_arr[] = { "yy", "grisu3", "david_gay" };
+
+/* thread counts of the memoization benchmark (limited by core count) */
+static const u32 memo_thread_arr[] = { 1, 2, 4, 8, 16 };
+
+/* context of memoization threads */
+typedef struct {
+    dtoa_func func;
+    dtoa_func expect;           /* not NULL to verify the output */
+    bench_memo *memo;           /* NULL to call the function directly */
+    const f64 *vals;            /* `num` numbers for each thread */
+    u32 num;
+    u32 errors[BENCH_MEMO_THREAD_MAX];
+    bench_memo_stats stats[BENCH_MEMO_THREAD_MAX];
+} dtoa_memo_ctx;
+
+/* convert a number with the cache in front of the function */
+static yy_inline char *dtoa_memo(bench_memo *memo, dtoa_func func,
+                                 f64 val, char *buf, bench_memo_stats *stats) {
+    u64 key = f64_to_u64_raw(val);
+    usize len = bench_memo_get(memo, key, buf, stats);
+    if (len) return buf + len;
+    char *end = func(val, buf);
+    bench_memo_put(memo, key, buf, (usize)(end - buf), stats);
+    return end;
+}
+
+static void dtoa_memo_thread(void *ctx, u32 idx) {
+    dtoa_memo_ctx *c = (dtoa_memo_ctx *)ctx;
+    const f64 *vals = c->vals + (usize)idx * c->num;
+    bench_memo_stats stats = c->stats[idx];
+    char buf[64], buf_e[64];
+    
+    if (c->expect) {
+        u32 errors = 0;
+        for (u32 i = 0; i < c->num; i++) {
+            char *end = dtoa_memo(c->memo, c->func, vals[i], buf, &stats);
+            char *end_e = c->expect(vals[i], buf_e);
+            if (end - buf != end_e - buf_e || strcmp(buf, buf_e) != 0) errors++;
+        }
+        c->errors[idx] = errors;
+    } else if (c->memo) {
+        for (u32 i = 0; i < c->num; i++) {
+            dtoa_memo(c->memo, c->func, vals[i], buf, &stats);
+        }
+    } else {
+        for (u32 i = 0; i < c->num; i++) {
+            c->func(vals[i], buf);
+        }
+    }
+    c->stats[idx] = stats;
+}
+
+/* fill `count` numbers of a value pool with Zipf distribution */
+static void dtoa_memo_fill(f64 *vals, usize count, f64 s) {
+    f64 *pool = malloc(DTOA_MEMO_POOL_COUNT * sizeof(f64));
+    u32 *idx = malloc(count * sizeof(u32));
+    for (int i = 0; i < DTOA_MEMO_POOL_COUNT; i++) {
+        pool[i] = rand_f64_len((int)yy_random32_range(1, 17));
+    }
+    bench_memo_fill_zipf(idx, count, DTOA_MEMO_POOL_COUNT, s);
+    for (usize i = 0; i < count; i++) vals[i] = pool[idx[i]];
+    free(pool);
+    free(idx);
+}
+
+/**
+ Verify the cache: several threads share a small cache (many evictions and
+ concurrent writes), the output should be the same as the function.
+ */
+static void dtoa_memo_verify(void) {
+    u32 thread_num = 4, num = 100000;
+    dtoa_memo_ctx ctx = { 0 };
+    f64 *vals = malloc((usize)thread_num * num * sizeof(f64));
+    bench_memo *memo = bench_memo_new(16);
+    
+    printf("verify memo ");
+    ctx.func = dtoa_func_find("yy");
+    ctx.expect = ctx.func;
+    ctx.memo = memo;
+    ctx.vals = vals;
+    ctx.num = num;
+    if (!ctx.func || !vals || !memo) {
+        printf(" [ERROR]\n");
+    } else {
+        yy_random_reset();
+        dtoa_memo_fill(vals, (usize)thread_num * num, 1.0);
+        u32 errors = 0;
+        if (!bench_memo_run_threads(thread_num, dtoa_memo_thread, &ctx)) errors++;
+        for (u32 t = 0; t < thread_num; t++) {
+            errors += ctx.errors[t];
+            bench_memo_add_stats(memo, &ctx.stats[t]);
+        }
+        bench_memo_stats stats;
+        bench_memo_get_stats(memo, &stats);
+        printf("(yy, %u threads, hit %.1f%%) %s\n", thread_num,
+               bench_memo_stats_get_hit_rate(&stats) * 100.0,
+               errors ? "[not_match]" : "[OK]");
+    }
+    bench_memo_free(memo);
+    free(vals);
+}
+
+/**
+ Measure the functions with and without the cache on Zipf datasets, with
+ several thread counts, one line chart for each dataset.
+ */
+static void dtoa_memo_benchmark(yy_report *report, int meansure_count) {
+    typedef struct {
+        const char *name;
+        const char *desc;
+        f64 s;
+    } memo_dataset;
+    memo_dataset dataset_arr[] = {
+        { "memo (zipf s=1.2)", "262144 distinct numbers (random length), Zipf distribution s=1.2 (hot)", 1.2 },
+        { "memo (zipf s=1.0)", "262144 distinct numbers (random length), Zipf distribution s=1.0", 1.0 },
+        { "memo (zipf s=0.8)", "262144 distinct numbers (random length), Zipf distribution s=0.8", 0.8 },
+        { "memo (uniform)", "262144 distinct numbers (random length), uniform distribution (cold)", 0.0 },
+    };
+    
+    /* thread counts up to the core count */
+    const char *categories[16];
+    char category_bufs[16][32];
+    u32 thread_arr[16], thread_count = 0, core_count = bench_memo_get_core_count();
+    for (u32 i = 0; i < sizeof(memo_thread_arr) / sizeof(u32); i++) {
+        u32 t = memo_thread_arr[i];
+        if (t > 1 && t > core_count) break;
+        snprintf(category_bufs[thread_count], 32, "%u thread%s", t, t > 1 ? "s" : "");
+        categories[thread_count] = category_bufs[thread_count];
+        thread_arr[thread_count++] = t;
+    }
+    categories[thread_count] = NULL;
+    
+    u32 num = DTOA_MEMO_NUM;
+    u32 max_threads = thread_arr[thread_count - 1];
+    f64 *vals = malloc((usize)max_threads * num * sizeof(f64));
+    bench_memo *memo = bench_memo_new(DTOA_MEMO_SET_COUNT);
+    if (!vals || !memo) {
+        printf("[memo buffer creation failed]");
+        free(vals);
+        bench_memo_free(memo);
+        return;
+    }
+    
+    for (int d = 0; d < (int)(sizeof(dataset_arr) / sizeof(memo_dataset)); d++) {
+        memo_dataset dataset = dataset_arr[d];
+        printf("run benchmark %s...", dataset.name);
+        yy_random_reset();
+        dtoa_memo_fill(vals, (usize)max_threads * num, dataset.s);
+        
+        yy_chart *chart = yy_chart_new();
+        yy_chart_options op;
+        yy_chart_options_init(&op);
+        op.title = dataset.name;
+        op.subtitle = dataset.desc;
+        op.type = YY_CHART_LINE;
+        op.v_axis.title = "CPU cycles per number (wall time)";
+        op.h_axis.title = "thread count";
+        op.h_axis.categories = categories;
+        op.tooltip.value_decimals = 2;
+        op.tooltip.shared = true;
+        op.tooltip.crosshairs = true;
+        op.width = 800;
+        op.height = 540;
+        yy_chart_set_options(chart, &op);
+        
+        int func_num = (int)(sizeof(memo_name_arr) / sizeof(memo_name_arr[0]));
+        for (int f = 0; f < func_num * 2; f++) {
+            dtoa_memo_ctx ctx = { 0 };
+            bool use_memo = (f % 2) == 1;
+            const char *func_name = memo_name_arr[f / 2];
+            ctx.func = dtoa_func_find(func_name);
+            ctx.memo = use_memo ? memo : NULL;
+            ctx.vals = vals;
+            ctx.num = num;
+            if (!ctx.func) continue;
+            
+            bench_memo_stats sum = { 0 };
+            f32 cycles_arr[16];
+            for (u32 t = 0; t < thread_count; t++) {
+                u32 thread_num = thread_arr[t];
+                u64 ticks_min;
+                bench_memo_clear(memo);
+                bench_memo_run_threads(thread_num, dtoa_memo_thread, &ctx); /* warm up */
+                memset(ctx.stats, 0, sizeof(ctx.stats));
+                for (int retry = 0; ; retry++) {
+                    ticks_min = UINT64_MAX;
+                    for (int r = 0; r < meansure_count; r++) {
+                        u64 ticks = bench_memo_run_threads(thread_num, dtoa_memo_thread, &ctx);
+                        if (ticks && ticks < ticks_min) ticks_min = ticks;
+                    }
+                    if (bench_cpu_check_freq(retry)) break;
+                }
+                for (u32 i = 0; i < thread_num; i++) {
+                    sum.hit += ctx.stats[i].hit;
+                    sum.miss += ctx.stats[i].miss;
+                }
+                cycles_arr[t] = (f32)((f64)ticks_min / num * bench_cpu_get_cycle_per_tick());
+            }
+            
+            char name[64];
+            if (use_memo) {
+                snprintf(name, sizeof(name), "%s (memo, hit %.1f%%)", func_name,
+                         bench_memo_stats_get_hit_rate(&sum) * 100.0);
+            } else {
+                snprintf(name, sizeof(name), "%s", func_name);
+            }
+            yy_chart_item_begin(chart, name);
+            for (u32 t = 0; t < thread_count; t++) {
+                yy_chart_item_add_float(chart, cycles_arr[t]);
+            }
+            yy_chart_item_end(chart);
+        }
+        yy_report_add_chart(report, chart);
+        yy_chart_free(chart);
+        
+        printf("[OK]\n");
+    }
+    free(vals);
+    bench_memo_free(memo);
+}
+
+
+
 /*----------------------------------------------------------------------------*/
 
 static void dtoa_func_benchmark_all(const char *output_path) {
     printf("initialize...\n");
-    yy_cpu_setup_priority();
-    yy_cpu_spin(1.0);
-    yy_cpu_measure_freq();
+    bench_cpu_setup();
     
     
     int num_per_case = 10000;
@@ -320,10 +690,31 @@ static void dtoa_func_benchmark_all(const char *output_path) {
         rand_f64_from_f32, false
     };
     
+    /* worst-case inputs found by search mode (-w), if exists */
+    char data_path[YY_MAX_PATH];
+    yy_path_combine(data_path, BENCHMARK_DATA_PATH, "data", NULL);
+    int worst_line_count = 0;
+    char **worst_lines = bench_search_read_lines(data_path, "worst_dtoa_", &worst_line_count);
+    if (worst_line_count) {
+        worst_vals = malloc(worst_line_count * sizeof(f64));
+        for (int i = 0; i < worst_line_count; i++) {
+            f64 val = strtod(worst_lines[i], NULL);
+            if (isfinite(val)) worst_vals[worst_count++] = val;
+        }
+    }
+    bench_search_free_lines(worst_lines, worst_line_count);
+    if (worst_count) {
+        dataset_arr[dataset_num++] = (dataset_t) {
+            "worst case",
+            "slow inputs of each function found by search, in data/worst_dtoa_*.txt",
+            rand_f64_worst, false
+        };
+    }
+    
     char buf[64];
     f64 *vals = malloc(num_per_case * sizeof(f64));
     yy_report *report = yy_report_new();
-    yy_report_add_env_info(report);
+    bench_report_add_env_info(report);
     
     for (int d = 0; d < dataset_num; d++) {
         dataset_t dataset = dataset_arr[d];
@@ -359,18 +750,22 @@ static void dtoa_func_benchmark_all(const char *output_path) {
                         vals[i] = ((fill_len_func)dataset.fill_func)(len);
                     }
                     
-                    u64 ticks_min = UINT64_MAX;
-                    for (int r = 0; r < meansure_count; r++) {
-                        u64 t1 = yy_time_get_ticks();
-                        for (int v = 0; v < num_per_case; v++) {
-                            f64 val = vals[v];
-                            func(val, buf);
+                    u64 ticks_min;
+                    for (int retry = 0; ; retry++) {
+                        ticks_min = UINT64_MAX;
+                        for (int r = 0; r < meansure_count; r++) {
+                            u64 t1 = yy_time_get_ticks();
+                            for (int v = 0; v < num_per_case; v++) {
+                                f64 val = vals[v];
+                                func(val, buf);
+                            }
+                            u64 t2 = yy_time_get_ticks();
+                            u64 t = t2 - t1;
+                            if (t < ticks_min) ticks_min = t;
                         }
-                        u64 t2 = yy_time_get_ticks();
-                        u64 t = t2 - t1;
-                        if (t < ticks_min) ticks_min = t;
+                        if (bench_cpu_check_freq(retry)) break;
                     }
-                    f64 cycle = (f64)ticks_min / (f64)num_per_case * yy_cpu_get_cycle_per_tick();
+                    f64 cycle = (f64)ticks_min / (f64)num_per_case * bench_cpu_get_cycle_per_tick();
                     yy_chart_item_add_float(chart, (f32)cycle);
                 }
                 
@@ -405,7 +800,74 @@ static void dtoa_func_benchmark_all(const char *output_path) {
             for (int f = 0; f < func_count; f++) {
                 const char *func_name = func_name_arr[f];
                 dtoa_func func = func_arr[f];
-                u64 ticks_min = UINT64_MAX;
+                u64 ticks_min;
+                for (int retry = 0; ; retry++) {
+                    ticks_min = UINT64_MAX;
+                    for (int r = 0; r < meansure_count; r++) {
+                        u64 t1 = yy_time_get_ticks();
+                        for (int v = 0; v < num_per_case; v++) {
+                            f64 val = vals[v];
+                            func(val, buf);
+                        }
+                        u64 t2 = yy_time_get_ticks();
+                        u64 t = t2 - t1;
+                        if (t < ticks_min) ticks_min = t;
+                    }
+                    if (bench_cpu_check_freq(retry)) break;
+                }
+                f64 cycle = (f64)ticks_min / (f64)num_per_case * bench_cpu_get_cycle_per_tick();
+                yy_chart_item_with_float(chart, func_name, (f32)cycle);
+                
+            }
+        }
+        yy_chart_sort_items_with_value(chart, false);
+        yy_chart_set_options(chart, &op);
+        yy_report_add_chart(report, chart);
+        yy_chart_free(chart);
+        
+        printf("[OK]\n");
+    }
+    
+    /* hex-float: such as `0x1.8p+3`, only the hex functions are used */
+    dataset_t hex_dataset_arr[] = {
+        { "hex (random)", "random double number in all binary range, written as hex-float", rand_f64, false },
+        { "hex (nomalized)", "random double number in range 0.0 to 1.0, written as hex-float", rand_f64_normalize, false },
+        { "hex (integer)", "random double number from integer, written as hex-float", rand_f64_integer, false },
+        { "hex (subnormal)", "random subnormal double number, written as hex-float", rand_f64_subnormal, false },
+        { "hex (float)", "random float number, written as hex-float", rand_f64_from_f32, false },
+    };
+    for (int d = 0; d < (int)(sizeof(hex_dataset_arr) / sizeof(dataset_t)); d++) {
+        dataset_t dataset = hex_dataset_arr[d];
+        printf("run benchmark %s...", dataset.name);
+        
+        yy_chart *chart = yy_chart_new();
+        yy_chart_options op;
+        yy_chart_options_init(&op);
+        op.title = dataset.name;
+        op.subtitle = dataset.desc;
+        op.type = YY_CHART_BAR;
+        op.h_axis.title = "CPU cycles";
+        op.plot.value_labels_enabled = true;
+        op.plot.value_labels_decimals = 2;
+        op.plot.color_by_point = true;
+        op.plot.group_padding = 0.0f;
+        op.plot.point_padding = 0.1f;
+        op.plot.border_width = 0.0f;
+        op.legend.enabled = false;
+        op.tooltip.value_decimals = 2;
+        op.width = 640;
+        op.height = 420;
+        
+        yy_random_reset();
+        for (int i = 0; i < num_per_case; i++) {
+            vals[i] = ((fill_func)dataset.fill_func)();
+        }
+        
+        for (int f = 0; f < hex_func_count; f++) {
+            dtoa_func func = hex_func_arr[f];
+            u64 ticks_min;
+            for (int retry = 0; ; retry++) {
+                ticks_min = UINT64_MAX;
                 for (int r = 0; r < meansure_count; r++) {
                     u64 t1 = yy_time_get_ticks();
                     for (int v = 0; v < num_per_case; v++) {
@@ -416,10 +878,288 @@ static void dtoa_func_benchmark_all(const char *output_path) {
                     u64 t = t2 - t1;
                     if (t < ticks_min) ticks_min = t;
                 }
-                f64 cycle = (f64)ticks_min / (f64)num_per_case * yy_cpu_get_cycle_per_tick();
-                yy_chart_item_with_float(chart, func_name, (f32)cycle);
-                
+                if (bench_cpu_check_freq(retry)) break;
+            }
+            f64 cycle = (f64)ticks_min / (f64)num_per_case * bench_cpu_get_cycle_per_tick();
+            yy_chart_item_with_float(chart, hex_func_name_arr[f], (f32)cycle);
+        }
+        yy_chart_sort_items_with_value(chart, false);
+        yy_chart_set_options(chart, &op);
+        yy_report_add_chart(report, chart);
+        yy_chart_free(chart);
+        
+        printf("[OK]\n");
+    }
+    
+    /* output style: the same digits written as yy, JavaScript, Python... */
+    dataset_t fmt_dataset_arr[] = {
+        { "format (random)", "random double number in all binary range, written with styles", rand_f64, false },
+        { "format (integer)", "random double number from integer (random len), written with styles", rand_f64_integer_len, true, true },
+        { "format (nomalized)", "random double number in range 0.0 to 1.0 (random len), written with styles", rand_f64_normalize_len, true, true },
+    };
+    for (int d = 0; d < (int)(sizeof(fmt_dataset_arr) / sizeof(dataset_t)); d++) {
+        dataset_t dataset = fmt_dataset_arr[d];
+        printf("run benchmark %s...", dataset.name);
+        
+        yy_chart *chart = yy_chart_new();
+        yy_chart_options op;
+        yy_chart_options_init(&op);
+        op.title = dataset.name;
+        op.subtitle = dataset.desc;
+        op.type = YY_CHART_BAR;
+        op.h_axis.title = "CPU cycles";
+        op.plot.value_labels_enabled = true;
+        op.plot.value_labels_decimals = 2;
+        op.plot.color_by_point = true;
+        op.plot.group_padding = 0.0f;
+        op.plot.point_padding = 0.1f;
+        op.plot.border_width = 0.0f;
+        op.legend.enabled = false;
+        op.tooltip.value_decimals = 2;
+        op.width = 640;
+        op.height = 420;
+        
+        yy_random_reset();
+        for (int i = 0; i < num_per_case; i++) {
+            if (dataset.func_has_len) {
+                vals[i] = ((fill_len_func)dataset.fill_func)((int)yy_random32_range(1, 17));
+            } else {
+                vals[i] = ((fill_func)dataset.fill_func)();
+            }
+        }
+        
+        /* yy is the baseline (the same digits without style) */
+        for (int f = -1; f < fmt_func_count; f++) {
+            dtoa_func func = f < 0 ? dtoa_func_find("yy") : fmt_func_arr[f];
+            const char *func_name = f < 0 ? "yy" : fmt_func_name_arr[f];
+            if (!func) continue;
+            u64 ticks_min;
+            for (int retry = 0; ; retry++) {
+                ticks_min = UINT64_MAX;
+                for (int r = 0; r < meansure_count; r++) {
+                    u64 t1 = yy_time_get_ticks();
+                    for (int v = 0; v < num_per_case; v++) {
+                        f64 val = vals[v];
+                        func(val, buf);
+                    }
+                    u64 t2 = yy_time_get_ticks();
+                    u64 t = t2 - t1;
+                    if (t < ticks_min) ticks_min = t;
+                }
+                if (bench_cpu_check_freq(retry)) break;
+            }
+            f64 cycle = (f64)ticks_min / (f64)num_per_case * bench_cpu_get_cycle_per_tick();
+            yy_chart_item_with_float(chart, func_name, (f32)cycle);
+        }
+        yy_chart_sort_items_with_value(chart, false);
+        yy_chart_set_options(chart, &op);
+        yy_report_add_chart(report, chart);
+        yy_chart_free(chart);
+        
+        printf("[OK]\n");
+    }
+    
+    /* integer ratio: integer-valued doubles mixed with other doubles */
+    {
+        printf("run benchmark integer ratio...");
+        
+        yy_chart *chart = yy_chart_new();
+        yy_chart_options op;
+        yy_chart_options_init(&op);
+        op.title = "integer ratio";
+        op.subtitle = "random integers (random len) mixed with random doubles (random len), by the ratio of integers";
+        op.type = YY_CHART_LINE;
+        op.v_axis.title = "average CPU cycles";
+        op.h_axis.title = "integer ratio (%)";
+        op.h_axis.tick_interval = 10;
+        op.plot.point_start = 0;
+        op.plot.point_interval = 10;
+        op.tooltip.value_decimals = 2;
+        op.tooltip.shared = true;
+        op.tooltip.crosshairs = true;
+        op.width = 800;
+        op.height = 540;
+        
+        /* the same random numbers for each ratio, only the mix is changed */
+        f64 *int_vals = malloc(num_per_case * sizeof(f64));
+        f64 *dec_vals = malloc(num_per_case * sizeof(f64));
+        u32 *mix_vals = malloc(num_per_case * sizeof(u32));
+        yy_random_reset();
+        for (int i = 0; i < num_per_case; i++) {
+            int_vals[i] = rand_f64_integer_len((int)yy_random32_range(1, 16));
+            dec_vals[i] = rand_f64_len((int)yy_random32_range(1, 17));
+            mix_vals[i] = yy_random32_uniform(100);
+        }
+        
+        for (int f = 0; f < func_count; f++) {
+            dtoa_func func = func_arr[f];
+            yy_chart_item_begin(chart, func_name_arr[f]);
+            for (u32 ratio = 0; ratio <= 100; ratio += 10) {
+                for (int i = 0; i < num_per_case; i++) {
+                    vals[i] = mix_vals[i] < ratio ? int_vals[i] : dec_vals[i];
+                }
+                u64 ticks_min;
+                for (int retry = 0; ; retry++) {
+                    ticks_min = UINT64_MAX;
+                    for (int r = 0; r < meansure_count; r++) {
+                        u64 t1 = yy_time_get_ticks();
+                        for (int v = 0; v < num_per_case; v++) {
+                            f64 val = vals[v];
+                            func(val, buf);
+                        }
+                        u64 t2 = yy_time_get_ticks();
+                        u64 t = t2 - t1;
+                        if (t < ticks_min) ticks_min = t;
+                    }
+                    if (bench_cpu_check_freq(retry)) break;
+                }
+                f64 cycle = (f64)ticks_min / (f64)num_per_case * bench_cpu_get_cycle_per_tick();
+                yy_chart_item_add_float(chart, (f32)cycle);
+            }
+            yy_chart_item_end(chart);
+        }
+        yy_chart_set_options(chart, &op);
+        yy_report_add_chart(report, chart);
+        yy_chart_free(chart);
+        free(int_vals);
+        free(dec_vals);
+        free(mix_vals);
+        
+        printf("[OK]\n");
+    }
+    
+    /* batch: write the whole array into a packed buffer, compared with scalar
+       functions called in a loop, one bar group for each dataset */
+    if (batch_func_count) {
+        printf("run benchmark batch...");
+        
+        const char *categories[64];
+        int category_num = 0;
+        f64 *batch_vals[64];
+        for (int d = 0; d < dataset_num; d++) {
+            dataset_t dataset = dataset_arr[d];
+            if (dataset.func_has_len && !dataset.use_random_len) continue;
+            f64 *arr = malloc(num_per_case * sizeof(f64));
+            yy_random_reset();
+            for (int i = 0; i < num_per_case; i++) {
+                if (dataset.func_has_len) {
+                    arr[i] = ((fill_len_func)dataset.fill_func)((int)yy_random32_range(1, 17));
+                } else {
+                    arr[i] = ((fill_func)dataset.fill_func)();
+                }
             }
+            batch_vals[category_num] = arr;
+            categories[category_num++] = dataset.name;
+        }
+        categories[category_num] = NULL;
+        
+        yy_chart *chart = yy_chart_new();
+        yy_chart_options op;
+        yy_chart_options_init(&op);
+        op.title = "batch (packed array)";
+        op.subtitle = "write the array separated by ',', batch functions and scalar functions in a loop";
+        op.type = YY_CHART_BAR;
+        op.h_axis.title = "CPU cycles per number";
+        op.v_axis.categories = categories;
+        op.plot.value_labels_enabled = true;
+        op.plot.value_labels_decimals = 2;
+        op.plot.group_padding = 0.1f;
+        op.plot.point_padding = 0.0f;
+        op.plot.border_width = 0.0f;
+        op.tooltip.value_decimals = 2;
+        op.tooltip.shared = true;
+        op.width = 800;
+        op.height = 150 + category_num * 90;
+        yy_chart_set_options(chart, &op);
+        
+        char *batch_buf = malloc(num_per_case * 32 + 64);
+        int loop_num = (int)(sizeof(batch_loop_name_arr) / sizeof(batch_loop_name_arr[0]));
+        for (int f = 0; f < batch_func_count + loop_num; f++) {
+            bool is_batch = f < batch_func_count;
+            dtoa_func func = NULL;
+            char name[64];
+            if (is_batch) {
+                snprintf(name, sizeof(name), "%s", batch_func_name_arr[f]);
+            } else {
+                const char *loop_name = batch_loop_name_arr[f - batch_func_count];
+                func = dtoa_func_find(loop_name);
+                if (!func) continue;
+                snprintf(name, sizeof(name), "%s (loop)", loop_name);
+            }
+            yy_chart_item_begin(chart, name);
+            for (int c = 0; c < category_num; c++) {
+                u64 ticks_min;
+                for (int retry = 0; ; retry++) {
+                    ticks_min = UINT64_MAX;
+                    for (int r = 0; r < meansure_count; r++) {
+                        u64 t1 = yy_time_get_ticks();
+                        if (is_batch) {
+                            batch_func_arr[f](batch_vals[c], num_per_case, batch_buf);
+                        } else {
+                            dtoa_batch_loop(func, batch_vals[c], num_per_case, batch_buf);
+                        }
+                        u64 t2 = yy_time_get_ticks();
+                        u64 t = t2 - t1;
+                        if (t < ticks_min) ticks_min = t;
+                    }
+                    if (bench_cpu_check_freq(retry)) break;
+                }
+                f64 cycle = (f64)ticks_min / (f64)num_per_case * bench_cpu_get_cycle_per_tick();
+                yy_chart_item_add_float(chart, (f32)cycle);
+            }
+            yy_chart_item_end(chart);
+        }
+        yy_report_add_chart(report, chart);
+        yy_chart_free(chart);
+        free(batch_buf);
+        for (int c = 0; c < category_num; c++) free(batch_vals[c]);
+        
+        printf("[OK]\n");
+    }
+    
+    /* memoization: a shared cache in front of the functions (zipf datasets) */
+    dtoa_memo_benchmark(report, meansure_count / 4);
+    
+    /* isolated mode: run each function with several stack/heap offsets */
+    if (bench_isolate_get_variants()) {
+        printf("run benchmark random (stack/heap offset spread)...");
+        
+        yy_chart *chart = yy_chart_new();
+        yy_chart_options op;
+        yy_chart_options_init(&op);
+        op.title = "random (stack/heap offset spread)";
+        op.subtitle = "median of stack/heap offset variants, spread: (max - min) / median";
+        op.type = YY_CHART_BAR;
+        op.h_axis.title = "CPU cycles";
+        op.plot.value_labels_enabled = true;
+        op.plot.value_labels_decimals = 2;
+        op.plot.color_by_point = true;
+        op.plot.group_padding = 0.0f;
+        op.plot.point_padding = 0.1f;
+        op.plot.border_width = 0.0f;
+        op.legend.enabled = false;
+        op.tooltip.value_decimals = 2;
+        op.width = 640;
+        op.height = 420;
+        
+        yy_random_reset();
+        for (int i = 0; i < num_per_case; i++) {
+            vals[i] = rand_f64();
+        }
+        
+        for (int f = 0; f < func_count; f++) {
+            dtoa_isolate_ctx ctx = { func_arr[f], num_per_case, meansure_count };
+            bench_spread spread;
+            char name[128];
+            if (!bench_isolate_run(dtoa_isolate_measure, &ctx, vals,
+                                   num_per_case * sizeof(f64), &spread)) {
+                printf("[isolated run failed: %s]", func_name_arr[f]);
+                continue;
+            }
+            f64 cycle = (f64)spread.ticks_med / (f64)num_per_case * bench_cpu_get_cycle_per_tick();
+            snprintf(name, sizeof(name), "%s (spread %.1f%%)",
+                     func_name_arr[f], bench_spread_get_percent(&spread));
+            yy_chart_item_with_float(chart, name, (f32)cycle);
         }
         yy_chart_sort_items_with_value(chart, false);
         yy_chart_set_options(chart, &op);
@@ -429,13 +1169,165 @@ static void dtoa_func_benchmark_all(const char *output_path) {
         printf("[OK]\n");
     }
     
+    /* adaptive sampling mode: run each function with several dataset seeds */
+    if (bench_sample_get_seeds()) {
+        printf("run benchmark random (adaptive sampling)...");
+        
+        yy_chart *chart = bench_sample_chart_new("random (adaptive sampling)");
+        int seed_count = bench_sample_get_seeds();
+        
+        for (int f = 0; f < func_count; f++) {
+            dtoa_isolate_ctx ctx = { func_arr[f], num_per_case, 1 }; /* one sample per call */
+            bench_sample res[BENCH_SAMPLE_SEED_MAX];
+            for (int seed = 0; seed < seed_count; seed++) {
+                bench_sample_seed(seed);
+                for (int i = 0; i < num_per_case; i++) {
+                    vals[i] = rand_f64();
+                }
+                bench_sample_run(dtoa_isolate_measure, &ctx, vals, &res[seed]);
+            }
+            bench_sample_chart_add(chart, func_name_arr[f], res, seed_count,
+                                   (usize)num_per_case);
+        }
+        yy_chart_sort_items_with_value(chart, false);
+        yy_report_add_chart(report, chart);
+        yy_chart_free(chart);
+        bench_report_add_sample_info(report);
+        
+        printf("[OK]\n");
+    }
+    
+    /* direct-call mode: run each function with a loop calling it by name */
+    if (bench_direct_get_enabled()) {
+        printf("run benchmark random (direct call)...");
+        
+        const char *names[128];
+        bench_direct res[128], base = { 0 };
+        int count = 0;
+        
+        yy_random_reset();
+        for (int i = 0; i < num_per_case; i++) {
+            vals[i] = rand_f64();
+        }
+        
+        for (int f = 0; f < func_count; f++) {
+            dtoa_isolate_ctx ctx = { func_arr[f], num_per_case, meansure_count };
+            bench_direct cur;
+            bench_direct_run(dtoa_indirect_measure, func_direct_arr[f], &ctx, vals, &cur);
+            if (strcmp(func_name_arr[f], "null") == 0) {
+                base = cur; /* the loop overhead */
+            } else {
+                names[count] = func_name_arr[f];
+                res[count++] = cur;
+            }
+        }
+        yy_chart *chart = bench_direct_chart_new("random (direct call)", names, res,
+                                                 count, &base, (usize)num_per_case);
+        yy_report_add_chart(report, chart);
+        yy_chart_free(chart);
+        bench_report_add_direct_info(report);
+        
+        printf("[OK]\n");
+    }
+
+    /* co-run mode: run each function with an antagonist on the sibling core */
+    if (bench_corun_start()) {
+        printf("run benchmark random (co-runner slowdown)...");
+        
+        yy_chart *chart = bench_corun_chart_new("random (co-runner slowdown)");
+        
+        yy_random_reset();
+        for (int i = 0; i < num_per_case; i++) {
+            vals[i] = rand_f64();
+        }
+        
+        for (int f = 0; f < func_count; f++) {
+            dtoa_isolate_ctx ctx = { func_arr[f], num_per_case, meansure_count };
+            u64 ticks_alone, ticks_corun;
+            bench_corun_run(dtoa_isolate_measure, &ctx, vals, &ticks_alone, &ticks_corun);
+            bench_corun_chart_add(chart, func_name_arr[f], ticks_alone, ticks_corun,
+                                  (usize)num_per_case);
+        }
+        yy_chart_sort_items_with_value(chart, false);
+        yy_report_add_chart(report, chart);
+        yy_chart_free(chart);
+        bench_report_add_corun_info(report);
+        bench_corun_stop();
+        
+        printf("[OK]\n");
+    }
+    
     // export report to html
+    bench_report_add_drift_info(report);
     bool suc = yy_report_write_html_file(report, output_path);
     if (!suc) {
         printf("write report file failed: %s\n", output_path);
     }
     yy_report_free(report);
     free(vals);
+    free(worst_vals);
+    worst_vals = NULL;
+    worst_count = 0;
+}
+
+
+
+/*----------------------------------------------------------------------------*/
+
+/* context of worst-case search */
+typedef struct {
+    dtoa_func func;
+} dtoa_search_ctx;
+
+/* measure one input, returns 0 if the input is nan or inf */
+static u64 dtoa_search_measure(void *ctx, const char *input, usize len) {
+    dtoa_func func = ((dtoa_search_ctx *)ctx)->func;
+    char buf[64];
+    f64 val;
+    if (len != sizeof(f64)) return 0;
+    memcpy(&val, input, sizeof(f64));
+    if (!isfinite(val)) return 0;
+    
+    u64 t1 = yy_time_get_ticks();
+    for (int i = 0; i < BENCH_SEARCH_CALLS; i++) {
+        func(val, buf);
+    }
+    u64 t2 = yy_time_get_ticks();
+    return t2 > t1 ? t2 - t1 : 1;
+}
+
+/* search the slow inputs of a function, seeded with the test data */
+static void dtoa_func_search(const char *name, const char *output_path) {
+    dtoa_search_ctx ctx = { NULL };
+    for (int f = 0; f < func_count; f++) {
+        if (strcmp(func_name_arr[f], name) == 0) ctx.func = func_arr[f];
+    }
+    if (!ctx.func) {
+        printf("[ERROR] unknown function: %s, available:", name);
+        for (int f = 0; f < func_count; f++) printf(" %s", func_name_arr[f]);
+        printf("\n");
+        return;
+    }
+    
+    printf("initialize...\n");
+    bench_cpu_setup();
+    
+    char data_path[YY_MAX_PATH];
+    yy_path_combine(data_path, BENCHMARK_DATA_PATH, "data", NULL);
+    int seed_count = 0;
+    char **seeds = bench_search_read_lines(data_path, "real_pass", &seed_count);
+    
+    char title[128];
+    snprintf(title, sizeof(title), "dtoa %s", name);
+    bench_search_options op = { 0 };
+    op.name = title;
+    op.kind = BENCH_SEARCH_F64;
+    op.measure = dtoa_search_measure;
+    op.ctx = &ctx;
+    op.seeds = (const char **)seeds;
+    op.seed_count = seed_count;
+    bench_search_run(&op, output_path);
+    bench_search_free_lines(seeds, seed_count);
 }
 
 static void dtoa_func_verify_all(void) {
@@ -540,9 +1432,222 @@ static void dtoa_func_verify_all(void) {
     }
 }
 
+/**
+ Verify the hex-float writers: the output is an exact representation of the
+ value, so it should be read back by C99 strtod() with the same bits.
+ */
+static void dtoa_func_verify_hex_all(void) {
+    int count = 100000;
+    
+    for (int i = 0; i < hex_func_count; i++) {
+        const char *name = hex_func_name_arr[i];
+        dtoa_func func = hex_func_arr[i];
+        int func_err = 0;
+        
+        printf("verify hex %s ", get_name_aligned(name, false));
+        yy_random_reset();
+        for (int v = 0; v < count; v++) {
+            f64 special[] = { 0.0, -0.0, 1.0, -1.0, DBL_MAX, -DBL_MAX, DBL_MIN,
+                f64_from_u64_raw(1) };
+            f64 val;
+            if (v < 8) val = special[v];
+            else if (v % 4 == 0) val = rand_f64();
+            else if (v % 4 == 1) val = rand_f64_subnormal();
+            else if (v % 4 == 2) val = rand_f64_integer();
+            else val = rand_f64_from_f32();
+            
+            char str[64];
+            usize write_len = func(val, str) - str;
+            char *end;
+            f64 val2 = strtod(str, &end);
+            if (f64_to_u64_raw(val) != f64_to_u64_raw(val2) ||
+                write_len != (usize)(end - str) || write_len != strlen(str)) {
+                func_err++;
+            }
+        }
+        if (!func_err) printf(" [OK]\n");
+        else printf(" [not_match:%d]\n", func_err);
+    }
+}
+
+/**
+ Verify the integer fast path: the output should be the same as `yy`, for the
+ integers (fast path), the numbers around 2^53 and the other doubles.
+ */
+static void dtoa_func_verify_int(void) {
+    dtoa_func func = dtoa_func_find("yy_int");
+    dtoa_func expect = dtoa_func_find("yy");
+    int count = 100000;
+    int func_err = 0;
+    if (!func || !expect) return;
+    
+    printf("verify int %s ", get_name_aligned("yy_int", false));
+    yy_random_reset();
+    for (int v = 0; v < count; v++) {
+        f64 special[] = { 0.0, -0.0, 1.0, -1.0, 0.5, 1.5, 9007199254740991.0,
+            9007199254740992.0, 9007199254740994.0, -9007199254740991.0,
+            4503599627370495.5, 1e21, 1e22, DBL_MAX, DBL_MIN,
+            f64_from_u64_raw(1), INFINITY, -INFINITY, NAN };
+        int special_count = (int)(sizeof(special) / sizeof(f64));
+        f64 val;
+        if (v < special_count) val = special[v];
+        else if (v % 4 == 0) val = rand_f64();
+        else if (v % 4 == 1) val = rand_f64_integer();
+        else if (v % 4 == 2) val = -rand_f64_integer_len((int)yy_random32_range(1, 17));
+        else val = rand_f64_len((int)yy_random32_range(1, 17));
+        
+        char str1[64], str2[64];
+        char *end1 = func(val, str1);
+        char *end2 = expect(val, str2);
+        if (end1 - str1 != end2 - str2 || strcmp(str1, str2) != 0) func_err++;
+    }
+    if (!func_err) printf(" [OK]\n");
+    else printf(" [not_match:%d]\n", func_err);
+}
+
+/**
+ Verify the style writers: `fmt_yy` should be the same as `yy`, the others
+ should be read back by strtod() with the same bits, and match the known
+ answers of each style.
+ */
+static void dtoa_func_verify_fmt_all(void) {
+    typedef struct {
+        f64 val;
+        const char *str[5];
+    } fmt_case;
+    static const char *fmt_name_arr[5] = {
+        "fmt_yy", "fmt_ecma", "fmt_repr", "fmt_g", "fmt_json"
+    };
+    fmt_case case_arr[] = {
+        /* value            yy                   ecma                 repr                  g                     json */
+        { 0.0,          { "0.0",             "0",                 "0.0",                "0",                  "0" } },
+        { -0.0,         { "-0.0",            "0",                 "-0.0",               "-0",                 "0" } },
+        { 100.0,        { "100.0",           "100",               "100.0",              "100",                "100" } },
+        { -1.5,         { "-1.5",            "-1.5",              "-1.5",               "-1.5",               "-1.5" } },
+        { 0.0001,       { "0.0001",          "0.0001",            "0.0001",             "0.0001",             "1e-4" } },
+        { 0.00001,      { "0.00001",         "0.00001",           "1e-05",              "1e-05",              "1e-5" } },
+        { 1.5e-7,       { "1.5e-7",          "1.5e-7",            "1.5e-07",            "1.5e-07",            "1.5e-7" } },
+        { 1e15,         { "1000000000000000.0", "1000000000000000", "1000000000000000.0", "1000000000000000", "1e15" } },
+        { 1e16,         { "10000000000000000.0", "10000000000000000", "1e+16",          "10000000000000000",  "1e16" } },
+        { 1e17,         { "100000000000000000.0", "100000000000000000", "1e+17",        "1e+17",              "1e17" } },
+        { 123456.0e12,  { "123456000000000000.0", "123456000000000000", "1.23456e+17",  "1.23456e+17",        "1.23456e17" } },
+        { 1e21,         { "1e21",            "1e+21",             "1e+21",              "1e+21",              "1e21" } },
+        { 1.25e-10,     { "1.25e-10",        "1.25e-10",          "1.25e-10",           "1.25e-10",           "1.25e-10" } },
+        { DBL_MAX,      { "1.7976931348623157e308", "1.7976931348623157e+308", "1.7976931348623157e+308", "1.7976931348623157e+308", "1.7976931348623157e308" } },
+        { 5e-324,       { "5e-324",          "5e-324",            "5e-324",             "5e-324",             "5e-324" } },
+        { INFINITY,     { "Infinity",        "Infinity",          "inf",                "inf",                "null" } },
+        { -INFINITY,    { "-Infinity",       "-Infinity",         "-inf",               "-inf",               "null" } },
+        { NAN,          { "NaN",             "NaN",               "nan",                "nan",                "null" } },
+    };
+    int case_count = (int)(sizeof(case_arr) / sizeof(fmt_case));
+    dtoa_func expect = dtoa_func_find("yy");
+    int count = 100000;
+    
+    for (int i = 0; i < fmt_func_count; i++) {
+        const char *name = fmt_func_name_arr[i];
+        dtoa_func func = fmt_func_arr[i];
+        bool is_yy = strcmp(name, "fmt_yy") == 0;
+        int col = -1;
+        int func_err = 0;
+        for (int c = 0; c < 5; c++) {
+            if (strcmp(fmt_name_arr[c], name) == 0) col = c;
+        }
+        
+        printf("verify fmt %s ", get_name_aligned(name, false));
+        if (is_yy && !expect) {
+            printf(" [no yy]\n");
+            continue;
+        }
+        
+        /* known answers */
+        for (int c = 0; c < case_count && col >= 0; c++) {
+            char str[64];
+            usize write_len = func(case_arr[c].val, str) - str;
+            if (strcmp(str, case_arr[c].str[col]) != 0 || write_len != strlen(str)) {
+                func_err++;
+            }
+        }
+        
+        /* same as yy, or read back by strtod() */
+        yy_random_reset();
+        for (int v = 0; v < count; v++) {
+            f64 val;
+            if (v % 4 == 0) val = rand_f64();
+            else if (v % 4 == 1) val = rand_f64_integer_len((int)yy_random32_range(1, 17));
+            else if (v % 4 == 2) val = -rand_f64_len((int)yy_random32_range(1, 17));
+            else val = rand_f64_normalize_len((int)yy_random32_range(1, 17));
+            
+            char str[64], str2[64];
+            usize write_len = func(val, str) - str;
+            if (write_len != strlen(str)) {
+                func_err++;
+            } else if (is_yy) {
+                expect(val, str2);
+                if (strcmp(str, str2) != 0) func_err++;
+            } else if (isfinite(val)) {
+                if (strtod(str, NULL) != val) func_err++;
+            }
+        }
+        if (!func_err) printf(" [OK]\n");
+        else printf(" [not_match:%d]\n", func_err);
+    }
+}
+
+/**
+ Verify the batch writers: the output should be the same as `xjb_sse` called in
+ a loop (the batch functions share the printing code with it).
+ */
+static void dtoa_func_verify_batch_all(void) {
+    usize count = 10007; /* not a multiple of the group size */
+    f64 *vals = malloc(count * sizeof(f64));
+    char *buf1 = malloc(count * 32 + 64);
+    char *buf2 = malloc(count * 32 + 64);
+    dtoa_func func = dtoa_func_find("xjb_sse");
+    
+    for (int i = 0; i < batch_func_count; i++) {
+        const char *name = batch_func_name_arr[i];
+        int func_err = 0;
+        
+        printf("verify batch %s ", get_name_aligned(name, false));
+        if (!func) {
+            printf(" [no xjb_sse]\n");
+            continue;
+        }
+        yy_random_reset();
+        for (int round = 0; round < 64; round++) {
+            f64 special[] = { 0.0, -0.0, 1.0, -1.0, DBL_MAX, -DBL_MAX, DBL_MIN,
+                f64_from_u64_raw(1), 9007199254740992.0, 9007199254740993.0,
+                INFINITY, -INFINITY, NAN, 1e23, 1e-7, 1e9 };
+            for (usize v = 0; v < count; v++) {
+                u32 r = yy_random32_uniform(7);
+                if (v < 16 && round == 0) vals[v] = special[v];
+                else if (r == 0) vals[v] = rand_f64();
+                else if (r == 1) vals[v] = rand_f64_len((int)yy_random32_range(1, 17));
+                else if (r == 2) vals[v] = rand_f64_normalize();
+                else if (r == 3) vals[v] = rand_f64_integer();
+                else if (r == 4) vals[v] = rand_f64_subnormal();
+                else if (r == 5) vals[v] = rand_f64_from_f32();
+                else vals[v] = -rand_f64_normalize_len((int)yy_random32_range(1, 17));
+            }
+            usize n = count - (usize)round; /* different tail length */
+            char *end1 = dtoa_batch_loop(func, vals, n, buf1);
+            char *end2 = batch_func_arr[i](vals, n, buf2);
+            if (end1 - buf1 != end2 - buf2 || strcmp(buf1, buf2) != 0) func_err++;
+        }
+        if (!func_err) printf(" [OK]\n");
+        else printf(" [not_match:%d]\n", func_err);
+    }
+    free(vals);
+    free(buf1);
+    free(buf2);
+}
+
 static void dtoa_func_cleanup(void) {
     func_count = 0;
     func_name_max = 0;
+    hex_func_count = 0;
+    fmt_func_count = 0;
+    batch_func_count = 0;
 }
 
 
@@ -567,41 +1672,69 @@ static void dtoa_func_register_all(void) {
     extern char *dtoa_##name(double val, char *buf); \
     func_arr[func_count] = dtoa_##name; \
     func_name_arr[func_count] = #name; \
+    func_direct_arr[func_count] = dtoa_direct_measure_##name; \
     func_count++; \
     if ((int)strlen(#name) > func_name_max) func_name_max = (int)strlen(#name);
     
     dtoa_func_register(null) /* used to meansure the benchmark overhead */
-    dtoa_func_register(david_gay)
-    dtoa_func_register(google)
-    dtoa_func_register(swift)
-    dtoa_func_register(fmtlib)
-    dtoa_func_register(fpconv)
-    dtoa_func_register(grisu3)
-    dtoa_func_register(schubfach)
-    dtoa_func_register(erthink)
-    dtoa_func_register(grisu_exact)
-    dtoa_func_register(dragonbox)
-    dtoa_func_register(ryu_mod)
-    dtoa_func_register(yy)
-#ifndef _MSC_VER
-    dtoa_func_register(milo)
-    dtoa_func_register(emyg)
-    dtoa_func_register(ryu)
-#endif
-#ifdef HAVE_SSE2
-    dtoa_func_register(xjb_sse)
-#endif
-#ifdef HAVE_AVX512
-    dtoa_func_register(xjb_avx512)
-#endif
+    DTOA_FUNC_LIST(dtoa_func_register) /* see dtoa_funcs.h */
     
     // dtoa_func_register(printf) // not shortest, too slow
+    
+#define dtoa_func_register_hex(name) \
+    extern char *dtoa_##name(double val, char *buf); \
+    hex_func_arr[hex_func_count] = dtoa_##name; \
+    hex_func_name_arr[hex_func_count] = #name; \
+    hex_func_count++; \
+    if ((int)strlen(#name) > func_name_max) func_name_max = (int)strlen(#name);
+    
+    dtoa_func_register_hex(hex_printf) /* C99 printf("%a") */
+    dtoa_func_register_hex(hex_yy)
+    
+#define dtoa_func_register_fmt(name) \
+    extern char *dtoa_##name(double val, char *buf); \
+    fmt_func_arr[fmt_func_count] = dtoa_##name; \
+    fmt_func_name_arr[fmt_func_count] = #name; \
+    fmt_func_count++; \
+    if ((int)strlen(#name) > func_name_max) func_name_max = (int)strlen(#name);
+    
+    dtoa_func_register_fmt(fmt_yy) /* same as yy */
+    dtoa_func_register_fmt(fmt_ecma) /* JavaScript Number.prototype.toString() */
+    dtoa_func_register_fmt(fmt_repr) /* Python repr() */
+    dtoa_func_register_fmt(fmt_g) /* C "%.17g" with shortest digits */
+    dtoa_func_register_fmt(fmt_json) /* the shorter notation */
+    
+#define dtoa_func_register_batch(name) \
+    extern char *dtoa_##name(const double *vals, size_t count, char *buf); \
+    batch_func_arr[batch_func_count] = dtoa_##name; \
+    batch_func_name_arr[batch_func_count] = #name; \
+    batch_func_count++; \
+    if ((int)strlen(#name) > func_name_max) func_name_max = (int)strlen(#name);
+    
+#ifdef HAVE_AVX512
+    dtoa_func_register_batch(xjb_batch_avx512)
+#endif
+#ifdef HAVE_AVX2
+    dtoa_func_register_batch(xjb_batch_avx2)
+#endif
 }
 
 void benchmark(const char *output_file_path) {
     dtoa_func_register_all();
+    if (bench_search_get_target()) {
+        printf("------[search]---------\n");
+        dtoa_func_search(bench_search_get_target(), output_file_path);
+        printf("------[finish]---------\n");
+        dtoa_func_cleanup();
+        return;
+    }
     printf("------[verify]---------\n");
     dtoa_func_verify_all();
+    dtoa_func_verify_hex_all();
+    dtoa_func_verify_int();
+    dtoa_func_verify_fmt_all();
+    dtoa_func_verify_batch_all();
+    dtoa_memo_verify();
     printf("------[benchmark]------\n");
     dtoa_func_benchmark_all(output_file_path);
     printf("------[finish]---------\n");
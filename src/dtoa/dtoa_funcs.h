@@ -0,0 +1,51 @@
+#ifndef dtoa_funcs_h
+#define dtoa_funcs_h
+
+/**
+ The registered functions which write the shortest digits of double, shared by
+ the runs which use them (dtoa, roundtrip), so the lists can not drift apart.
+ Function prototype: char *dtoa_<name>(double val, char *buf);
+ 
+ Expand the list with a macro which takes the name, for example:
+ #define register(name) func_arr[func_count++] = dtoa_##name;
+ DTOA_FUNC_LIST(register)
+ 
+ The "null" function (benchmark overhead) is not in the list.
+ */
+#define DTOA_FUNC_LIST(X) \
+    X(david_gay) \
+    X(google) \
+    X(swift) \
+    X(fmtlib) \
+    X(fpconv) \
+    X(grisu3) \
+    X(schubfach) \
+    X(erthink) \
+    X(grisu_exact) \
+    X(dragonbox) \
+    X(ryu_mod) \
+    X(yy) \
+    X(yy_int) /* yy with integer fast path */ \
+    DTOA_FUNC_LIST_NO_MSC(X) \
+    DTOA_FUNC_LIST_SSE2(X) \
+    DTOA_FUNC_LIST_AVX512(X)
+
+#ifndef _MSC_VER
+#   define DTOA_FUNC_LIST_NO_MSC(X) X(milo) X(emyg) X(ryu)
+#else
+#   define DTOA_FUNC_LIST_NO_MSC(X)
+#endif
+
+#ifdef HAVE_SSE2
+#   define DTOA_FUNC_LIST_SSE2(X) X(xjb_sse)
+#else
+#   define DTOA_FUNC_LIST_SSE2(X)
+#endif
+
+#ifdef HAVE_AVX512
+#   define DTOA_FUNC_LIST_AVX512(X) X(xjb_avx512)
+#else
+#   define DTOA_FUNC_LIST_AVX512(X)
+#endif
+
+#endif /* dtoa_funcs_h */
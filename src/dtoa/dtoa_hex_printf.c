@@ -0,0 +1,8 @@
+#include <stdio.h>
+
+char *dtoa_hex_printf(double val, char *buf) {
+    int len = snprintf(buf, 32, "%a", val);
+    buf += len;
+    *buf = '\0';
+    return buf;
+}
@@ -0,0 +1,79 @@
+/*
+ Write double as C99 hex-float string (same format as glibc's `%a`) by ibireme.
+ For example: 0x1.8p+3, -0x1p-1, 0x0.0000000000001p-1022, 0x0p+0
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+static const char hex_table[16] = {
+    '0', '1', '2', '3', '4', '5', '6', '7',
+    '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'
+};
+
+/** Returns the number of trailing 0-bits in value (input should not be 0). */
+static inline int u64_tz_bits(uint64_t v) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(v);
+#else
+    int n = 0;
+    while (!(v & 1)) { v >>= 1; n++; }
+    return n;
+#endif
+}
+
+char *dtoa_hex_yy(double val, char *buf) {
+    uint64_t raw, sig;
+    int32_t exp;
+    int len, i;
+    
+    memcpy(&raw, &val, 8);
+    sig = raw & 0x000FFFFFFFFFFFFFULL;
+    exp = (int32_t)((raw >> 52) & 0x7FF);
+    
+    if (raw >> 63) *buf++ = '-';
+    if (exp == 0x7FF) {
+        memcpy(buf, sig ? "nan" : "inf", 4);
+        return buf + 3;
+    }
+    
+    *buf++ = '0';
+    *buf++ = 'x';
+    if (exp == 0) {
+        *buf++ = '0';
+        exp = sig ? -1022 : 0; /* subnormal or zero */
+    } else {
+        *buf++ = '1';
+        exp -= 1023;
+    }
+    
+    /* 52 bits = 13 hex digits, trailing zeros are removed */
+    if (sig) {
+        int tz = u64_tz_bits(sig) >> 2;
+        len = 13 - tz;
+        sig >>= tz * 4;
+        *buf++ = '.';
+        for (i = len - 1; i >= 0; i--) {
+            buf[i] = hex_table[sig & 0xF];
+            sig >>= 4;
+        }
+        buf += len;
+    }
+    
+    /* binary exponent in decimal: p-1022 to p+1023 */
+    *buf++ = 'p';
+    if (exp < 0) {
+        *buf++ = '-';
+        exp = -exp;
+    } else {
+        *buf++ = '+';
+    }
+    len = exp >= 1000 ? 4 : exp >= 100 ? 3 : exp >= 10 ? 2 : 1;
+    for (i = len - 1; i >= 0; i--) {
+        buf[i] = (char)('0' + exp % 10);
+        exp /= 10;
+    }
+    buf += len;
+    *buf = '\0';
+    return buf;
+}
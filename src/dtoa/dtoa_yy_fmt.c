@@ -0,0 +1,34 @@
+/*
+ Double to string with an output style by ibireme.
+ 
+ The shortest decimal digits are computed once by yy_double, and written by a
+ style (see `yy_double_format`), for example:
+ 
+ fmt_yy:    1e21     1.5e-7    100.0  -0.0  NaN       (same as dtoa_yy)
+ fmt_ecma:  1e+21    1.5e-7    100    0     NaN       (JavaScript)
+ fmt_repr:  1e+21    1.5e-07   100.0  -0.0  nan       (Python)
+ fmt_g:     1e+21    1.5e-07   100    -0    nan       (C "%.17g", shortest)
+ fmt_json:  1e21     1.5e-7    100    0     null      (shorter notation)
+ */
+
+#include "yy_double.h"
+
+char *dtoa_fmt_yy(double val, char *buf) {
+    return yy_double_to_string_format(val, &yy_double_format_yy, buf);
+}
+
+char *dtoa_fmt_ecma(double val, char *buf) {
+    return yy_double_to_string_format(val, &yy_double_format_ecma, buf);
+}
+
+char *dtoa_fmt_repr(double val, char *buf) {
+    return yy_double_to_string_format(val, &yy_double_format_repr, buf);
+}
+
+char *dtoa_fmt_g(double val, char *buf) {
+    return yy_double_to_string_format(val, &yy_double_format_g, buf);
+}
+
+char *dtoa_fmt_json(double val, char *buf) {
+    return yy_double_to_string_format(val, &yy_double_format_json, buf);
+}
@@ -0,0 +1,43 @@
+/*
+ Double to string with an integer fast path by ibireme.
+
+ Most numbers in metrics are integer-valued doubles (counts, bytes, 42.0), a
+ shortest algorithm spends the full effort on them. This function detects the
+ integers in range [1, 2^53) from the bit pattern (no float compare), writes
+ the integer with the u64 path of itoa_yy.c, and delegates the others to
+ yy_double. The output is the same as `dtoa_yy`, for example: 42.0, -7.0
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include "yy_double.h"
+
+/* u64 to string (itoa_yy.c), the result is not null-terminated */
+char *itoa_u64_yy(uint64_t val, char *buf);
+
+char *dtoa_yy_int(double val, char *buf) {
+    uint64_t raw, sig;
+    uint32_t exp, shift;
+
+    memcpy(&raw, &val, 8);
+    exp = (uint32_t)((raw >> 52) & 0x7FF);
+
+    /* value in [1, 2^53): biased exponent in [1023, 1075] */
+    if (exp - 1023 <= 52) {
+        shift = 1075 - exp;
+        sig = (raw & 0x000FFFFFFFFFFFFFULL) | ((uint64_t)1 << 52);
+
+        /* integer if the bits below the binary point are all 0 */
+        if ((sig & (((uint64_t)1 << shift) - 1)) == 0) {
+            *buf = '-';
+            buf += raw >> 63;
+            buf = itoa_u64_yy(sig >> shift, buf);
+            memcpy(buf, ".0", 3);
+            return buf + 2;
+        }
+    }
+
+    buf = yy_double_to_string(val, buf);
+    *buf = '\0';
+    return buf;
+}
@@ -0,0 +1,406 @@
+/*
+ * Copyright (c) 2018 YaoYuan <ibireme@gmail.com>.
+ * Released under the MIT license (MIT).
+ */
+
+#include "fixed.h"
+#include "yybench.h"
+#include "bench_cpu.h"
+#include <inttypes.h>
+
+/*----------------------------------------------------------------------------*/
+/**
+ This benchmark reads decimal strings (such as prices) into int64 scaled by
+ 10^scale, and writes the scaled values back with a fixed number of fraction
+ digits. `libc` goes through double (strtod/printf), as the baseline.
+ */
+
+/** String count of each case. */
+#define FIXED_SAMPLE_COUNT 10000
+
+/** Slot size of each string (the SWAR functions may read 8 bytes more). */
+#define FIXED_SLOT_LEN 48
+
+
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct {
+    fixed_parse_func parse;
+    fixed_format_func format;
+    const char *name;
+    bool strict; /* exact and follows the grammar in fixed.h */
+} fixed_group;
+
+static int fixed_group_num = 0;
+static fixed_group fixed_group_arr[16];
+static int fixed_group_name_max = 0;
+
+static char *fixed_group_get_name_aligned(fixed_group group) {
+    static char buf[64];
+    int len = (int)strlen(group.name);
+    int space = fixed_group_name_max - len;
+    memcpy(buf, group.name, len);
+    for (int i = 0; i < space; i++) buf[len + i] = ' ';
+    buf[fixed_group_name_max] = '\0';
+    return buf;
+}
+
+static const char *fixed_round_name_arr[] = {
+    "half_even", "half_up", "down", "exact"
+};
+
+
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct {
+    const char *name;
+    const char *desc;
+    u32 scale;
+    u32 int_len_min; /* 0: the integer part is "0" */
+    u32 int_len_max;
+    u32 frac_len_min;
+    u32 frac_len_max;
+} dataset_t;
+
+static dataset_t dataset_arr[] = {
+    { "price, scale 2", "1 to 6 integer digits with 2 fraction digits, such as 123.45", 2, 1, 6, 2, 2 },
+    { "price, scale 4", "1 to 6 integer digits with 1 to 4 fraction digits, such as 123.4567", 4, 1, 6, 1, 4 },
+    { "crypto, scale 8", "0 to 4 integer digits with 8 fraction digits, such as 0.00012345", 8, 0, 4, 8, 8 },
+    { "rounding, scale 2", "1 to 6 integer digits with 3 to 8 fraction digits, rounded to 2", 2, 1, 6, 3, 8 },
+    { "large, scale 6", "10 to 12 integer digits with 6 fraction digits", 6, 10, 12, 6, 6 },
+};
+static const int dataset_num = (int)(sizeof(dataset_arr) / sizeof(dataset_t));
+
+/** Write a random decimal string of the dataset (null-terminated). */
+static usize write_decimal_random(char *buf, dataset_t dataset) {
+    char *cur = buf;
+    u32 int_len = yy_random32_range(dataset.int_len_min, dataset.int_len_max);
+    u32 frac_len = yy_random32_range(dataset.frac_len_min, dataset.frac_len_max);
+    if (yy_random32_uniform(4) == 0) *cur++ = '-';
+    if (int_len == 0) {
+        *cur++ = '0';
+    } else {
+        *cur++ = (char)('0' + (int_len == 1 ? yy_random32_uniform(10) :
+                                              yy_random32_range(1, 9)));
+        for (u32 i = 1; i < int_len; i++) *cur++ = (char)('0' + yy_random32_uniform(10));
+    }
+    if (frac_len) {
+        *cur++ = '.';
+        for (u32 i = 0; i < frac_len; i++) *cur++ = (char)('0' + yy_random32_uniform(10));
+    }
+    *cur = '\0';
+    return (usize)(cur - buf);
+}
+
+/** Fill the slots with random decimal strings, the slots are padded with 0. */
+static void fill_decimal_random(char *buf, u32 *lens, u32 count, dataset_t dataset) {
+    memset(buf, 0, (usize)count * FIXED_SLOT_LEN);
+    for (u32 i = 0; i < count; i++) {
+        lens[i] = (u32)write_decimal_random(buf + (usize)i * FIXED_SLOT_LEN, dataset);
+    }
+}
+
+
+
+/*----------------------------------------------------------------------------*/
+
+static void fixed_group_verify_all(void) {
+    typedef struct {
+        const char *str;
+        u32 scale;
+        fixed_round mode;
+        i64 val;
+        fixed_result res;
+        int len; /* consumed length */
+    } parse_case;
+
+    parse_case parse_arr[] = {
+        { "123.4567", 4, fixed_round_half_even, 1234567, fixed_result_suc, 8 },
+        { "123.4567", 2, fixed_round_half_even, 12346, fixed_result_suc, 8 },
+        { "123.4567", 0, fixed_round_down, 123, fixed_result_suc, 8 },
+        { "5", 2, fixed_round_exact, 500, fixed_result_suc, 1 },
+        { "0.05", 2, fixed_round_exact, 5, fixed_result_suc, 4 },
+        { "0.1", 8, fixed_round_exact, 10000000, fixed_result_suc, 3 },
+        { "-0.00", 2, fixed_round_exact, 0, fixed_result_suc, 5 },
+        { "0.125", 2, fixed_round_half_even, 12, fixed_result_suc, 5 },
+        { "0.135", 2, fixed_round_half_even, 14, fixed_result_suc, 5 },
+        { "0.1250001", 2, fixed_round_half_even, 13, fixed_result_suc, 9 },
+        { "0.125", 2, fixed_round_half_up, 13, fixed_result_suc, 5 },
+        { "-0.125", 2, fixed_round_half_up, -13, fixed_result_suc, 6 },
+        { "0.129", 2, fixed_round_down, 12, fixed_result_suc, 5 },
+        { "-0.129", 2, fixed_round_down, -12, fixed_result_suc, 6 },
+        { "0.1200000000000000000000", 2, fixed_round_exact, 12, fixed_result_suc, 24 },
+        { "0.1200000000000000000001", 2, fixed_round_exact, 12, fixed_result_inexact, 24 },
+        { "1.99999999999999999999", 2, fixed_round_half_even, 200, fixed_result_suc, 22 },
+        { "0.123456789012345678", 18, fixed_round_exact, 123456789012345678LL, fixed_result_suc, 20 },
+        { "9.223372036854775807", 18, fixed_round_exact, INT64_MAX, fixed_result_suc, 20 },
+        { "-9.223372036854775808", 18, fixed_round_exact, INT64_MIN, fixed_result_suc, 21 },
+        { "9.223372036854775808", 18, fixed_round_exact, INT64_MAX, fixed_result_overflow, 20 },
+        { "92233720368547758.07", 2, fixed_round_half_even, INT64_MAX, fixed_result_suc, 20 },
+        { "92233720368547758.075", 2, fixed_round_half_up, INT64_MAX, fixed_result_overflow, 21 },
+        { "92233720368547758.08", 2, fixed_round_half_even, INT64_MAX, fixed_result_overflow, 20 },
+        { "-92233720368547758.08", 2, fixed_round_half_even, INT64_MIN, fixed_result_suc, 21 },
+        { "100000000000000000000", 0, fixed_round_half_even, INT64_MAX, fixed_result_overflow, 21 },
+        { "12,34", 2, fixed_round_half_even, 1200, fixed_result_suc, 2 },
+        { "1.5e3", 2, fixed_round_half_even, 150, fixed_result_suc, 3 },
+        { "", 2, fixed_round_half_even, 0, fixed_result_fail, 0 },
+        { "-", 2, fixed_round_half_even, 0, fixed_result_fail, 0 },
+        { ".5", 2, fixed_round_half_even, 0, fixed_result_fail, 0 },
+        { "1.", 2, fixed_round_half_even, 0, fixed_result_fail, 0 },
+        { "01.5", 2, fixed_round_half_even, 0, fixed_result_fail, 0 },
+        { "+1.5", 2, fixed_round_half_even, 0, fixed_result_fail, 0 },
+    };
+    int parse_num = (int)(sizeof(parse_arr) / sizeof(parse_case));
+
+    typedef struct {
+        i64 val;
+        u32 scale;
+        const char *str;
+    } format_case;
+
+    format_case format_arr[] = {
+        { 0, 0, "0" },
+        { 0, 2, "0.00" },
+        { 5, 2, "0.05" },
+        { -5, 2, "-0.05" },
+        { 1234567, 4, "123.4567" },
+        { 100, 2, "1.00" },
+        { -100000000, 8, "-1.00000000" },
+        { 123456789012345678LL, 17, "1.23456789012345678" },
+        { INT64_MAX, 0, "9223372036854775807" },
+        { INT64_MAX, 18, "9.223372036854775807" },
+        { INT64_MIN, 18, "-9.223372036854775808" },
+        { INT64_MIN, 9, "-9223372036.854775808" },
+        { 1, 18, "0.000000000000000001" },
+    };
+    int format_num = (int)(sizeof(format_arr) / sizeof(format_case));
+
+    char *buf = malloc((usize)FIXED_SAMPLE_COUNT * FIXED_SLOT_LEN);
+    u32 *lens = malloc(FIXED_SAMPLE_COUNT * sizeof(u32));
+    if (!buf || !lens) {
+        printf("memory allocation failed.\n");
+        free(buf);
+        free(lens);
+        return;
+    }
+    fixed_group ref = fixed_group_arr[0]; /* yy */
+
+    for (int g = 0; g < fixed_group_num; g++) {
+        fixed_group group = fixed_group_arr[g];
+        int parse_err = 0, format_err = 0;
+
+        /* known answers (libc reads other grammar, such as "1.5e3") */
+        for (int i = 0; i < parse_num && group.strict; i++) {
+            parse_case c = parse_arr[i];
+            char str[FIXED_SLOT_LEN] = { 0 };
+            char *end;
+            fixed_result res;
+            memcpy(str, c.str, strlen(c.str));
+            i64 val = group.parse(str, strlen(str), c.scale, c.mode, &end, &res);
+            if (res != c.res || (int)(end - str) != c.len ||
+                (res != fixed_result_fail && val != c.val)) {
+                printf("fixed_parse_%s not match, input:%s, scale:%d, mode:%s, "
+                       "expect:%" PRIi64 "/%s/%d, return:%" PRIi64 "/%s/%d\n",
+                       group.name, c.str, (int)c.scale, fixed_round_name_arr[c.mode],
+                       c.val, fixed_result_desc(c.res), c.len,
+                       val, fixed_result_desc(res), (int)(end - str));
+                parse_err++;
+            }
+        }
+        for (int i = 0; i < format_num && group.strict; i++) {
+            format_case c = format_arr[i];
+            char str[FIXED_SLOT_LEN];
+            char *end = group.format(c.val, c.scale, str);
+            if (strcmp(str, c.str) != 0 || end != str + strlen(str)) {
+                printf("fixed_format_%s not match, input:%" PRIi64 ", scale:%d, "
+                       "expect:%s, return:%s\n",
+                       group.name, c.val, (int)c.scale, c.str, str);
+                format_err++;
+            }
+        }
+
+        /* same as yy on random strings and values, in all rounding modes */
+        for (int d = 0; d < dataset_num; d++) {
+            dataset_t dataset = dataset_arr[d];
+            yy_random_reset();
+            fill_decimal_random(buf, lens, FIXED_SAMPLE_COUNT, dataset);
+            for (u32 s = 0; s < FIXED_SAMPLE_COUNT; s++) {
+                char *str = buf + (usize)s * FIXED_SLOT_LEN;
+                for (int m = 0; m < 4; m++) {
+                    char *end1, *end2;
+                    fixed_result res1, res2;
+                    i64 val1 = ref.parse(str, lens[s], dataset.scale, (fixed_round)m, &end1, &res1);
+                    i64 val2 = group.parse(str, lens[s], dataset.scale, (fixed_round)m, &end2, &res2);
+                    if (val1 != val2 || res1 != res2 || end1 != end2) parse_err++;
+                }
+
+                char out1[FIXED_SLOT_LEN], out2[FIXED_SLOT_LEN];
+                i64 val = (i64)yy_random64() >> yy_random32_uniform(64);
+                u32 scale = yy_random32_uniform(FIXED_SCALE_MAX + 1);
+                if (s % 2) scale = dataset.scale;
+                char *end1 = ref.format(val, scale, out1);
+                char *end2 = group.format(val, scale, out2);
+                if (end1 - out1 != end2 - out2 || strcmp(out1, out2) != 0) format_err++;
+            }
+        }
+
+        if (group.strict) {
+            printf("verify %s [%s]\n", fixed_group_get_name_aligned(group),
+                   (parse_err || format_err) ? "FAIL" : "OK");
+        } else {
+            printf("verify %s [lossy parse:%d, format:%d]\n",
+                   fixed_group_get_name_aligned(group), parse_err, format_err);
+        }
+    }
+
+    free(buf);
+    free(lens);
+}
+
+
+
+/*----------------------------------------------------------------------------*/
+
+static void fixed_group_benchmark_all(const char *output_path) {
+    static const int repeat_count = 64;
+
+    printf("initialize...\n");
+    bench_cpu_setup();
+
+    char *buf = malloc((usize)FIXED_SAMPLE_COUNT * FIXED_SLOT_LEN);
+    u32 *lens = malloc(FIXED_SAMPLE_COUNT * sizeof(u32));
+    i64 *vals = malloc(FIXED_SAMPLE_COUNT * sizeof(i64));
+    if (!buf || !lens || !vals) {
+        printf("memory allocation failed.\n");
+        free(buf);
+        free(lens);
+        free(vals);
+        return;
+    }
+
+    yy_report *report = yy_report_new();
+    bench_report_add_env_info(report);
+
+    for (int d = 0; d < dataset_num; d++) {
+        dataset_t dataset = dataset_arr[d];
+        printf("run benchmark %s...", dataset.name);
+
+        /* the strings, and the values read by yy (half even) */
+        yy_random_reset();
+        fill_decimal_random(buf, lens, FIXED_SAMPLE_COUNT, dataset);
+        for (u32 s = 0; s < FIXED_SAMPLE_COUNT; s++) {
+            char *end;
+            fixed_result res;
+            vals[s] = fixed_group_arr[0].parse(buf + (usize)s * FIXED_SLOT_LEN, lens[s],
+                                               dataset.scale, fixed_round_half_even, &end, &res);
+        }
+
+        for (int c = 0; c < 2; c++) {
+            bool is_parse = (c == 0);
+            char title[128];
+            snprintf(title, sizeof(title), "%s (%s)", is_parse ? "parse" : "format", dataset.name);
+
+            yy_chart *chart = yy_chart_new();
+            yy_chart_options op;
+            yy_chart_options_init(&op);
+            op.title = title;
+            op.subtitle = dataset.desc;
+            op.type = YY_CHART_BAR;
+            op.h_axis.title = "average CPU cycles";
+            op.plot.value_labels_enabled = true;
+            op.plot.value_labels_decimals = 2;
+            op.plot.color_by_point = true;
+            op.plot.group_padding = 0.0f;
+            op.plot.point_padding = 0.1f;
+            op.plot.border_width = 0.0f;
+            op.legend.enabled = false;
+            op.tooltip.value_decimals = 2;
+            op.width = 640;
+            op.height = 300;
+
+            for (int g = 0; g < fixed_group_num; g++) {
+                fixed_group group = fixed_group_arr[g];
+                char out[FIXED_SLOT_LEN];
+                char *end;
+                fixed_result res;
+                u64 ticks_min;
+                for (int retry = 0; ; retry++) {
+                    ticks_min = UINT64_MAX;
+                    for (int r = 0; r < repeat_count; r++) {
+                        u64 t1 = yy_time_get_ticks();
+                        if (is_parse) {
+                            for (u32 s = 0; s < FIXED_SAMPLE_COUNT; s++) {
+                                group.parse(buf + (usize)s * FIXED_SLOT_LEN, lens[s],
+                                            dataset.scale, fixed_round_half_even, &end, &res);
+                            }
+                        } else {
+                            for (u32 s = 0; s < FIXED_SAMPLE_COUNT; s++) {
+                                group.format(vals[s], dataset.scale, out);
+                            }
+                        }
+                        u64 t2 = yy_time_get_ticks();
+                        u64 t = t2 - t1;
+                        if (t < ticks_min) ticks_min = t;
+                    }
+                    if (bench_cpu_check_freq(retry)) break;
+                }
+                f64 cycles = (f64)ticks_min / FIXED_SAMPLE_COUNT * bench_cpu_get_cycle_per_tick();
+                yy_chart_item_with_float(chart, group.name, (f32)cycles);
+            }
+            yy_chart_sort_items_with_value(chart, false);
+            yy_chart_set_options(chart, &op);
+            yy_report_add_chart(report, chart);
+            yy_chart_free(chart);
+        }
+        printf("[OK]\n");
+    }
+
+    bench_report_add_drift_info(report);
+    if (!yy_report_write_html_file(report, output_path)) {
+        printf("[ERROR] report write failed: %s\n", output_path);
+    } else {
+        printf("report generated: %s\n", output_path);
+    }
+    yy_report_free(report);
+    free(buf);
+    free(lens);
+    free(vals);
+}
+
+
+
+/*----------------------------------------------------------------------------*/
+
+static void fixed_group_cleanup(void) {
+    fixed_group_num = 0;
+    fixed_group_name_max = 0;
+}
+
+static void fixed_group_register_all(void) {
+#define register_group_name(_name, _strict) \
+    extern int64_t fixed_parse_##_name(const char *str, size_t len, uint32_t scale, \
+                                       fixed_round mode, char **endptr, fixed_result *res); \
+    extern char *fixed_format_##_name(int64_t val, uint32_t scale, char *buf); \
+    fixed_group_arr[fixed_group_num].name = #_name; \
+    fixed_group_arr[fixed_group_num].parse = fixed_parse_##_name; \
+    fixed_group_arr[fixed_group_num].format = fixed_format_##_name; \
+    fixed_group_arr[fixed_group_num].strict = _strict; \
+    if (fixed_group_name_max < (int)strlen(#_name)) fixed_group_name_max = (int)strlen(#_name); \
+    fixed_group_num++;
+
+    register_group_name(yy, true); /* the first one is used as reference */
+    register_group_name(swar, true);
+    register_group_name(libc, false); /* through double: strtod, printf */
+}
+
+void benchmark(const char *output_path) {
+    fixed_group_register_all();
+    printf("------[verify]---------\n");
+    fixed_group_verify_all();
+    printf("------[benchmark]------\n");
+    fixed_group_benchmark_all(output_path);
+    printf("------[finish]---------\n");
+    fixed_group_cleanup();
+}
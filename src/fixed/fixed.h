@@ -0,0 +1,71 @@
+#ifndef fixed_h
+#define fixed_h
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ Decimal fixed-point number: an int64 scaled by 10^scale.
+ For example, the price "123.4567" with scale 4 is 1234567.
+
+ Parse: the input is `-?(0|[1-9][0-9]*)(\.[0-9]+)?` (JSON number without
+ exponent), the fraction digits beyond the scale are rounded by `fixed_round`.
+ The string should be null-terminated and padded: the SWAR functions may read
+ (but not use) up to 8 bytes after the number.
+ 
+ Format: the value is written with exactly `scale` fraction digits, such as
+ 1234567 with scale 4 -> "123.4567", 5 with scale 2 -> "0.05", the string is
+ null-terminated and the buffer should be at least 32 bytes.
+ */
+
+/** Max scale (10^18 fits in int64). */
+#define FIXED_SCALE_MAX 18
+
+typedef enum {
+    fixed_result_suc = 0,
+    fixed_result_fail = 1,      /* not a number, returns 0 */
+    fixed_result_overflow = 2,  /* out of int64 range, returns INT64_MAX or INT64_MIN */
+    fixed_result_inexact = 3,   /* (fixed_round_exact) the dropped digits are not zero,
+                                   returns the value rounded toward zero */
+} fixed_result;
+
+typedef enum {
+    fixed_round_half_even = 0,  /* 0.125 -> 0.12, 0.135 -> 0.14 (banker's rounding) */
+    fixed_round_half_up = 1,    /* 0.125 -> 0.13, -0.125 -> -0.13 (half away from zero) */
+    fixed_round_down = 2,       /* 0.129 -> 0.12, -0.129 -> -0.12 (toward zero) */
+    fixed_round_exact = 3,      /* 0.120 -> 0.12, 0.125 -> inexact */
+} fixed_round;
+
+static inline const char *fixed_result_desc(fixed_result res) {
+    switch (res) {
+        case fixed_result_suc: return "suc";
+        case fixed_result_fail: return "fail";
+        case fixed_result_overflow: return "overflow";
+        case fixed_result_inexact: return "inexact";
+        default: return "unknown";
+    }
+}
+
+/**
+ Read a decimal string as int64 scaled by 10^scale.
+ @param str The input string.
+ @param len The string length (the string is also null-terminated).
+ @param scale The fraction digit count, in range [0, FIXED_SCALE_MAX].
+ @param mode The rounding mode for the digits beyond the scale.
+ @param endptr The end of the number (all fraction digits are consumed),
+    or `str` if failed.
+ @param res The result.
+ */
+typedef int64_t (*fixed_parse_func)(const char *str, size_t len, uint32_t scale,
+                                    fixed_round mode, char **endptr, fixed_result *res);
+
+/**
+ Write an int64 scaled by 10^scale as decimal string.
+ @param val The scaled value.
+ @param scale The fraction digit count, in range [0, FIXED_SCALE_MAX].
+ @param buf The output buffer, at least 32 bytes.
+ @return The end of the string (the null-terminator).
+ */
+typedef char *(*fixed_format_func)(int64_t val, uint32_t scale, char *buf);
+
+#endif /* fixed_h */
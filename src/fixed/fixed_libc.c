@@ -0,0 +1,47 @@
+/*
+ Decimal fixed-point parse/format through double with libc (strtod/printf),
+ as the baseline: a value with more than 15 significant digits may be lossy.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "fixed.h"
+
+static const double pow10_table[FIXED_SCALE_MAX + 1] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9,
+    1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18
+};
+
+int64_t fixed_parse_libc(const char *str, size_t len, uint32_t scale,
+                         fixed_round mode, char **endptr, fixed_result *res) {
+    double val = strtod(str, endptr) * pow10_table[scale];
+    double ret;
+    (void)len;
+    if (*endptr == str) {
+        *res = fixed_result_fail;
+        return 0;
+    }
+    *res = fixed_result_suc;
+    switch (mode) {
+        case fixed_round_half_even: ret = nearbyint(val); break; /* default rounding mode */
+        case fixed_round_half_up: ret = round(val); break;
+        case fixed_round_exact:
+            ret = trunc(val);
+            if (ret != val) *res = fixed_result_inexact;
+            break;
+        default: ret = trunc(val); break;
+    }
+    if (!(ret < 9223372036854775808.0 && ret >= -9223372036854775808.0)) {
+        *res = fixed_result_overflow;
+        return val < 0 ? INT64_MIN : INT64_MAX;
+    }
+    return (int64_t)ret;
+}
+
+char *fixed_format_libc(int64_t val, uint32_t scale, char *buf) {
+    int len = snprintf(buf, 32, "%.*f", (int)scale, (double)val / pow10_table[scale]);
+    return buf + len;
+}
@@ -0,0 +1,307 @@
+/*
+ Decimal fixed-point parse/format with SWAR (SIMD within a register).
+ 
+ Parse: the digit runs are measured with 8-byte loads (the first non-digit
+ byte is found with a mask test), the integer part is read by
+ `atoi_u64_swar_exact()` with the known length, and the fraction digits up
+ to the scale are converted 8 at a time. The input should be padded with 8
+ bytes (see fixed.h).
+ 
+ Format: the integer part is written by `itoa_u64_yy()`, the fraction digits
+ (with leading zeros) are converted 8 at a time in a register and stored with
+ one 8-byte store.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "fixed.h"
+#include "../atoi/benchmark.h"
+
+
+/* compiler builtin check (clang) */
+#ifndef yy_has_builtin
+#   ifdef __has_builtin
+#       define yy_has_builtin(x) __has_builtin(x)
+#   else
+#       define yy_has_builtin(x) 0
+#   endif
+#endif
+
+/* compiler attribute check (gcc/clang) */
+#ifndef yy_has_attribute
+#   ifdef __has_attribute
+#       define yy_has_attribute(x) __has_attribute(x)
+#   else
+#       define yy_has_attribute(x) 0
+#   endif
+#endif
+
+/* inline */
+#ifndef yy_inline
+#   if _MSC_VER >= 1200
+#       define yy_inline __forceinline
+#   elif defined(_MSC_VER)
+#       define yy_inline __inline
+#   elif yy_has_attribute(always_inline) || __GNUC__ >= 4
+#       define yy_inline __inline__ __attribute__((always_inline))
+#   elif defined(__clang__) || defined(__GNUC__)
+#       define yy_inline __inline__
+#   elif defined(__cplusplus) || (__STDC__ >= 1 && __STDC_VERSION__ >= 199901L)
+#       define yy_inline inline
+#   else
+#       define yy_inline
+#   endif
+#endif
+
+/* likely */
+#ifndef yy_likely
+#   if yy_has_builtin(__builtin_expect) || __GNUC__ >= 4
+#       define yy_likely(expr) __builtin_expect(!!(expr), 1)
+#   else
+#       define yy_likely(expr) (expr)
+#   endif
+#endif
+
+/* unlikely */
+#ifndef yy_unlikely
+#   if yy_has_builtin(__builtin_expect) || __GNUC__ >= 4
+#       define yy_unlikely(expr) __builtin_expect(!!(expr), 0)
+#   else
+#       define yy_unlikely(expr) (expr)
+#   endif
+#endif
+
+/* byte order (the loaded bytes are swapped on big-endian) */
+#ifndef yy_little_endian
+#   if (defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__) || \
+        defined(__LITTLE_ENDIAN__) || defined(_MSC_VER)
+#       define yy_little_endian 1
+#   else
+#       define yy_little_endian 0
+#   endif
+#endif
+
+/* the digit kernels, see `atoi_swar.c` and `itoa_yy.c` */
+uint64_t atoi_u64_swar_exact(const char *str, size_t len, char **endptr, atoi_result *res);
+char *itoa_u64_yy(uint64_t val, char *buf);
+
+static const uint64_t pow10_table[FIXED_SCALE_MAX + 1] = {
+    1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL,
+    10000000ULL, 100000000ULL, 1000000000ULL, 10000000000ULL,
+    100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+    100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,
+    100000000000000000ULL, 1000000000000000000ULL
+};
+
+/** Load 8 bytes, the first byte is in the lowest bits. */
+static yy_inline uint64_t swar_load(const uint8_t *cur) {
+    uint64_t val;
+    memcpy(&val, cur, 8);
+#if !yy_little_endian
+    val = ((val & 0x00000000000000FFULL) << 56) | ((val & 0x000000000000FF00ULL) << 40) |
+          ((val & 0x0000000000FF0000ULL) << 24) | ((val & 0x00000000FF000000ULL) << 8) |
+          ((val & 0x000000FF00000000ULL) >> 8) | ((val & 0x0000FF0000000000ULL) >> 24) |
+          ((val & 0x00FF000000000000ULL) >> 40) | ((val & 0xFF00000000000000ULL) >> 56);
+#endif
+    return val;
+}
+
+/** Store 8 bytes, the lowest bits are in the first byte. */
+static yy_inline void swar_store(uint8_t *cur, uint64_t val) {
+#if !yy_little_endian
+    val = ((val & 0x00000000000000FFULL) << 56) | ((val & 0x000000000000FF00ULL) << 40) |
+          ((val & 0x0000000000FF0000ULL) << 24) | ((val & 0x00000000FF000000ULL) << 8) |
+          ((val & 0x000000FF00000000ULL) >> 8) | ((val & 0x0000FF0000000000ULL) >> 24) |
+          ((val & 0x00FF000000000000ULL) >> 40) | ((val & 0xFF00000000000000ULL) >> 56);
+#endif
+    memcpy(cur, &val, 8);
+}
+
+/** Returns the number of trailing 0-bits in value (input should not be 0). */
+static yy_inline uint32_t u64_tz_bits(uint64_t v) {
+#if yy_has_builtin(__builtin_ctzll) || defined(__GNUC__)
+    return (uint32_t)__builtin_ctzll(v);
+#else
+    uint32_t n = 0;
+    while (!(v & 1)) { v >>= 1; n++; }
+    return n;
+#endif
+}
+
+/** Returns the length of the digit run (the first non-digit byte is found
+    with a mask test on 8 bytes at a time). */
+static yy_inline size_t swar_digit_len(const uint8_t *cur) {
+    size_t len = 0;
+    while (true) {
+        /* a borrow only goes to the bytes after the first non-digit */
+        uint64_t val = swar_load(cur + len) - 0x3030303030303030ULL;
+        uint64_t bad = (val | (val + 0x7676767676767676ULL)) & 0x8080808080808080ULL;
+        if (bad) return len + u64_tz_bits(bad) / 8;
+        len += 8;
+    }
+}
+
+/** Convert the first `n` (1 to 8) digits to integer (same as `atoi_swar.c`,
+    the digits are already validated). */
+static yy_inline uint64_t swar_read_digits_8(const uint8_t *cur, size_t n) {
+    const uint64_t mask = 0x000000FF000000FFULL;
+    const uint64_t mul1 = 0x000F424000000064ULL; /* 100 + (1000000 << 32) */
+    const uint64_t mul2 = 0x0000271000000001ULL; /* 1 + (10000 << 32) */
+    uint64_t val = swar_load(cur) - 0x3030303030303030ULL;
+    val <<= (8 - n) * 8;
+    val = (val * 10) + (val >> 8);
+    val = (((val & mask) * mul1) + (((val >> 16) & mask) * mul2)) >> 32;
+    return val;
+}
+
+/** Convert `n` (0 to 18) digits to integer. */
+static yy_inline uint64_t swar_read_digits(const uint8_t *cur, size_t n) {
+    uint64_t val;
+    if (n <= 8) {
+        if (yy_unlikely(n == 0)) return 0;
+        return swar_read_digits_8(cur, n);
+    } else if (n <= 16) {
+        val = swar_read_digits_8(cur, n - 8) * 100000000;
+        return val + swar_read_digits_8(cur + n - 8, 8);
+    } else {
+        val = swar_read_digits_8(cur, n - 16) * 10000000000000000ULL;
+        val += swar_read_digits_8(cur + n - 16, 8) * 100000000;
+        return val + swar_read_digits_8(cur + n - 8, 8);
+    }
+}
+
+/** Returns true if any of the `n` digits is not '0'. */
+static yy_inline bool swar_has_nonzero(const uint8_t *cur, size_t n) {
+    for (; n >= 8; n -= 8, cur += 8) {
+        if (swar_load(cur) != 0x3030303030303030ULL) return true;
+    }
+    if (n == 0) return false;
+    return ((swar_load(cur) ^ 0x3030303030303030ULL) << ((8 - n) * 8)) != 0;
+}
+
+int64_t fixed_parse_swar(const char *str, size_t len, uint32_t scale,
+                         fixed_round mode, char **endptr, fixed_result *res) {
+    bool sign = (*str == '-');
+    const uint8_t *cur = (const uint8_t *)str + sign, *frac;
+    size_t int_len, frac_len = 0, num;
+    uint64_t ipart, fpart = 0, max, val;
+    uint32_t first = 0;
+    bool sticky = false, up;
+    atoi_result ires;
+    char *end;
+    
+    /* integer part */
+    int_len = swar_digit_len(cur);
+    ipart = atoi_u64_swar_exact((const char *)cur, int_len, &end, &ires);
+    if (yy_unlikely(ires == atoi_result_fail)) goto fail;
+    cur += int_len;
+    
+    /* fraction part: `scale` digits, the first dropped digit and the others */
+    if (*cur == '.') {
+        frac = cur + 1;
+        frac_len = swar_digit_len(frac);
+        if (yy_unlikely(frac_len == 0)) goto fail;
+        num = frac_len < scale ? frac_len : scale;
+        fpart = swar_read_digits(frac, num) * pow10_table[scale - num];
+        if (frac_len > num) {
+            first = (uint32_t)(frac[num] - '0');
+            sticky = swar_has_nonzero(frac + num + 1, frac_len - num - 1);
+        }
+        cur = frac + frac_len;
+    }
+    *endptr = (char *)cur;
+    
+    /* combine and round */
+    max = (uint64_t)INT64_MAX + sign;
+    if (yy_unlikely(ires == atoi_result_overflow ||
+                    ipart > max / pow10_table[scale])) goto overflow;
+    val = ipart * pow10_table[scale] + fpart;
+    *res = fixed_result_suc;
+    switch (mode) {
+        case fixed_round_half_even:
+            up = first > 5 || (first == 5 && (sticky || (val & 1)));
+            break;
+        case fixed_round_half_up:
+            up = first >= 5;
+            break;
+        case fixed_round_exact:
+            if (first || sticky) *res = fixed_result_inexact;
+            up = false;
+            break;
+        default:
+            up = false;
+            break;
+    }
+    val += up;
+    if (yy_unlikely(val > max)) goto overflow;
+    return sign ? (int64_t)(0 - val) : (int64_t)val;
+    
+overflow:
+    *res = fixed_result_overflow;
+    return sign ? INT64_MIN : INT64_MAX;
+    
+fail:
+    *endptr = (char *)str;
+    *res = fixed_result_fail;
+    return 0;
+}
+
+/** Convert an integer (less than 10^8) to 8 digits with leading zeros, the
+    first digit is in the lowest byte. */
+static yy_inline uint64_t swar_write_digits_8(uint32_t val) {
+    uint32_t hi = (uint32_t)(((uint64_t)val * 109951163) >> 40); /* val / 10000 */
+    uint64_t x = hi | ((uint64_t)(val - hi * 10000) << 32);      /* abcd, efgh */
+    uint64_t q = ((x * 5243) >> 19) & 0x0000007F0000007FULL;    /* ab, ef */
+    x = q | ((x - q * 100) << 16);                              /* ab, cd, ef, gh */
+    q = ((x * 103) >> 10) & 0x000F000F000F000FULL;              /* a, c, e, g */
+    x = q | ((x - q * 10) << 8);                                /* a, b, c... */
+    return x + 0x3030303030303030ULL;
+}
+
+char *fixed_format_swar(int64_t val, uint32_t scale, char *buf) {
+    uint64_t abs, ipart, fpart;
+    uint8_t *cur;
+    
+    *buf = '-';
+    buf += val < 0;
+    abs = val < 0 ? 0 - (uint64_t)val : (uint64_t)val;
+    ipart = abs / pow10_table[scale];
+    fpart = abs - ipart * pow10_table[scale];
+    buf = itoa_u64_yy(ipart, buf);
+    if (yy_unlikely(scale == 0)) {
+        *buf = '\0';
+        return buf;
+    }
+    
+    /* the fraction digits are aligned to the left (padded with zeros),
+       then stored 8 at a time: 5 with scale 2 -> "05000000" */
+    *buf = '.';
+    cur = (uint8_t *)buf + 1;
+    if (scale <= 8) {
+        fpart *= pow10_table[8 - scale];
+        swar_store(cur, swar_write_digits_8((uint32_t)fpart));
+    } else if (scale <= 16) {
+        uint64_t hi;
+        fpart *= pow10_table[16 - scale];
+        hi = fpart / 100000000;
+        swar_store(cur, swar_write_digits_8((uint32_t)hi));
+        swar_store(cur + 8, swar_write_digits_8((uint32_t)(fpart - hi * 100000000)));
+    } else {
+        uint64_t hi, mid;
+        fpart *= pow10_table[18 - scale];
+        hi = fpart / 10000000000000000ULL; /* 2 digits */
+        fpart -= hi * 10000000000000000ULL;
+        cur[0] = (uint8_t)('0' + hi / 10);
+        cur[1] = (uint8_t)('0' + hi % 10);
+        cur += 2;
+        mid = fpart / 100000000;
+        swar_store(cur, swar_write_digits_8((uint32_t)mid));
+        swar_store(cur + 8, swar_write_digits_8((uint32_t)(fpart - mid * 100000000)));
+        cur -= 2;
+    }
+    buf = (char *)cur + scale;
+    *buf = '\0';
+    return buf;
+}
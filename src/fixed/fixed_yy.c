@@ -0,0 +1,142 @@
+/*
+ Decimal fixed-point parse/format by ibireme.
+ The integer part is read by `atoi_u64_yy()` and written by `itoa_u64_yy()`,
+ the fraction digits are read up to the scale, and the remaining digits are
+ only used for rounding.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "fixed.h"
+#include "../atoi/benchmark.h"
+
+
+/* compiler builtin check (clang) */
+#ifndef yy_has_builtin
+#   ifdef __has_builtin
+#       define yy_has_builtin(x) __has_builtin(x)
+#   else
+#       define yy_has_builtin(x) 0
+#   endif
+#endif
+
+/* likely */
+#ifndef yy_likely
+#   if yy_has_builtin(__builtin_expect) || __GNUC__ >= 4
+#       define yy_likely(expr) __builtin_expect(!!(expr), 1)
+#   else
+#       define yy_likely(expr) (expr)
+#   endif
+#endif
+
+/* unlikely */
+#ifndef yy_unlikely
+#   if yy_has_builtin(__builtin_expect) || __GNUC__ >= 4
+#       define yy_unlikely(expr) __builtin_expect(!!(expr), 0)
+#   else
+#       define yy_unlikely(expr) (expr)
+#   endif
+#endif
+
+/* the digit kernels, see `atoi_yy.c` and `itoa_yy.c` */
+uint64_t atoi_u64_yy(const char *str, size_t len, char **endptr, atoi_result *res);
+char *itoa_u64_yy(uint64_t val, char *buf);
+
+static const uint64_t pow10_table[FIXED_SCALE_MAX + 1] = {
+    1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL,
+    10000000ULL, 100000000ULL, 1000000000ULL, 10000000000ULL,
+    100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+    100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,
+    100000000000000000ULL, 1000000000000000000ULL
+};
+
+int64_t fixed_parse_yy(const char *str, size_t len, uint32_t scale,
+                       fixed_round mode, char **endptr, fixed_result *res) {
+    bool sign = (*str == '-');
+    const char *cur = str + sign;
+    uint64_t ipart, fpart = 0, add, max, val;
+    uint32_t num = 0, first = 0;
+    bool sticky = false, up;
+    atoi_result ires;
+    char *end;
+    
+    /* integer part */
+    ipart = atoi_u64_yy(cur, len - sign, &end, &ires);
+    if (yy_unlikely(ires == atoi_result_fail)) goto fail;
+    cur = end;
+    
+    /* fraction part: `scale` digits, the first dropped digit and the others */
+    if (*cur == '.') {
+        cur++;
+        if (yy_unlikely((uint8_t)(*cur - '0') > 9)) goto fail;
+        while (num < scale && (add = (uint64_t)(uint8_t)(*cur - '0')) <= 9) {
+            fpart = fpart * 10 + add;
+            num++;
+            cur++;
+        }
+        if ((first = (uint32_t)(uint8_t)(*cur - '0')) <= 9) {
+            cur++;
+            while ((uint8_t)(*cur - '0') <= 9) sticky |= (*cur++ != '0');
+        } else {
+            first = 0;
+        }
+    }
+    fpart *= pow10_table[scale - num];
+    *endptr = (char *)cur;
+    
+    /* combine and round */
+    max = (uint64_t)INT64_MAX + sign;
+    if (yy_unlikely(ires == atoi_result_overflow ||
+                    ipart > max / pow10_table[scale])) goto overflow;
+    val = ipart * pow10_table[scale] + fpart;
+    *res = fixed_result_suc;
+    switch (mode) {
+        case fixed_round_half_even:
+            up = first > 5 || (first == 5 && (sticky || (val & 1)));
+            break;
+        case fixed_round_half_up:
+            up = first >= 5;
+            break;
+        case fixed_round_exact:
+            if (first || sticky) *res = fixed_result_inexact;
+            up = false;
+            break;
+        default:
+            up = false;
+            break;
+    }
+    val += up;
+    if (yy_unlikely(val > max)) goto overflow;
+    return sign ? (int64_t)(0 - val) : (int64_t)val;
+    
+overflow:
+    *res = fixed_result_overflow;
+    return sign ? INT64_MIN : INT64_MAX;
+    
+fail:
+    *endptr = (char *)str;
+    *res = fixed_result_fail;
+    return 0;
+}
+
+char *fixed_format_yy(int64_t val, uint32_t scale, char *buf) {
+    uint64_t abs, ipart, fpart;
+    
+    *buf = '-';
+    buf += val < 0;
+    abs = val < 0 ? 0 - (uint64_t)val : (uint64_t)val;
+    ipart = abs / pow10_table[scale];
+    fpart = abs - ipart * pow10_table[scale];
+    buf = itoa_u64_yy(ipart, buf);
+    if (yy_likely(scale > 0)) {
+        /* write "1" and the fraction digits with leading zeros, then
+           overwrite the "1" with the dot: 5 -> "105" -> ".05" */
+        char *end = itoa_u64_yy(fpart + pow10_table[scale], buf);
+        *buf = '.';
+        buf = end;
+    }
+    *buf = '\0';
+    return buf;
+}
@@ -0,0 +1,407 @@
+/*
+ * Copyright (c) 2018 YaoYuan <ibireme@gmail.com>.
+ * Released under the MIT license (MIT).
+ */
+
+#include "half.h"
+#include "yybench.h"
+#include "bench_cpu.h"
+#include <inttypes.h>
+
+/*----------------------------------------------------------------------------*/
+/**
+ This benchmark writes and reads 16-bit floats (binary16 and bfloat16).
+ `widen` converts the value to double and uses the double functions, as the
+ baseline. All 65536 values of each type are verified.
+ */
+
+/** String count of each case. */
+#define HALF_SAMPLE_COUNT 10000
+
+/** Slot size of each string. */
+#define HALF_SLOT_LEN 32
+
+/** Build the shortest table of half_yy.c (not thread-safe). */
+void half_yy_init(void);
+
+
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct {
+    const char *name;
+    int man_bits;
+    int exp_bits;
+} half_type;
+
+static const half_type half_type_arr[] = {
+    { "binary16", 10, 5 },
+    { "bfloat16", 7, 8 },
+};
+static const int half_type_num = (int)(sizeof(half_type_arr) / sizeof(half_type));
+
+typedef struct {
+    half_to_str_func to_str[2]; /* binary16, bfloat16 */
+    half_from_str_func from_str[2];
+    const char *name;
+    bool exact; /* shortest output, correctly rounded input */
+} half_group;
+
+static int half_group_num = 0;
+static half_group half_group_arr[16];
+static int half_group_name_max = 0;
+
+static char *half_group_get_name_aligned(half_group group) {
+    static char buf[64];
+    int len = (int)strlen(group.name);
+    int space = half_group_name_max - len;
+    memcpy(buf, group.name, len);
+    for (int i = 0; i < space; i++) buf[len + i] = ' ';
+    buf[half_group_name_max] = '\0';
+    return buf;
+}
+
+/** The exponent field is all ones (inf or nan). */
+static bool half_is_special(u16 bits, half_type type) {
+    u32 exp_all = (1u << type.exp_bits) - 1;
+    return ((bits >> type.man_bits) & exp_all) == exp_all;
+}
+
+static bool half_is_nan(u16 bits, half_type type) {
+    return half_is_special(bits, type) && (bits & ((1u << type.man_bits) - 1));
+}
+
+/** Convert 16-bit float to double (exact, finite only). */
+static f64 half_to_f64(u16 bits, half_type type) {
+    i32 bias = (1 << (type.exp_bits - 1)) - 1;
+    u32 man = bits & ((1u << type.man_bits) - 1);
+    u32 exp = (bits >> type.man_bits) & ((1u << type.exp_bits) - 1);
+    f64 val = (f64)(exp ? (man | (1u << type.man_bits)) : man);
+    val = ldexp(val, (exp ? (i32)exp : 1) - bias - type.man_bits);
+    return (bits >> 15) ? -val : val;
+}
+
+/** Returns the significant digit count of a decimal string (such as 1.25e-5). */
+static int dec_digit_count(const char *str) {
+    const char *cur = str, *first = NULL, *last = NULL;
+    for (; *cur && *cur != 'e' && *cur != 'E'; cur++) {
+        if (*cur < '1' || *cur > '9') continue;
+        if (!first) first = cur;
+        last = cur;
+    }
+    if (!first) return 0;
+    int count = 0;
+    for (cur = first; cur <= last; cur++) count += (*cur != '.');
+    return count;
+}
+
+
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct {
+    const char *name;
+    const char *desc;
+    u32 exp_lo; /* exponent field range */
+    u32 exp_hi;
+} dataset_t;
+
+static dataset_t dataset_arr[] = {
+    { "random", "random finite values", 0, 0 },
+    { "weights", "values in (-1, 1) with exponent above 2^-8 (such as neural network weights)", 1, 8 },
+};
+static const int dataset_num = (int)(sizeof(dataset_arr) / sizeof(dataset_t));
+
+/** Fill random 16-bit values of the dataset. */
+static void fill_half_random(u16 *vals, u32 count, half_type type, dataset_t dataset) {
+    u32 bias = (1u << (type.exp_bits - 1)) - 1;
+    for (u32 i = 0; i < count; i++) {
+        u16 bits;
+        if (dataset.exp_hi == 0) {
+            do {
+                bits = (u16)yy_random32();
+            } while (half_is_special(bits, type));
+        } else {
+            u32 exp = bias - yy_random32_range(dataset.exp_lo, dataset.exp_hi);
+            u32 man = yy_random32_uniform(1u << type.man_bits);
+            bits = (u16)((yy_random32_uniform(2) << 15) | (exp << type.man_bits) | man);
+        }
+        vals[i] = bits;
+    }
+}
+
+
+
+/*----------------------------------------------------------------------------*/
+
+static void half_group_verify_all(void) {
+    half_group ref = half_group_arr[0]; /* yy */
+
+    for (int g = 0; g < half_group_num; g++) {
+        half_group group = half_group_arr[g];
+        int trip_err = 0, short_err = 0, tie_err = 0;
+
+        for (int t = 0; t < half_type_num; t++) {
+            half_type type = half_type_arr[t];
+            half_to_str_func to_str = group.to_str[t];
+            half_from_str_func from_str = group.from_str[t];
+            half_from_str_func ref_from_str = ref.from_str[t];
+            u16 inf = (u16)(((1u << type.exp_bits) - 1) << type.man_bits);
+
+            /* all values: read back as the same value, and the shortest */
+            for (u32 i = 0; i <= 0xFFFF; i++) {
+                u16 bits = (u16)i;
+                char str[HALF_SLOT_LEN], *end;
+                char *str_end = to_str(bits, str);
+                if (str_end != str + strlen(str)) {
+                    trip_err++;
+                    continue;
+                }
+                u16 back = from_str(str, strlen(str), &end);
+                if (half_is_nan(bits, type) ? !half_is_nan(back, type) : back != bits) {
+                    if (trip_err++ < 4 && group.exact) {
+                        printf("%s_%s round trip fail, bits:0x%04X, str:%s, read:0x%04X\n",
+                               type.name, group.name, (int)bits, str, (int)back);
+                    }
+                }
+                if (half_is_special(bits, type) || (bits & 0x7FFF) == 0) continue;
+
+                /* no shorter decimal (nearest or the neighbors) reads back */
+                int digits = dec_digit_count(str);
+                for (int n = 1; n < digits; n++) {
+                    char tmp[HALF_SLOT_LEN * 4];
+                    snprintf(tmp, sizeof(tmp), "%.*e", n - 1, half_to_f64(bits, type));
+                    char *e = strchr(tmp, 'e');
+                    int exp10 = atoi(e + 1) - (n - 1);
+                    u64 sig = 0;
+                    for (char *c = tmp; c < e; c++) {
+                        if (*c >= '0' && *c <= '9') sig = sig * 10 + (u64)(*c - '0');
+                    }
+                    for (int k = -1; k <= 1; k++) {
+                        snprintf(tmp, sizeof(tmp), "%s%" PRIu64 "e%d",
+                                 (bits >> 15) ? "-" : "", sig + (u64)(i64)k, exp10);
+                        if (ref_from_str(tmp, strlen(tmp), &end) == bits) {
+                            if (short_err++ < 4 && group.exact) {
+                                printf("%s_%s not shortest, bits:0x%04X, str:%s, shorter:%s\n",
+                                       type.name, group.name, (int)bits, str, tmp);
+                            }
+                            n = digits;
+                            break;
+                        }
+                    }
+                }
+            }
+
+            /* exact halfway points between two adjacent values (and the inf) */
+            for (u16 bits = 0; bits < inf; bits++) {
+                f64 lo = half_to_f64(bits, type);
+                f64 hi = (u16)(bits + 1) < inf ? half_to_f64((u16)(bits + 1), type) :
+                         lo + (lo - half_to_f64((u16)(bits - 1), type));
+                f64 mid = lo + (hi - lo) / 2; /* exact in double */
+                char tie[256], str[256], *end;
+                snprintf(tie, sizeof(tie), "%.120e", mid);
+                char *e = strchr(tie, 'e');
+                char *last = e - 1;
+                while (*last == '0') last--;
+                if (*last == '.') last++; /* keep one fraction digit: 5.0e+04 */
+                usize mant_len = (usize)(last + 1 - tie);
+                u16 even = (bits & 1) ? (u16)(bits + 1) : bits;
+
+                for (int k = 0; k < 3; k++) {
+                    u16 expect;
+                    memcpy(str + 1, tie, mant_len);
+                    char *cur = str + 1 + mant_len;
+                    if (k == 0) { /* tie: to even */
+                        expect = even;
+                    } else if (k == 1) { /* a bit above: up */
+                        memcpy(cur, "0001", 4);
+                        cur += 4;
+                        expect = (u16)(bits + 1);
+                    } else { /* a bit below: down */
+                        char *dec = cur - 1;
+                        for (; *dec == '0' || *dec == '.'; dec--) {
+                            if (*dec == '0') *dec = '9';
+                        }
+                        (*dec)--;
+                        memcpy(cur, "9999", 4);
+                        cur += 4;
+                        expect = bits;
+                    }
+                    strcpy(cur, e);
+                    str[0] = '-';
+                    for (int s = 0; s < 2; s++) {
+                        const char *in = s ? str : str + 1;
+                        u16 val = from_str(in, strlen(in), &end);
+                        u16 exp_val = (u16)(expect | (s << 15));
+                        if (val != exp_val) {
+                            if (tie_err++ < 4 && group.exact) {
+                                printf("%s_%s halfway fail, input:%s, expect:0x%04X, read:0x%04X\n",
+                                       type.name, group.name, in, (int)exp_val, (int)val);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        if (group.exact) {
+            printf("verify %s [%s]\n", half_group_get_name_aligned(group),
+                   (trip_err || short_err || tie_err) ? "FAIL" : "OK");
+        } else {
+            printf("verify %s [round trip:%d, not shortest:%d, halfway:%d]\n",
+                   half_group_get_name_aligned(group), trip_err, short_err, tie_err);
+        }
+    }
+}
+
+
+
+/*----------------------------------------------------------------------------*/
+
+static void half_group_benchmark_all(const char *output_path) {
+    static const int repeat_count = 64;
+
+    printf("initialize...\n");
+    bench_cpu_setup();
+
+    char *buf = malloc((usize)HALF_SAMPLE_COUNT * HALF_SLOT_LEN);
+    u32 *lens = malloc(HALF_SAMPLE_COUNT * sizeof(u32));
+    u16 *vals = malloc(HALF_SAMPLE_COUNT * sizeof(u16));
+    if (!buf || !lens || !vals) {
+        printf("memory allocation failed.\n");
+        free(buf);
+        free(lens);
+        free(vals);
+        return;
+    }
+
+    yy_report *report = yy_report_new();
+    bench_report_add_env_info(report);
+
+    for (int t = 0; t < half_type_num; t++) {
+        half_type type = half_type_arr[t];
+        for (int d = 0; d < dataset_num; d++) {
+            dataset_t dataset = dataset_arr[d];
+            printf("run benchmark %s %s...", type.name, dataset.name);
+
+            /* the values, and the strings written by yy */
+            yy_random_reset();
+            fill_half_random(vals, HALF_SAMPLE_COUNT, type, dataset);
+            memset(buf, 0, (usize)HALF_SAMPLE_COUNT * HALF_SLOT_LEN);
+            for (u32 s = 0; s < HALF_SAMPLE_COUNT; s++) {
+                char *str = buf + (usize)s * HALF_SLOT_LEN;
+                lens[s] = (u32)(half_group_arr[0].to_str[t](vals[s], str) - str);
+            }
+
+            for (int c = 0; c < 2; c++) {
+                bool is_write = (c == 0);
+                char title[128];
+                snprintf(title, sizeof(title), "%s %s (%s)", type.name,
+                         is_write ? "to string" : "from string", dataset.name);
+
+                yy_chart *chart = yy_chart_new();
+                yy_chart_options op;
+                yy_chart_options_init(&op);
+                op.title = title;
+                op.subtitle = dataset.desc;
+                op.type = YY_CHART_BAR;
+                op.h_axis.title = "average CPU cycles";
+                op.plot.value_labels_enabled = true;
+                op.plot.value_labels_decimals = 2;
+                op.plot.color_by_point = true;
+                op.plot.group_padding = 0.0f;
+                op.plot.point_padding = 0.1f;
+                op.plot.border_width = 0.0f;
+                op.legend.enabled = false;
+                op.tooltip.value_decimals = 2;
+                op.width = 640;
+                op.height = 240;
+
+                for (int g = 0; g < half_group_num; g++) {
+                    half_group group = half_group_arr[g];
+                    half_to_str_func to_str = group.to_str[t];
+                    half_from_str_func from_str = group.from_str[t];
+                    char out[HALF_SLOT_LEN];
+                    char *end;
+                    u64 ticks_min;
+                    for (int retry = 0; ; retry++) {
+                        ticks_min = UINT64_MAX;
+                        for (int r = 0; r < repeat_count; r++) {
+                            u64 t1 = yy_time_get_ticks();
+                            if (is_write) {
+                                for (u32 s = 0; s < HALF_SAMPLE_COUNT; s++) {
+                                    to_str(vals[s], out);
+                                }
+                            } else {
+                                for (u32 s = 0; s < HALF_SAMPLE_COUNT; s++) {
+                                    from_str(buf + (usize)s * HALF_SLOT_LEN, lens[s], &end);
+                                }
+                            }
+                            u64 t2 = yy_time_get_ticks();
+                            u64 t = t2 - t1;
+                            if (t < ticks_min) ticks_min = t;
+                        }
+                        if (bench_cpu_check_freq(retry)) break;
+                    }
+                    f64 cycles = (f64)ticks_min / HALF_SAMPLE_COUNT * bench_cpu_get_cycle_per_tick();
+                    yy_chart_item_with_float(chart, group.name, (f32)cycles);
+                }
+                yy_chart_sort_items_with_value(chart, false);
+                yy_chart_set_options(chart, &op);
+                yy_report_add_chart(report, chart);
+                yy_chart_free(chart);
+            }
+            printf("[OK]\n");
+        }
+    }
+
+    bench_report_add_drift_info(report);
+    if (!yy_report_write_html_file(report, output_path)) {
+        printf("[ERROR] report write failed: %s\n", output_path);
+    } else {
+        printf("report generated: %s\n", output_path);
+    }
+    yy_report_free(report);
+    free(buf);
+    free(lens);
+    free(vals);
+}
+
+
+
+/*----------------------------------------------------------------------------*/
+
+static void half_group_cleanup(void) {
+    half_group_num = 0;
+    half_group_name_max = 0;
+}
+
+static void half_group_register_all(void) {
+#define register_group_name(_name, _exact) \
+    extern char *f16_to_str_##_name(uint16_t bits, char *buf); \
+    extern char *bf16_to_str_##_name(uint16_t bits, char *buf); \
+    extern uint16_t str_to_f16_##_name(const char *str, size_t len, char **endptr); \
+    extern uint16_t str_to_bf16_##_name(const char *str, size_t len, char **endptr); \
+    half_group_arr[half_group_num].name = #_name; \
+    half_group_arr[half_group_num].to_str[0] = f16_to_str_##_name; \
+    half_group_arr[half_group_num].to_str[1] = bf16_to_str_##_name; \
+    half_group_arr[half_group_num].from_str[0] = str_to_f16_##_name; \
+    half_group_arr[half_group_num].from_str[1] = str_to_bf16_##_name; \
+    half_group_arr[half_group_num].exact = _exact; \
+    if (half_group_name_max < (int)strlen(#_name)) half_group_name_max = (int)strlen(#_name); \
+    half_group_num++;
+
+    register_group_name(yy, true); /* the first one is used as reference */
+    register_group_name(widen, false); /* through double */
+}
+
+void benchmark(const char *output_path) {
+    half_group_register_all();
+    half_yy_init();
+    printf("------[verify]---------\n");
+    half_group_verify_all();
+    printf("------[benchmark]------\n");
+    half_group_benchmark_all(output_path);
+    printf("------[finish]---------\n");
+    half_group_cleanup();
+}
@@ -0,0 +1,30 @@
+#ifndef half_h
+#define half_h
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ 16-bit floating point number to/from string.
+ 
+ binary16 (IEEE 754 half): 1 sign bit, 5 exponent bits, 10 fraction bits.
+ bfloat16 (brain float): 1 sign bit, 8 exponent bits, 7 fraction bits (the
+ high 16 bits of a float).
+ 
+ The number is passed as raw bits. The string format is the same as `dtoa_yy`
+ (such as 0.1, 1.0, -6e-8, NaN, Infinity), but the digits are the shortest
+ which read back as the same 16-bit value. The string is null-terminated, the
+ buffer should be at least 32 bytes.
+ 
+ The reader accepts the same grammar as `yy_string_to_double()`, the result
+ is correctly rounded to the 16-bit type (round to nearest, ties to even).
+ */
+
+/** Write a 16-bit float (raw bits) as string, returns the end of string. */
+typedef char *(*half_to_str_func)(uint16_t bits, char *buf);
+
+/** Read a string as 16-bit float (raw bits), `len` is the string length (the
+    string is also null-terminated), `endptr` is `str` if failed. */
+typedef uint16_t (*half_from_str_func)(const char *str, size_t len, char **endptr);
+
+#endif /* half_h */
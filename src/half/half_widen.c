@@ -0,0 +1,116 @@
+/*
+ 16-bit float (binary16, bfloat16) to/from string through double.
+
+ Format: the value is widened to double, and written by yy_double. The output
+ is the shortest for double, which is often longer than needed for 16-bit,
+ such as 0.0999755859375 (0.1 in binary16).
+
+ Parse: the string is read as double by yy_double, then rounded to 16 bits.
+ The double rounding may be wrong if the double is exactly halfway between
+ two 16-bit values.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include "yy_double.h"
+
+/* The fraction and exponent bits of each type. */
+#define F16_MAN_BITS 10
+#define F16_EXP_BITS 5
+#define BF16_MAN_BITS 7
+#define BF16_EXP_BITS 8
+
+/** Convert 16-bit float to double (exact). */
+static double half_to_f64(uint16_t bits, int man_bits, int exp_bits) {
+    int32_t bias = (1 << (exp_bits - 1)) - 1;
+    uint32_t man = bits & ((1u << man_bits) - 1);
+    uint32_t exp = (bits >> man_bits) & ((1u << exp_bits) - 1);
+    uint64_t raw = (uint64_t)(bits >> 15) << 63;
+    double val;
+
+    if (exp == (1u << exp_bits) - 1) { /* inf or nan */
+        raw |= 0x7FF0000000000000ULL | ((uint64_t)man << (52 - man_bits));
+    } else if (exp) { /* normal */
+        raw |= ((uint64_t)(exp - bias + 1023) << 52) | ((uint64_t)man << (52 - man_bits));
+    } else if (man) { /* subnormal */
+        int32_t e = 1 - bias;
+        while (!(man & (1u << man_bits))) {
+            man <<= 1;
+            e--;
+        }
+        man &= (1u << man_bits) - 1;
+        raw |= ((uint64_t)(e + 1023) << 52) | ((uint64_t)man << (52 - man_bits));
+    }
+    memcpy(&val, &raw, 8);
+    return val;
+}
+
+/** Round double to 16-bit float (to nearest, ties to even). */
+static uint16_t f64_to_half(double val, int man_bits, int exp_bits) {
+    int32_t bias = (1 << (exp_bits - 1)) - 1;
+    int32_t emin = 1 - bias;
+    uint32_t exp_all = (1u << exp_bits) - 1;
+    uint64_t raw, sig, rnd = 0, dropped, half;
+    uint16_t sign;
+    int32_t exp_raw, ulp, shift;
+
+    memcpy(&raw, &val, 8);
+    sign = (uint16_t)((raw >> 63) << 15);
+    exp_raw = (int32_t)((raw >> 52) & 0x7FF);
+    sig = raw & 0x000FFFFFFFFFFFFFULL;
+
+    if (exp_raw == 0x7FF) { /* inf or nan (quiet) */
+        return (uint16_t)(sign | (exp_all << man_bits) | (sig ? (1u << (man_bits - 1)) : 0));
+    }
+    if (exp_raw == 0) return sign;
+
+    sig |= (uint64_t)1 << 52;
+    ulp = (exp_raw - 1023 > emin ? exp_raw - 1023 : emin) - man_bits;
+    shift = ulp - (exp_raw - 1075);
+    if (shift < 64) {
+        rnd = sig >> shift;
+        dropped = sig & (((uint64_t)1 << shift) - 1);
+        half = (uint64_t)1 << (shift - 1);
+        rnd += (dropped > half || (dropped == half && (rnd & 1)));
+    }
+
+    if (rnd < ((uint64_t)1 << man_bits)) return (uint16_t)(sign | rnd);
+    if (rnd == ((uint64_t)1 << (man_bits + 1))) {
+        rnd >>= 1;
+        ulp++;
+    }
+    if ((uint32_t)(ulp + man_bits + bias) >= exp_all) {
+        return (uint16_t)(sign | (exp_all << man_bits));
+    }
+    return (uint16_t)(sign | ((uint32_t)(ulp + man_bits + bias) << man_bits) |
+                      (rnd & (((uint64_t)1 << man_bits) - 1)));
+}
+
+static char *half_to_str(uint16_t bits, int man_bits, int exp_bits, char *buf) {
+    buf = yy_double_to_string(half_to_f64(bits, man_bits, exp_bits), buf);
+    *buf = '\0';
+    return buf;
+}
+
+static uint16_t str_to_half(const char *str, char **endptr, int man_bits, int exp_bits) {
+    double val = yy_string_to_double(str, endptr);
+    return f64_to_half(val, man_bits, exp_bits);
+}
+
+char *f16_to_str_widen(uint16_t bits, char *buf) {
+    return half_to_str(bits, F16_MAN_BITS, F16_EXP_BITS, buf);
+}
+
+char *bf16_to_str_widen(uint16_t bits, char *buf) {
+    return half_to_str(bits, BF16_MAN_BITS, BF16_EXP_BITS, buf);
+}
+
+uint16_t str_to_f16_widen(const char *str, size_t len, char **endptr) {
+    (void)len;
+    return str_to_half(str, endptr, F16_MAN_BITS, F16_EXP_BITS);
+}
+
+uint16_t str_to_bf16_widen(const char *str, size_t len, char **endptr) {
+    (void)len;
+    return str_to_half(str, endptr, BF16_MAN_BITS, BF16_EXP_BITS);
+}
@@ -0,0 +1,336 @@
+/*
+ 16-bit float (binary16, bfloat16) to/from string by ibireme.
+
+ Format: there are only 32768 positive values of each type, so the shortest
+ decimal (significand and exponent) of each value is kept in a table (128 KB
+ for each type). The table is built on the first call, call half_yy_init()
+ before using it in threads. The digits are written by the yy_double writer,
+ in the same format as `dtoa_yy`.
+
+ Parse: the string is read as double by yy_double (correctly rounded), then
+ the double is rounded to 16 bits. This double rounding is wrong only if the
+ double is exactly halfway between two 16-bit values (the input may be a bit
+ larger or smaller than the halfway point), so in this case the input digits
+ are compared with the exact decimal digits of the halfway point.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+#include "yy_double.h"
+
+/* The fraction and exponent bits of each type. */
+#define F16_MAN_BITS 10
+#define F16_EXP_BITS 5
+#define BF16_MAN_BITS 7
+#define BF16_EXP_BITS 8
+
+/* The max exact decimal digits of a 16-bit value or a halfway point, the
+   smallest one is 2^-134 (about 94 digits). */
+#define DIGIT_MAX 128
+
+
+
+/*==============================================================================
+ * Exact Decimal
+ *============================================================================*/
+
+/**
+ Write the exact decimal digits of `sig * 2^exp` (sig should not be 0), the
+ value is `0.d1d2d3... * 10^dp`. Returns the digit count (no leading or
+ trailing zero).
+ */
+static int exact_digits(uint64_t sig, int32_t exp, uint8_t *digits, int32_t *dp) {
+    uint8_t tmp[DIGIT_MAX]; /* little-endian */
+    int len = 0, i;
+    uint32_t mul, carry;
+    int32_t count;
+
+    while (!(sig & 1)) {
+        sig >>= 1;
+        exp++;
+    }
+    while (sig) {
+        tmp[len++] = (uint8_t)(sig % 10);
+        sig /= 10;
+    }
+
+    /* sig * 2^exp, or (sig * 5^-exp) * 10^exp */
+    mul = exp >= 0 ? 2 : 5;
+    count = exp >= 0 ? exp : -exp;
+    while (count-- > 0) {
+        carry = 0;
+        for (i = 0; i < len; i++) {
+            carry += tmp[i] * mul;
+            tmp[i] = (uint8_t)(carry % 10);
+            carry /= 10;
+        }
+        if (carry && len < DIGIT_MAX) tmp[len++] = (uint8_t)carry;
+    }
+    *dp = len + (exp < 0 ? exp : 0);
+
+    /* reverse and remove trailing zeros */
+    for (i = 0; i < len; i++) digits[i] = tmp[len - 1 - i];
+    while (len > 1 && digits[len - 1] == 0) len--;
+    return len;
+}
+
+/**
+ Compare a decimal string (finite and not zero, `end` is the ending of number)
+ with `sig * 2^exp`, the sign is ignored. Returns -1, 0 or 1.
+ */
+static int decimal_cmp(const char *str, const char *end, uint64_t sig, int32_t exp) {
+    uint8_t digits[DIGIT_MAX];
+    int32_t dp, in_dp, exp10 = 0, int_len = 0, lead_zeros = 0;
+    int len = exact_digits(sig, exp, digits, &dp), i;
+    const char *cur = str, *mant_end, *hdr;
+    bool exp_neg = false;
+
+    /* the mantissa part and the exponent part */
+    if (*cur == '-') cur++;
+    mant_end = cur;
+    while (mant_end < end && *mant_end != 'e' && *mant_end != 'E') mant_end++;
+    if (mant_end < end) {
+        const char *e = mant_end + 1;
+        exp_neg = (*e == '-');
+        e += (*e == '-' || *e == '+');
+        for (; e < end; e++) {
+            if (exp10 < 100000) exp10 = exp10 * 10 + (*e - '0');
+        }
+        if (exp_neg) exp10 = -exp10;
+    }
+
+    /* skip leading zeros: the value is `0.d1d2d3... * 10^in_dp` */
+    for (hdr = cur; hdr < mant_end && (*hdr == '0' || *hdr == '.'); hdr++) {
+        lead_zeros += (*hdr == '0');
+    }
+    while (cur < mant_end && *cur != '.') {
+        int_len++;
+        cur++;
+    }
+    in_dp = int_len + exp10 - lead_zeros;
+    if (in_dp != dp) return in_dp > dp ? 1 : -1;
+
+    /* compare the digits */
+    cur = hdr;
+    for (i = 0; i < len; i++) {
+        int d;
+        if (cur < mant_end && *cur == '.') cur++;
+        d = cur < mant_end ? (*cur++ - '0') : 0;
+        if (d != digits[i]) return d > digits[i] ? 1 : -1;
+    }
+    for (; cur < mant_end; cur++) {
+        if (*cur != '.' && *cur != '0') return 1;
+    }
+    return 0;
+}
+
+
+
+/*==============================================================================
+ * Conversion
+ *============================================================================*/
+
+/** Convert 16-bit float to double (exact). */
+static double half_to_f64(uint16_t bits, int man_bits, int exp_bits) {
+    int32_t bias = (1 << (exp_bits - 1)) - 1;
+    uint32_t man = bits & ((1u << man_bits) - 1);
+    uint32_t exp = (bits >> man_bits) & ((1u << exp_bits) - 1);
+    uint64_t raw = (uint64_t)(bits >> 15) << 63;
+    double val;
+
+    if (exp == (1u << exp_bits) - 1) { /* inf or nan */
+        raw |= 0x7FF0000000000000ULL | ((uint64_t)man << (52 - man_bits));
+    } else if (exp) { /* normal */
+        raw |= ((uint64_t)(exp - bias + 1023) << 52) | ((uint64_t)man << (52 - man_bits));
+    } else if (man) { /* subnormal */
+        int32_t e = 1 - bias;
+        while (!(man & (1u << man_bits))) {
+            man <<= 1;
+            e--;
+        }
+        man &= (1u << man_bits) - 1;
+        raw |= ((uint64_t)(e + 1023) << 52) | ((uint64_t)man << (52 - man_bits));
+    }
+    memcpy(&val, &raw, 8);
+    return val;
+}
+
+/**
+ Round double to 16-bit float (to nearest, ties to even). If the double is
+ exactly halfway, the input string is compared to decide the direction.
+ */
+static uint16_t f64_to_half(double val, const char *str, const char *end,
+                            int man_bits, int exp_bits) {
+    int32_t bias = (1 << (exp_bits - 1)) - 1;
+    int32_t emin = 1 - bias;
+    uint32_t exp_all = (1u << exp_bits) - 1;
+    uint64_t raw, sig, rnd = 0, dropped, half;
+    uint16_t sign;
+    int32_t exp_raw, exp, ulp, shift, cmp;
+
+    memcpy(&raw, &val, 8);
+    sign = (uint16_t)((raw >> 63) << 15);
+    exp_raw = (int32_t)((raw >> 52) & 0x7FF);
+    sig = raw & 0x000FFFFFFFFFFFFFULL;
+
+    if (exp_raw == 0x7FF) { /* inf or nan (quiet) */
+        return (uint16_t)(sign | (exp_all << man_bits) | (sig ? (1u << (man_bits - 1)) : 0));
+    }
+    if (exp_raw == 0) return sign; /* zero, or double subnormal (too small) */
+
+    /* the value is `sig * 2^exp`, the result is `rnd * 2^ulp` */
+    sig |= (uint64_t)1 << 52;
+    exp = exp_raw - 1075;
+    ulp = (exp_raw - 1023 > emin ? exp_raw - 1023 : emin) - man_bits;
+    shift = ulp - exp; /* at least 52 - man_bits */
+    if (shift < 64) {
+        rnd = sig >> shift;
+        dropped = sig & (((uint64_t)1 << shift) - 1);
+        half = (uint64_t)1 << (shift - 1);
+        cmp = dropped > half ? 1 : dropped < half ? -1 : 0;
+        if (cmp == 0 && str) cmp = decimal_cmp(str, end, sig, exp);
+        rnd += (cmp > 0 || (cmp == 0 && (rnd & 1)));
+    }
+
+    /* subnormal or zero */
+    if (rnd < ((uint64_t)1 << man_bits)) return (uint16_t)(sign | rnd);
+
+    /* normal, the rounding may carry to the next exponent */
+    if (rnd == ((uint64_t)1 << (man_bits + 1))) {
+        rnd >>= 1;
+        ulp++;
+    }
+    if ((uint32_t)(ulp + man_bits + bias) >= exp_all) {
+        return (uint16_t)(sign | (exp_all << man_bits)); /* inf */
+    }
+    return (uint16_t)(sign | ((uint32_t)(ulp + man_bits + bias) << man_bits) |
+                      (rnd & (((uint64_t)1 << man_bits) - 1)));
+}
+
+static uint16_t str_to_half(const char *str, char **endptr, int man_bits, int exp_bits) {
+    char *end;
+    double val = yy_string_to_double(str, &end);
+    *endptr = end;
+    if (end == str) return 0;
+    return f64_to_half(val, str, end, man_bits, exp_bits);
+}
+
+
+
+/*==============================================================================
+ * Shortest Decimal Table
+ *============================================================================*/
+
+/* The shortest decimal of each positive finite value: (sig << 8) | (exp + 128),
+   the value is `sig * 10^exp`. */
+static uint32_t f16_table[0x7C00];
+static uint32_t bf16_table[0x7F80];
+static volatile int table_ready = 0;
+
+/** Returns true if `sig * 10^exp` reads back as `bits`. */
+static bool half_dec_is_bits(uint64_t sig, int32_t exp, uint16_t bits,
+                             int man_bits, int exp_bits) {
+    char buf[48], *end;
+    snprintf(buf, sizeof(buf), "%" PRIu64 "e%d", sig, (int)exp);
+    return str_to_half(buf, &end, man_bits, exp_bits) == bits;
+}
+
+static void table_build(uint32_t *table, uint32_t count, int man_bits, int exp_bits) {
+    uint8_t digits[DIGIT_MAX];
+    uint16_t bits;
+
+    table[0] = 128; /* zero */
+    for (bits = 1; bits < count; bits++) {
+        double val = half_to_f64(bits, man_bits, exp_bits);
+        uint64_t raw, sig = 0;
+        int32_t dp, exp = 0;
+        int len, n, i;
+
+        memcpy(&raw, &val, 8);
+        len = exact_digits((raw & 0x000FFFFFFFFFFFFFULL) | ((uint64_t)1 << 52),
+                           (int32_t)((raw >> 52) & 0x7FF) - 1075, digits, &dp);
+
+        /* the n-digit numbers below and above the value: lo and lo + 1 */
+        for (n = 1; n <= len; n++) {
+            uint64_t lo = 0;
+            bool ok_lo, ok_hi;
+            for (i = 0; i < n; i++) lo = lo * 10 + digits[i];
+            exp = dp - n;
+            if (n == len) { /* exact */
+                sig = lo;
+                break;
+            }
+            ok_lo = half_dec_is_bits(lo, exp, bits, man_bits, exp_bits);
+            ok_hi = half_dec_is_bits(lo + 1, exp, bits, man_bits, exp_bits);
+            if (ok_lo && ok_hi) { /* the closer one, or the even one */
+                int first = digits[n];
+                bool gt = first > 5 || (first == 5 && len > n + 1);
+                bool eq = first == 5 && len == n + 1;
+                sig = (gt || (eq && (lo & 1))) ? lo + 1 : lo;
+                break;
+            } else if (ok_lo || ok_hi) {
+                sig = ok_lo ? lo : lo + 1;
+                break;
+            }
+        }
+        while (sig % 10 == 0) {
+            sig /= 10;
+            exp++;
+        }
+        table[bits] = (uint32_t)(sig << 8) | (uint32_t)(exp + 128);
+    }
+}
+
+void half_yy_init(void) {
+    if (table_ready) return;
+    table_build(f16_table, 0x7C00, F16_MAN_BITS, F16_EXP_BITS);
+    table_build(bf16_table, 0x7F80, BF16_MAN_BITS, BF16_EXP_BITS);
+    table_ready = 1;
+}
+
+/** Write a value with the table, inf and nan are written as `dtoa_yy`. */
+static char *half_to_str(uint16_t bits, const uint32_t *table, uint32_t count,
+                         int man_bits, char *buf) {
+    uint32_t abs = bits & 0x7FFF, entry;
+    if (!table_ready) half_yy_init();
+    if (abs >= count) {
+        if (abs & ((1u << man_bits) - 1)) {
+            memcpy(buf, "NaN", 4);
+            return buf + 3;
+        }
+        *buf = '-';
+        buf += bits >> 15;
+        memcpy(buf, "Infinity", 9);
+        return buf + 8;
+    }
+    entry = table[abs];
+    return yy_decimal_to_string_format(bits >> 15, entry >> 8, (int32_t)(entry & 0xFF) - 128,
+                                       &yy_double_format_yy, buf);
+}
+
+
+
+/*==============================================================================
+ * Functions
+ *============================================================================*/
+
+char *f16_to_str_yy(uint16_t bits, char *buf) {
+    return half_to_str(bits, f16_table, 0x7C00, F16_MAN_BITS, buf);
+}
+
+char *bf16_to_str_yy(uint16_t bits, char *buf) {
+    return half_to_str(bits, bf16_table, 0x7F80, BF16_MAN_BITS, buf);
+}
+
+uint16_t str_to_f16_yy(const char *str, size_t len, char **endptr) {
+    (void)len;
+    return str_to_half(str, endptr, F16_MAN_BITS, F16_EXP_BITS);
+}
+
+uint16_t str_to_bf16_yy(const char *str, size_t len, char **endptr) {
+    (void)len;
+    return str_to_half(str, endptr, BF16_MAN_BITS, BF16_EXP_BITS);
+}
@@ -4,6 +4,12 @@
  */
 
 #include "yybench.h"
+#include "bench_cpu.h"
+#include "bench_isolate.h"
+#include "bench_corun.h"
+#include "bench_memo.h"
+#include "bench_sample.h"
+#include "bench_direct.h"
 
 #ifndef BENCHMARK_DATA_PATH
 extern const char *benchmark_get_data_path(void);
@@ -28,6 +34,8 @@ typedef struct {
     itoa_i32_func i32_func;
     itoa_u64_func u64_func;
     itoa_i64_func i64_func;
+    bench_isolate_func u32_direct; /* direct-call loop, see ITOA_DIRECT_MEASURE */
+    bench_isolate_func u64_direct;
     const char *name;
     bool need_verify;
     bool need_benchmark;
@@ -63,10 +71,12 @@ static void itoa_group_register(itoa_group group) {
     if (itoa_ ## group_name ## _available_32) { \
         group.u32_func = itoa_u32_ ## group_name; \
         group.i32_func = itoa_i32_ ## group_name; \
+        group.u32_direct = itoa_direct_measure_u32_ ## group_name; \
     } \
     if (itoa_ ## group_name ## _available_64) { \
         group.u64_func = itoa_u64_ ## group_name; \
         group.i64_func = itoa_i64_ ## group_name; \
+        group.u64_direct = itoa_direct_measure_u64_ ## group_name; \
     } \
     if (group.u32_func || group.u64_func) { \
         itoa_group_register(group); \
@@ -94,6 +104,14 @@ static void itoa_group_register(itoa_group group) {
 } while(0)
 
 
+// returns the registered group with name, or NULL
+static const itoa_group *itoa_group_find(const char *name) {
+    for (u32 i = 0; i < itoa_group_count; i++) {
+        if (strcmp(itoa_group_array[i].name, name) == 0) return &itoa_group_array[i];
+    }
+    return NULL;
+}
+
 // returns the function name aligned (inner memory)
 static char *itoa_group_get_name_aligned(itoa_group group, bool align_right) {
     static char buf[64];
@@ -316,6 +334,511 @@ static void fill_rand_i64_len(i64 *buf, u32 count, u32 len) {
 
 
 
+/*----------------------------------------------------------------------------*/
+
+/* context of isolated measurement */
+typedef struct {
+    itoa_u32_func u32_func;
+    itoa_u64_func u64_func;
+    u32 sample_count;
+    u32 repeat_count;
+    char *out_buf;
+} itoa_isolate_ctx;
+
+/* measure a function with input data at shifted address, returns min ticks */
+#define ITOA_ISOLATE_MEASURE(type) \
+static u64 itoa_isolate_measure_ ## type(void *ctx, const void *data) { \
+    itoa_isolate_ctx *c = (itoa_isolate_ctx *)ctx; \
+    const type *in = (const type *)data; \
+    u64 tsc_min = UINT64_MAX; \
+    for (u32 j = 0; j < c->repeat_count; j++) { \
+        char *out_cur = c->out_buf; \
+        u64 tsc_begin = yy_time_get_ticks(); \
+        for (u32 s = 0; s < c->sample_count; s++) { \
+            out_cur = c->type ## _func(in[s], out_cur); \
+        } \
+        u64 tsc_end = yy_time_get_ticks(); \
+        if (tsc_end - tsc_begin < tsc_min) tsc_min = tsc_end - tsc_begin; \
+    } \
+    return tsc_min; \
+}
+
+ITOA_ISOLATE_MEASURE(u32)
+ITOA_ISOLATE_MEASURE(u64)
+
+static yy_chart *itoa_isolate_chart_new(const char *title) {
+    yy_chart *chart = yy_chart_new();
+    yy_chart_options op;
+    yy_chart_options_init(&op);
+    op.title = title;
+    op.subtitle = "median of stack/heap offset variants, "
+                  "spread: (max - min) / median";
+    op.type = YY_CHART_BAR;
+    op.h_axis.title = "average CPU cycles";
+    op.plot.value_labels_enabled = true;
+    op.plot.value_labels_decimals = 2;
+    op.plot.color_by_point = true;
+    op.plot.group_padding = 0.0f;
+    op.plot.point_padding = 0.1f;
+    op.plot.border_width = 0.0f;
+    op.legend.enabled = false;
+    op.tooltip.value_decimals = 2;
+    op.width = 640;
+    op.height = 420;
+    yy_chart_set_options(chart, &op);
+    return chart;
+}
+
+
+
+/*----------------------------------------------------------------------------*/
+
+/* the loop of direct-call measurement, `call` is a function pointer or name,
+   the loop is the same as the isolated measurement, but the output is kept
+   alive, as an inlined call may be removed otherwise */
+#define ITOA_DIRECT_LOOP(type, call) \
+    itoa_isolate_ctx *c = (itoa_isolate_ctx *)ctx; \
+    const type *in = (const type *)data; \
+    u64 tsc_min = UINT64_MAX; \
+    for (u32 j = 0; j < c->repeat_count; j++) { \
+        char *out_cur = c->out_buf; \
+        u64 tsc_begin = yy_time_get_ticks(); \
+        for (u32 s = 0; s < c->sample_count; s++) { \
+            out_cur = call(in[s], out_cur); \
+        } \
+        bench_direct_escape(out_cur); \
+        u64 tsc_end = yy_time_get_ticks(); \
+        if (tsc_end - tsc_begin < tsc_min) tsc_min = tsc_end - tsc_begin; \
+    } \
+    return tsc_min;
+
+/* measure a function through the pointer in context, returns min ticks */
+#define ITOA_INDIRECT_MEASURE(type) \
+static u64 itoa_indirect_measure_ ## type(void *ctx, const void *data) { \
+    ITOA_DIRECT_LOOP(type, c->type ## _func) \
+}
+
+/* measure a function by name, returns min ticks */
+#define ITOA_DIRECT_MEASURE(type, group_name) \
+extern char *itoa_ ## type ## _ ## group_name(type, char *); \
+static u64 itoa_direct_measure_ ## type ## _ ## group_name(void *ctx, const void *data) { \
+    ITOA_DIRECT_LOOP(type, itoa_ ## type ## _ ## group_name) \
+}
+
+#define ITOA_DIRECT_DEFINE(group_name) \
+    ITOA_DIRECT_MEASURE(u32, group_name) \
+    ITOA_DIRECT_MEASURE(u64, group_name)
+
+ITOA_INDIRECT_MEASURE(u32)
+ITOA_INDIRECT_MEASURE(u64)
+
+/* one for each group in `itoa_group_register_all()` */
+ITOA_DIRECT_DEFINE(null)
+ITOA_DIRECT_DEFINE(yy)
+ITOA_DIRECT_DEFINE(yy_largelut)
+ITOA_DIRECT_DEFINE(smalltab)
+ITOA_DIRECT_DEFINE(lut)
+ITOA_DIRECT_DEFINE(count)
+ITOA_DIRECT_DEFINE(countlut)
+ITOA_DIRECT_DEFINE(branchlut)
+ITOA_DIRECT_DEFINE(branchlut2)
+ITOA_DIRECT_DEFINE(unrolledlut)
+ITOA_DIRECT_DEFINE(naive)
+ITOA_DIRECT_DEFINE(unnamed)
+ITOA_DIRECT_DEFINE(jeaiii)
+ITOA_DIRECT_DEFINE(protobuf)
+ITOA_DIRECT_DEFINE(fmtlib)
+ITOA_DIRECT_DEFINE(jiaendu)
+ITOA_DIRECT_DEFINE(sse2)
+ITOA_DIRECT_DEFINE(an)
+ITOA_DIRECT_DEFINE(tmueller)
+ITOA_DIRECT_DEFINE(amartin)
+ITOA_DIRECT_DEFINE(amartin_ljust)
+ITOA_DIRECT_DEFINE(amartin_ljust2)
+
+
+
+/*----------------------------------------------------------------------------*/
+
+/* memoization: distinct numbers in the pool, numbers of each thread, sets of
+   the cache (4 ways, 16K entries), the pool is larger than the cache */
+#define ITOA_MEMO_POOL_COUNT 262144
+#define ITOA_MEMO_NUM 100000
+#define ITOA_MEMO_SET_COUNT 4096
+
+/* the functions used with the cache, the expect group (sprintf) is also used */
+static const char *itoa_memo_name_arr[] = { "yy", "naive" };
+
+/* thread counts of the memoization benchmark (limited by core count) */
+static const u32 itoa_memo_thread_arr[] = { 1, 2, 4, 8, 16 };
+
+/* context of memoization threads */
+typedef struct {
+    itoa_u64_func func;
+    itoa_u64_func expect;       /* not NULL to verify the output */
+    bench_memo *memo;           /* NULL to call the function directly */
+    const u64 *vals;            /* `num` numbers for each thread */
+    u32 num;
+    u32 errors[BENCH_MEMO_THREAD_MAX];
+    bench_memo_stats stats[BENCH_MEMO_THREAD_MAX];
+} itoa_memo_ctx;
+
+/* convert a number with the cache in front of the function */
+static yy_inline char *itoa_memo_u64(bench_memo *memo, itoa_u64_func func,
+                                     u64 val, char *buf, bench_memo_stats *stats) {
+    usize len = bench_memo_get(memo, val, buf, stats);
+    if (len) return buf + len;
+    char *end = func(val, buf);
+    bench_memo_put(memo, val, buf, (usize)(end - buf), stats);
+    return end;
+}
+
+static void itoa_memo_thread(void *ctx, u32 idx) {
+    itoa_memo_ctx *c = (itoa_memo_ctx *)ctx;
+    const u64 *vals = c->vals + (usize)idx * c->num;
+    bench_memo_stats stats = c->stats[idx];
+    char buf[64], buf_e[64];
+    
+    if (c->expect) {
+        u32 errors = 0;
+        for (u32 i = 0; i < c->num; i++) {
+            char *end = itoa_memo_u64(c->memo, c->func, vals[i], buf, &stats);
+            char *end_e = c->expect(vals[i], buf_e);
+            if (end - buf != end_e - buf_e ||
+                memcmp(buf, buf_e, (usize)(end - buf)) != 0) errors++;
+        }
+        c->errors[idx] = errors;
+    } else if (c->memo) {
+        for (u32 i = 0; i < c->num; i++) {
+            itoa_memo_u64(c->memo, c->func, vals[i], buf, &stats);
+        }
+    } else {
+        for (u32 i = 0; i < c->num; i++) {
+            c->func(vals[i], buf);
+        }
+    }
+    c->stats[idx] = stats;
+}
+
+/* fill `count` numbers of a value pool with Zipf distribution */
+static void itoa_memo_fill(u64 *vals, usize count, f64 s) {
+    u64 *pool = (u64 *)malloc(ITOA_MEMO_POOL_COUNT * sizeof(u64));
+    u32 *idx = (u32 *)malloc(count * sizeof(u32));
+    fill_rand_u64(pool, ITOA_MEMO_POOL_COUNT);
+    bench_memo_fill_zipf(idx, count, ITOA_MEMO_POOL_COUNT, s);
+    for (usize i = 0; i < count; i++) vals[i] = pool[idx[i]];
+    free(pool);
+    free(idx);
+}
+
+/**
+ Verify the cache: several threads share a small cache (many evictions and
+ concurrent writes), the output should be the same as the function.
+ */
+static void itoa_memo_verify(void) {
+    u32 thread_num = 4, num = 100000;
+    itoa_memo_ctx ctx = { 0 };
+    u64 *vals = (u64 *)malloc((usize)thread_num * num * sizeof(u64));
+    bench_memo *memo = bench_memo_new(16);
+    const itoa_group *group = itoa_group_find("yy");
+    
+    printf("verify memo ");
+    ctx.func = group ? group->u64_func : NULL;
+    ctx.expect = itoa_group_expect.u64_func;
+    ctx.memo = memo;
+    ctx.vals = vals;
+    ctx.num = num;
+    if (!ctx.func || !vals || !memo) {
+        printf("[ERROR]\n");
+    } else {
+        yy_random_reset();
+        itoa_memo_fill(vals, (usize)thread_num * num, 1.0);
+        u32 errors = 0;
+        if (!bench_memo_run_threads(thread_num, itoa_memo_thread, &ctx)) errors++;
+        for (u32 t = 0; t < thread_num; t++) {
+            errors += ctx.errors[t];
+            bench_memo_add_stats(memo, &ctx.stats[t]);
+        }
+        bench_memo_stats stats;
+        bench_memo_get_stats(memo, &stats);
+        printf("(yy, %u threads, hit %.1f%%) %s\n", thread_num,
+               bench_memo_stats_get_hit_rate(&stats) * 100.0,
+               errors ? "[not_match]" : "[OK]");
+    }
+    bench_memo_free(memo);
+    free(vals);
+}
+
+/**
+ Measure the functions with and without the cache on Zipf datasets, with
+ several thread counts, one line chart for each dataset.
+ */
+static void itoa_memo_benchmark(yy_report *report, u32 repeat_count) {
+    u32 num = ITOA_MEMO_NUM;
+    typedef struct {
+        const char *name;
+        const char *desc;
+        f64 s;
+    } memo_dataset;
+    memo_dataset dataset_arr[] = {
+        { "itoa u64 memo (zipf s=1.2)", "262144 distinct numbers, Zipf distribution s=1.2 (hot)", 1.2 },
+        { "itoa u64 memo (zipf s=1.0)", "262144 distinct numbers, Zipf distribution s=1.0", 1.0 },
+        { "itoa u64 memo (zipf s=0.8)", "262144 distinct numbers, Zipf distribution s=0.8", 0.8 },
+        { "itoa u64 memo (uniform)", "262144 distinct numbers, uniform distribution (cold)", 0.0 },
+    };
+    
+    /* thread counts up to the core count */
+    const char *categories[16];
+    char category_bufs[16][32];
+    u32 thread_arr[16], thread_count = 0, core_count = bench_memo_get_core_count();
+    for (u32 i = 0; i < sizeof(itoa_memo_thread_arr) / sizeof(u32); i++) {
+        u32 t = itoa_memo_thread_arr[i];
+        if (t > 1 && t > core_count) break;
+        snprintf(category_bufs[thread_count], 32, "%u thread%s", t, t > 1 ? "s" : "");
+        categories[thread_count] = category_bufs[thread_count];
+        thread_arr[thread_count++] = t;
+    }
+    categories[thread_count] = NULL;
+    
+    u32 max_threads = thread_arr[thread_count - 1];
+    u64 *vals = (u64 *)malloc((usize)max_threads * num * sizeof(u64));
+    bench_memo *memo = bench_memo_new(ITOA_MEMO_SET_COUNT);
+    if (!vals || !memo) {
+        printf("[ERROR] memo buffer creation failed\n");
+        free(vals);
+        bench_memo_free(memo);
+        return;
+    }
+    
+    for (u32 d = 0; d < sizeof(dataset_arr) / sizeof(memo_dataset); d++) {
+        memo_dataset dataset = dataset_arr[d];
+        printf("run %s\n", dataset.name);
+        yy_random_reset();
+        itoa_memo_fill(vals, (usize)max_threads * num, dataset.s);
+        
+        yy_chart *chart = yy_chart_new();
+        yy_chart_options op;
+        yy_chart_options_init(&op);
+        op.title = dataset.name;
+        op.subtitle = dataset.desc;
+        op.type = YY_CHART_LINE;
+        op.v_axis.title = "CPU cycles per number (wall time)";
+        op.h_axis.title = "thread count";
+        op.h_axis.categories = categories;
+        op.tooltip.value_decimals = 2;
+        op.tooltip.shared = true;
+        op.tooltip.crosshairs = true;
+        op.width = 800;
+        op.height = 540;
+        yy_chart_set_options(chart, &op);
+        
+        u32 func_num = sizeof(itoa_memo_name_arr) / sizeof(itoa_memo_name_arr[0]) + 1;
+        for (u32 f = 0; f < func_num * 2; f++) {
+            itoa_memo_ctx ctx = { 0 };
+            bool use_memo = (f % 2) == 1;
+            const char *func_name = f / 2 < func_num - 1 ?
+                itoa_memo_name_arr[f / 2] : itoa_group_expect.name;
+            if (f / 2 < func_num - 1) {
+                const itoa_group *found = itoa_group_find(func_name);
+                ctx.func = found ? found->u64_func : NULL;
+            } else {
+                ctx.func = itoa_group_expect.u64_func;
+            }
+            ctx.memo = use_memo ? memo : NULL;
+            ctx.vals = vals;
+            ctx.num = num;
+            if (!ctx.func) continue;
+            
+            bench_memo_stats sum = { 0 };
+            f32 cycles_arr[16];
+            for (u32 t = 0; t < thread_count; t++) {
+                u32 thread_num = thread_arr[t];
+                u64 ticks_min;
+                bench_memo_clear(memo);
+                bench_memo_run_threads(thread_num, itoa_memo_thread, &ctx); /* warm up */
+                memset(ctx.stats, 0, sizeof(ctx.stats));
+                for (int retry = 0; ; retry++) {
+                    ticks_min = UINT64_MAX;
+                    for (u32 r = 0; r < repeat_count; r++) {
+                        u64 ticks = bench_memo_run_threads(thread_num, itoa_memo_thread, &ctx);
+                        if (ticks && ticks < ticks_min) ticks_min = ticks;
+                    }
+                    if (bench_cpu_check_freq(retry)) break;
+                }
+                for (u32 i = 0; i < thread_num; i++) {
+                    sum.hit += ctx.stats[i].hit;
+                    sum.miss += ctx.stats[i].miss;
+                }
+                cycles_arr[t] = (f32)((f64)ticks_min / num * bench_cpu_get_cycle_per_tick());
+            }
+            
+            char name[64];
+            if (use_memo) {
+                snprintf(name, sizeof(name), "%s (memo, hit %.1f%%)", func_name,
+                         bench_memo_stats_get_hit_rate(&sum) * 100.0);
+            } else {
+                snprintf(name, sizeof(name), "%s", func_name);
+            }
+            yy_chart_item_begin(chart, name);
+            for (u32 t = 0; t < thread_count; t++) {
+                yy_chart_item_add_float(chart, cycles_arr[t]);
+            }
+            yy_chart_item_end(chart);
+        }
+        yy_report_add_chart(report, chart);
+        yy_chart_free(chart);
+    }
+    free(vals);
+    bench_memo_free(memo);
+}
+
+
+
+/*----------------------------------------------------------------------------*/
+
+/* the small-integer table (itoa_smalltab.c) */
+extern const char *itoa_smalltab_lookup(u32 val, size_t *len);
+extern size_t itoa_smalltab_table_size(void);
+
+/* the functions compared on small values, with the memory of their tables */
+static const char *itoa_small_name_arr[] = { "yy", "yy_largelut", "smalltab" };
+
+static usize itoa_small_table_size(const char *name) {
+    if (strcmp(name, "yy") == 0) return 200; /* 2 digits table */
+    if (strcmp(name, "yy_largelut") == 0) return 50000; /* 4 digits + lz table */
+    if (strcmp(name, "smalltab") == 0) return itoa_smalltab_table_size();
+    return 0;
+}
+
+static void fill_small_http(u32 *buf, u32 count) {
+    static const u32 codes[] = {
+        200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200,
+        201, 204, 301, 302, 304, 304, 400, 401, 403, 404, 404, 500, 502, 503
+    };
+    u32 code_count = sizeof(codes) / sizeof(codes[0]);
+    for (u32 i = 0; i < count; i++) buf[i] = codes[yy_random32_uniform(code_count)];
+}
+
+static void fill_small_index(u32 *buf, u32 count) {
+    for (u32 i = 0; i < count; i++) buf[i] = yy_random32_uniform(1024);
+}
+
+static void fill_small_counter(u32 *buf, u32 count) {
+    /* log-uniform in [0, 65535]: the bound is 2^1 to 2^16 with equal chance,
+       so each bit length (not each digit count) is about equally likely */
+    for (u32 i = 0; i < count; i++) {
+        buf[i] = yy_random32_uniform((u32)1 << yy_random32_range(1, 16));
+    }
+}
+
+static void fill_small_mixed(u32 *buf, u32 count) {
+    /* 90% counters, 10% large numbers (the table fallback) */
+    fill_small_counter(buf, count);
+    for (u32 i = 0; i < count; i++) {
+        if (yy_random32_uniform(10) == 0) buf[i] = rand_u32_len(yy_random32_range(6, 10));
+    }
+}
+
+/**
+ Measure the functions on small-value datasets, and the zero-copy lookup of
+ the small-integer table (the string is used in place, not copied).
+ */
+static void itoa_small_benchmark(yy_report *report, u32 sample_count, u32 repeat_count,
+                                 u32 *in_buf, char *out_buf) {
+    typedef void (*fill_small_func)(u32 *buf, u32 count);
+    typedef struct {
+        const char *name;
+        fill_small_func fill;
+    } small_dataset;
+    small_dataset dataset_arr[] = {
+        { "http status (200-503)", fill_small_http },
+        { "array index (0-1023)", fill_small_index },
+        { "counter (0-65535, log-uniform)", fill_small_counter },
+        { "mixed (10% larger than 65535)", fill_small_mixed },
+    };
+    const u32 dataset_count = sizeof(dataset_arr) / sizeof(small_dataset);
+    const char *categories[8];
+    for (u32 d = 0; d < dataset_count; d++) categories[d] = dataset_arr[d].name;
+    categories[dataset_count] = NULL;
+    
+    printf("run small values u32\n");
+    yy_chart *chart = yy_chart_new();
+    yy_chart_options op;
+    yy_chart_options_init(&op);
+    op.title = "itoa u32 (small values)";
+    op.subtitle = "table memory in name, zero-copy: returns the string in table without copy";
+    op.type = YY_CHART_BAR;
+    op.h_axis.title = "average CPU cycles";
+    op.v_axis.categories = categories;
+    op.plot.value_labels_enabled = true;
+    op.plot.value_labels_decimals = 2;
+    op.plot.group_padding = 0.1f;
+    op.plot.point_padding = 0.0f;
+    op.plot.border_width = 0.0f;
+    op.tooltip.value_decimals = 2;
+    op.tooltip.shared = true;
+    op.width = 800;
+    op.height = 150 + dataset_count * 90;
+    yy_chart_set_options(chart, &op);
+    
+    u32 func_num = sizeof(itoa_small_name_arr) / sizeof(itoa_small_name_arr[0]);
+    for (u32 f = 0; f <= func_num; f++) {
+        bool zero_copy = f == func_num;
+        const char *func_name = zero_copy ? "smalltab" : itoa_small_name_arr[f];
+        const itoa_group *group = itoa_group_find(func_name);
+        itoa_u32_func func = group ? group->u32_func : NULL;
+        if (!func) continue;
+        
+        char name[64];
+        usize table_size = itoa_small_table_size(func_name);
+        snprintf(name, sizeof(name), "%s%s (table %.*f KB)", func_name,
+                 zero_copy ? " zero-copy" : "", table_size < 1024 ? 1 : 0,
+                 (f64)table_size / 1024.0);
+        yy_chart_item_begin(chart, name);
+        for (u32 d = 0; d < dataset_count; d++) {
+            yy_random_reset();
+            dataset_arr[d].fill(in_buf, sample_count);
+            
+            f64 tsc_avg_min;
+            for (int retry = 0; ; retry++) {
+                tsc_avg_min = HUGE_VAL;
+                for (u32 j = 0; j < repeat_count; j++) {
+                    char *out_cur = out_buf;
+                    usize sum = 0;
+                    u64 tsc_begin = yy_time_get_ticks();
+                    if (zero_copy) {
+                        for (u32 s = 0; s < sample_count; s++) {
+                            size_t len;
+                            const char *str = itoa_smalltab_lookup(in_buf[s], &len);
+                            if (!str) { /* larger than table, convert */
+                                str = out_cur;
+                                len = (size_t)(func(in_buf[s], out_cur) - out_cur);
+                                out_cur += len;
+                            }
+                            sum += (usize)str + len;
+                        }
+                    } else {
+                        for (u32 s = 0; s < sample_count; s++) {
+                            out_cur = func(in_buf[s], out_cur);
+                        }
+                    }
+                    u64 tsc_end = yy_time_get_ticks();
+                    f64 tsc_avg = (f64)(tsc_end - tsc_begin) / sample_count;
+                    if (tsc_avg < tsc_avg_min) tsc_avg_min = tsc_avg;
+                    out_buf[0] = (char)(out_buf[0] + (char)sum); /* keep the lookups */
+                }
+                if (bench_cpu_check_freq(retry)) break;
+            }
+            yy_chart_item_add_float(chart, (float)(tsc_avg_min * bench_cpu_get_cycle_per_tick()));
+        }
+        yy_chart_item_end(chart);
+    }
+    yy_report_add_chart(report, chart);
+    yy_chart_free(chart);
+}
+
+
+
 /*----------------------------------------------------------------------------*/
 
 static void itoa_group_benchmark_all(const char *report_file_path) {
@@ -331,13 +854,11 @@ static void itoa_group_benchmark_all(const char *report_file_path) {
     static const u32 repeat_count = 32;
     
     printf("prepare...\n");
-    yy_cpu_setup_priority();
-    yy_cpu_spin(1.0);
-    yy_cpu_measure_freq();
+    bench_cpu_setup();
     
     // create report
     yy_report *report = yy_report_new();
-    yy_report_add_env_info(report);
+    bench_report_add_env_info(report);
     
     // create charts
     for (i = 0; i < chart_count; i++) {
@@ -413,25 +934,28 @@ static void itoa_group_benchmark_all(const char *report_file_path) {
             fill_rand_##type##_len((type *)in_buf, sample_count, len);          \
                                                                                 \
             /* run benchmark */                                                 \
-            tsc_avg_min = HUGE_VAL;                                             \
-            for (j = 0; j < repeat_count; j++) {                                \
-                out_cur = out_buf;                                              \
-                tsc_begin = yy_time_get_ticks();                                \
-                for (s = 0; s < sample_count; s++) {                            \
-                    out_cur = func(((type *)in_buf)[s], out_cur);               \
+            for (int retry = 0; ; retry++) {                                    \
+                tsc_avg_min = HUGE_VAL;                                         \
+                for (j = 0; j < repeat_count; j++) {                            \
+                    out_cur = out_buf;                                          \
+                    tsc_begin = yy_time_get_ticks();                            \
+                    for (s = 0; s < sample_count; s++) {                        \
+                        out_cur = func(((type *)in_buf)[s], out_cur);           \
+                    }                                                           \
+                    tsc_end = yy_time_get_ticks();                              \
+                    tsc = tsc_end - tsc_begin;                                  \
+                    tsc_avg = (double)tsc / sample_count;                       \
+                    if (tsc_avg < tsc_avg_min) tsc_avg_min = tsc_avg;           \
                 }                                                               \
-                tsc_end = yy_time_get_ticks();                                  \
-                tsc = tsc_end - tsc_begin;                                      \
-                tsc_avg = (double)tsc / sample_count;                           \
-                if (tsc_avg < tsc_avg_min) tsc_avg_min = tsc_avg;               \
+                if (bench_cpu_check_freq(retry)) break;                         \
             }                                                                   \
             tsc_avg_sum += tsc_avg_min;                                         \
-            cycles = tsc_avg_min * yy_cpu_get_cycle_per_tick();                 \
+            cycles = tsc_avg_min * bench_cpu_get_cycle_per_tick();                 \
             yy_chart_item_add_float(chart, (float)cycles);                      \
         }                                                                       \
         yy_chart_item_end(chart);                                               \
         tsc_avg_min = tsc_avg_sum / max_len;                                    \
-        cycles = tsc_avg_min * yy_cpu_get_cycle_per_tick();                     \
+        cycles = tsc_avg_min * bench_cpu_get_cycle_per_tick();                     \
     }
     
     
@@ -449,19 +973,22 @@ static void itoa_group_benchmark_all(const char *report_file_path) {
         if (!func || !group.need_benchmark) continue;                           \
                                                                                 \
         /* run benchmark */                                                     \
-        tsc_avg_min = HUGE_VAL;                                                 \
-        for (j = 0; j < repeat_count; j++) {                                    \
-            out_cur = out_buf;                                                  \
-            tsc_begin = yy_time_get_ticks();                                    \
-            for (s = 0; s < sample_count; s++) {                                \
-                out_cur = func(((type *)in_buf)[s], out_cur);                   \
+        for (int retry = 0; ; retry++) {                                        \
+            tsc_avg_min = HUGE_VAL;                                             \
+            for (j = 0; j < repeat_count; j++) {                                \
+                out_cur = out_buf;                                              \
+                tsc_begin = yy_time_get_ticks();                                \
+                for (s = 0; s < sample_count; s++) {                            \
+                    out_cur = func(((type *)in_buf)[s], out_cur);               \
+                }                                                               \
+                tsc_end = yy_time_get_ticks();                                  \
+                tsc = tsc_end - tsc_begin;                                      \
+                tsc_avg = (double)tsc / sample_count;                           \
+                if (tsc_avg < tsc_avg_min) tsc_avg_min = tsc_avg;               \
             }                                                                   \
-            tsc_end = yy_time_get_ticks();                                      \
-            tsc = tsc_end - tsc_begin;                                          \
-            tsc_avg = (double)tsc / sample_count;                               \
-            if (tsc_avg < tsc_avg_min) tsc_avg_min = tsc_avg;                   \
+            if (bench_cpu_check_freq(retry)) break;                             \
         }                                                                       \
-        cycles = tsc_avg_min * yy_cpu_get_cycle_per_tick();                     \
+        cycles = tsc_avg_min * bench_cpu_get_cycle_per_tick();                     \
         yy_chart_item_with_float(chart, group.name, (float)cycles);             \
     }
     
@@ -476,6 +1003,128 @@ static void itoa_group_benchmark_all(const char *report_file_path) {
     BENCHMARK_SEQUENTIAL(i64, 19, 6)
     BENCHMARK_RANDOM(i64, 7)
     
+    
+#define BENCHMARK_ISOLATE(type)                                                 \
+    printf("run isolated %s\n", #type);                                         \
+    yy_random_reset();                                                          \
+    fill_rand_ ## type((type *)in_buf, sample_count);                           \
+    chart = itoa_isolate_chart_new("itoa " #type " (random length, stack/heap offset spread)"); \
+                                                                                \
+    for (i = 0; i < itoa_group_count; i++) {                                    \
+        itoa_isolate_ctx ctx = { 0 };                                           \
+        bench_spread spread;                                                    \
+        char name[128];                                                         \
+        group = itoa_group_array[i];                                            \
+        ctx.type ## _func = group.type ## _func;                                \
+        ctx.sample_count = sample_count;                                        \
+        ctx.repeat_count = repeat_count;                                        \
+        ctx.out_buf = out_buf;                                                  \
+        if (!ctx.type ## _func || !group.need_benchmark) continue;              \
+                                                                                \
+        if (!bench_isolate_run(itoa_isolate_measure_ ## type, &ctx, in_buf,     \
+                               sample_count * sizeof(type), &spread)) {         \
+            printf("[ERROR] isolated run failed: %s\n", group.name);            \
+            continue;                                                           \
+        }                                                                       \
+        cycles = (f64)spread.ticks_med / sample_count * bench_cpu_get_cycle_per_tick(); \
+        snprintf(name, sizeof(name), "%s (spread %.1f%%)",                      \
+                 group.name, bench_spread_get_percent(&spread));                \
+        yy_chart_item_with_float(chart, name, (float)cycles);                   \
+    }                                                                           \
+    yy_chart_sort_items_with_value(chart, false);                               \
+    yy_report_add_chart(report, chart);                                         \
+    yy_chart_free(chart);
+    
+    
+#define BENCHMARK_CORUN(type)                                                   \
+    printf("run co-run %s\n", #type);                                           \
+    yy_random_reset();                                                          \
+    fill_rand_ ## type((type *)in_buf, sample_count);                           \
+    chart = bench_corun_chart_new("itoa " #type " (random length, co-runner slowdown)"); \
+                                                                                \
+    for (i = 0; i < itoa_group_count; i++) {                                    \
+        itoa_isolate_ctx ctx = { 0 };                                           \
+        u64 ticks_alone, ticks_corun;                                           \
+        group = itoa_group_array[i];                                            \
+        ctx.type ## _func = group.type ## _func;                                \
+        ctx.sample_count = sample_count;                                        \
+        ctx.repeat_count = repeat_count;                                        \
+        ctx.out_buf = out_buf;                                                  \
+        if (!ctx.type ## _func || !group.need_benchmark) continue;              \
+                                                                                \
+        bench_corun_run(itoa_isolate_measure_ ## type, &ctx, in_buf,            \
+                        &ticks_alone, &ticks_corun);                            \
+        bench_corun_chart_add(chart, group.name, ticks_alone, ticks_corun,      \
+                              sample_count);                                    \
+    }                                                                           \
+    yy_chart_sort_items_with_value(chart, false);                               \
+    yy_report_add_chart(report, chart);                                         \
+    yy_chart_free(chart);
+    
+    
+#define BENCHMARK_SAMPLE(type)                                                  \
+    printf("run adaptive %s\n", #type);                                         \
+    chart = bench_sample_chart_new("itoa " #type " (random length, adaptive sampling)"); \
+                                                                                \
+    for (i = 0; i < itoa_group_count; i++) {                                    \
+        itoa_isolate_ctx ctx = { 0 };                                           \
+        bench_sample res[BENCH_SAMPLE_SEED_MAX];                                \
+        int seed, seed_count = bench_sample_get_seeds();                        \
+        group = itoa_group_array[i];                                            \
+        ctx.type ## _func = group.type ## _func;                                \
+        ctx.sample_count = sample_count;                                        \
+        ctx.repeat_count = 1; /* one sample per call */                         \
+        ctx.out_buf = out_buf;                                                  \
+        if (!ctx.type ## _func || !group.need_benchmark) continue;              \
+                                                                                \
+        for (seed = 0; seed < seed_count; seed++) {                             \
+            bench_sample_seed(seed);                                            \
+            fill_rand_ ## type((type *)in_buf, sample_count);                   \
+            bench_sample_run(itoa_isolate_measure_ ## type, &ctx, in_buf,       \
+                             &res[seed]);                                       \
+        }                                                                       \
+        bench_sample_chart_add(chart, group.name, res, seed_count, sample_count); \
+    }                                                                           \
+    yy_chart_sort_items_with_value(chart, false);                               \
+    yy_report_add_chart(report, chart);                                         \
+    yy_chart_free(chart);
+    
+    
+#define BENCHMARK_DIRECT(type)                                                  \
+    printf("run direct-call %s\n", #type);                                      \
+    yy_random_reset();                                                          \
+    fill_rand_ ## type((type *)in_buf, sample_count);                           \
+                                                                                \
+    do {                                                                        \
+        const char *names[64];                                                  \
+        bench_direct res[64], base = { 0 };                                     \
+        int count = 0;                                                          \
+        for (i = 0; i < itoa_group_count; i++) {                                \
+            itoa_isolate_ctx ctx = { 0 };                                       \
+            bench_direct cur;                                                   \
+            group = itoa_group_array[i];                                        \
+            ctx.type ## _func = group.type ## _func;                            \
+            ctx.sample_count = sample_count;                                    \
+            ctx.repeat_count = repeat_count;                                    \
+            ctx.out_buf = out_buf;                                              \
+            if (!ctx.type ## _func || !group.need_benchmark) continue;          \
+                                                                                \
+            bench_direct_run(itoa_indirect_measure_ ## type,                    \
+                             group.type ## _direct, &ctx, in_buf, &cur);        \
+            if (strcmp(group.name, "null") == 0) {                              \
+                base = cur; /* the loop overhead */                             \
+            } else {                                                            \
+                names[count] = group.name;                                      \
+                res[count++] = cur;                                             \
+            }                                                                   \
+        }                                                                       \
+        chart = bench_direct_chart_new("itoa " #type " (random length, direct call)", \
+                                       names, res, count, &base, sample_count); \
+        yy_report_add_chart(report, chart);                                     \
+        yy_chart_free(chart);                                                   \
+    } while (0);
+    
+    
     for (i = 0; i < chart_count; i++) {
         yy_chart_sort_items_with_value(charts[i], false);
     }
@@ -483,6 +1132,42 @@ static void itoa_group_benchmark_all(const char *report_file_path) {
         yy_report_add_chart(report, charts[i]);
     }
     
+    /* small values: the small-integer table and its zero-copy lookup */
+    itoa_small_benchmark(report, sample_count, repeat_count, (u32 *)in_buf, out_buf);
+    
+    /* memoization: a shared cache in front of the functions (zipf datasets) */
+    itoa_memo_benchmark(report, repeat_count / 4);
+    
+    /* isolated mode: run each function with several stack/heap offsets */
+    if (bench_isolate_get_variants()) {
+        BENCHMARK_ISOLATE(u32)
+        BENCHMARK_ISOLATE(u64)
+    }
+    
+    /* adaptive sampling mode: run each function with several dataset seeds */
+    if (bench_sample_get_seeds()) {
+        BENCHMARK_SAMPLE(u32)
+        BENCHMARK_SAMPLE(u64)
+        bench_report_add_sample_info(report);
+    }
+    
+    /* direct-call mode: run each function with a loop calling it by name */
+    if (bench_direct_get_enabled()) {
+        BENCHMARK_DIRECT(u32)
+        BENCHMARK_DIRECT(u64)
+        bench_report_add_direct_info(report);
+    }
+    
+    /* co-run mode: run each function with an antagonist on the sibling core */
+    if (bench_corun_start()) {
+        BENCHMARK_CORUN(u32)
+        BENCHMARK_CORUN(u64)
+        bench_report_add_corun_info(report);
+        bench_corun_stop();
+    }
+    
+    bench_report_add_drift_info(report);
+    
     if (!yy_report_write_html_file(report, report_file_path)) {
         printf("[ERROR] report write failed: %s\n", report_file_path);
     } else {
@@ -502,6 +1187,7 @@ static void itoa_group_register_all(void) {
     
     GROUP_REGISTER(yy);
     GROUP_REGISTER(yy_largelut);
+    GROUP_REGISTER(smalltab);
     GROUP_REGISTER(lut);
     GROUP_REGISTER(count);
     GROUP_REGISTER(countlut);
@@ -526,6 +1212,7 @@ void benchmark(const char *output_file_path) {
     itoa_group_register_all();
     printf("------[verify]---------\n");
     itoa_group_verify_all();
+    itoa_memo_verify();
     printf("------[benchmark]------\n");
     itoa_group_benchmark_all(output_file_path);
     printf("------[finish]---------\n");
@@ -0,0 +1,186 @@
+/*
+ * Integer to ascii conversion with a table of small integers (ANSI C)
+ *
+ * Description
+ *     Most integers printed in practice are small (counters, status codes,
+ *     array indices...). This itoa implementation pre-renders the strings of
+ *     0 to ITOA_SMALLTAB_MAX into a contiguous table, each string is stored
+ *     in a fixed-size slot with its length, 8 slots per cache line (16 bytes
+ *     per slot if ITOA_SMALLTAB_MAX has more than 7 digits). A small value is
+ *     a single 8-byte copy, the larger values fall back to itoa_yy.c.
+ *
+ *     The table of 0 to 65535 (default) takes 512 KB. It is filled on the
+ *     first call, call itoa_smalltab_init() before using it in threads.
+ *
+ *     itoa_smalltab_lookup() returns the string in the table directly, so
+ *     that the caller (such as a writer with iovec) can avoid the copy.
+ *
+ * Parameters
+ *     val: Value to be converted.
+ *     buf: Buffer that holds the result of the conversion.
+ *
+ * Return Value
+ *     A pointer to the end of resulting string.
+ *
+ * Notice
+ *     The resulting string is not null-terminated.
+ *     The buffer should be large enough to hold any possible result:
+ *         uint32_t: 10 bytes
+ *         uint64_t: 20 bytes
+ *         int32_t: 11 bytes
+ *         int64_t: 20 bytes
+ *
+ * Copyright (c) 2018 YaoYuan <ibireme@gmail.com>.
+ * Released under the MIT license (MIT).
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#if defined(__has_attribute)
+#   define yy_attribute(x) __has_attribute(x)
+#else
+#   define yy_attribute(x) 0
+#endif
+
+#if !defined(force_inline)
+#   if yy_attribute(always_inline) || (defined(__GNUC__) && __GNUC__ >= 4)
+#       define force_inline __inline__ __attribute__((always_inline))
+#   elif defined(__clang__) || defined(__GNUC__)
+#       define force_inline __inline__
+#   elif defined(_MSC_VER) && _MSC_VER >= 1200
+#       define force_inline __forceinline
+#   elif defined(_MSC_VER)
+#       define force_inline __inline
+#   elif defined(__cplusplus) || (defined(__STDC__) && __STDC__ && \
+        defined(__STDC_VERSION__) && __STDC_VERSION__ >= 199901L)
+#       define force_inline inline
+#   else
+#       define force_inline
+#   endif
+#endif
+
+#if !defined(table_align)
+#   if yy_attribute(aligned) || defined(__GNUC__)
+#       define table_align(x) __attribute__((aligned(x)))
+#   elif defined(_MSC_VER)
+#       define table_align(x) __declspec(align(x))
+#   else
+#       define table_align(x)
+#   endif
+#endif
+
+#if !defined(likely)
+#   if defined(__GNUC__) || defined(__clang__)
+#       define likely(x) __builtin_expect(!!(x), 1)
+#   else
+#       define likely(x) (x)
+#   endif
+#endif
+
+/* The max value in table, can be changed at build time (up to 4294967294). */
+#ifndef ITOA_SMALLTAB_MAX
+#   define ITOA_SMALLTAB_MAX 65535
+#endif
+
+/* The slot size: the digits and the length in the last byte. */
+#if ITOA_SMALLTAB_MAX <= 9999999
+#   define SLOT_SIZE 8
+#else
+#   define SLOT_SIZE 16
+#endif
+
+#define SLOT_COUNT ((size_t)ITOA_SMALLTAB_MAX + 1)
+
+/* Fallback for the values larger than ITOA_SMALLTAB_MAX (itoa_yy.c). */
+char *itoa_u32_yy(uint32_t val, char *buf);
+char *itoa_u64_yy(uint64_t val, char *buf);
+
+/* Slots of 0...ITOA_SMALLTAB_MAX: { "0\0\0\0\0\0\0\1", "1\0\0\0\0\0\0\1", ... } */
+table_align(64)
+static char slot_table[SLOT_COUNT * SLOT_SIZE];
+static volatile int slot_table_ready = 0;
+
+void itoa_smalltab_init(void) {
+    if (slot_table_ready) return;
+    for (size_t i = 0; i < SLOT_COUNT; i++) {
+        char *slot = slot_table + i * SLOT_SIZE;
+        char *end = itoa_u32_yy((uint32_t)i, slot);
+        slot[SLOT_SIZE - 1] = (char)(end - slot);
+    }
+    slot_table_ready = 1;
+}
+
+/** Returns the memory size of the table in bytes. */
+size_t itoa_smalltab_table_size(void) {
+    return sizeof(slot_table);
+}
+
+/**
+ Returns the string of a value in table (not null-terminated), and writes the
+ string length to `len`. Returns NULL if the value is larger than
+ ITOA_SMALLTAB_MAX.
+ */
+const char *itoa_smalltab_lookup(uint32_t val, size_t *len) {
+    const char *slot;
+    if (!likely(slot_table_ready)) itoa_smalltab_init();
+    if (val > ITOA_SMALLTAB_MAX) return NULL;
+    slot = slot_table + (size_t)val * SLOT_SIZE;
+    *len = (size_t)(uint8_t)slot[SLOT_SIZE - 1];
+    return slot;
+}
+
+static force_inline char *itoa_small_impl(uint32_t val, char *buf) {
+    const char *slot = slot_table + (size_t)val * SLOT_SIZE;
+    size_t len = (size_t)(uint8_t)slot[SLOT_SIZE - 1];
+#if SLOT_SIZE == 8
+    memcpy(buf, slot, 8); /* the bytes after the length are not used */
+#else
+    memcpy(buf, slot, len);
+#endif
+    return buf + len;
+}
+
+static force_inline char *itoa_u32_impl(uint32_t val, char *buf) {
+    if (!likely(slot_table_ready)) itoa_smalltab_init();
+    if (likely(val <= ITOA_SMALLTAB_MAX)) return itoa_small_impl(val, buf);
+    return itoa_u32_yy(val, buf);
+}
+
+static force_inline char *itoa_u64_impl(uint64_t val, char *buf) {
+    if (!likely(slot_table_ready)) itoa_smalltab_init();
+    if (likely(val <= ITOA_SMALLTAB_MAX)) return itoa_small_impl((uint32_t)val, buf);
+    return itoa_u64_yy(val, buf);
+}
+
+
+
+char *itoa_u32_smalltab(uint32_t val, char *buf) {
+    return itoa_u32_impl(val, buf);
+}
+
+char *itoa_i32_smalltab(int32_t val, char *buf) {
+    uint32_t pos = (uint32_t)val;
+    uint32_t neg = ~pos + 1;
+    size_t sign = val < 0;
+    *buf = '-';
+    return itoa_u32_impl(sign ? neg : pos, buf + sign);
+}
+
+char *itoa_u64_smalltab(uint64_t val, char *buf) {
+    return itoa_u64_impl(val, buf);
+}
+
+char *itoa_i64_smalltab(int64_t val, char *buf) {
+    uint64_t pos = (uint64_t)val;
+    uint64_t neg = ~pos + 1;
+    size_t sign = val < 0;
+    *buf = '-';
+    return itoa_u64_impl(sign ? neg : pos, buf + sign);
+}
+
+
+/* benckmark config */
+int itoa_smalltab_available_32 = 1;
+int itoa_smalltab_available_64 = 1;
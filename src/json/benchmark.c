@@ -0,0 +1,873 @@
+/*
+ * Copyright (c) 2018 YaoYuan <ibireme@gmail.com>.
+ * Released under the MIT license (MIT).
+ */
+
+#include "benchmark_helper.h"
+#include "../atoi/benchmark.h"
+#include "../dtoa/dtoa_funcs.h"
+#include "../strtod/strtod_funcs.h"
+#include "yybench.h"
+#include "bench_cpu.h"
+#include <inttypes.h>
+
+/*----------------------------------------------------------------------------*/
+/**
+ This benchmark serializes numeric arrays into JSON (e.g. `[1.5,2,-3e-7]`) with
+ the functions of the other runs, and parses them back. The result is reported
+ in MB/s of JSON text, so the per-call cycles of `run_dtoa`, `run_itoa`,
+ `run_strtod` and `run_atoi` can be checked against whole-document throughput.
+
+ Function prototypes (same as the other runs):
+ */
+typedef char *(*dtoa_func)(double val, char *buf);
+typedef char *(*itoa_i64_func)(i64 val, char *buf);
+typedef double (*strtod_func)(const char *str, size_t len, char **endptr);
+
+
+
+/*----------------------------------------------------------------------------*/
+
+typedef union {
+    f64 f; u64 u;
+} f64_uni;
+
+static yy_inline u64 f64_to_u64_raw(f64 f) {
+    f64_uni uni;
+    uni.f = f;
+    return uni.u;
+}
+
+static yy_inline f64 f64_from_u64_raw(u64 u) {
+    f64_uni uni;
+    uni.u = u;
+    return uni.f;
+}
+
+
+
+/*----------------------------------------------------------------------------*/
+
+/** How to write the values that JSON cannot represent exactly. */
+typedef struct {
+    /** Write NaN and Infinity as `NaN`, `Infinity` (JSON5), or `null` (RFC 8259). */
+    bool nan_inf_literal;
+    /** Write -0.0 as `0` instead of the function's own output. */
+    bool neg_zero_as_zero;
+} json_policy;
+
+/** A growable output buffer (null-terminated when finished). */
+typedef struct {
+    char *hdr;
+    char *cur;
+    char *end;
+} json_buf;
+
+/* some dtoa functions (such as schubfach) need 64 bytes for one number */
+#define JSON_NUM_LEN_MAX 64
+
+/* the first buffer capacity, so the growth is measured with the document */
+#define JSON_BUF_INIT_SIZE 256
+
+/* padding after a document, some parsers read ahead (such as lemire) */
+#define JSON_DOC_PADDING 64
+
+static bool json_buf_init(json_buf *buf) {
+    buf->hdr = malloc(JSON_BUF_INIT_SIZE);
+    buf->cur = buf->hdr;
+    buf->end = buf->hdr ? buf->hdr + JSON_BUF_INIT_SIZE : NULL;
+    return buf->hdr != NULL;
+}
+
+static void json_buf_release(json_buf *buf) {
+    free(buf->hdr);
+    buf->hdr = buf->cur = buf->end = NULL;
+}
+
+/** Ensure there's enough space for one more number. */
+static yy_inline bool json_buf_reserve(json_buf *buf) {
+    usize len, cap;
+    char *tmp;
+    if (yy_likely((usize)(buf->end - buf->cur) >= JSON_NUM_LEN_MAX)) return true;
+    len = (usize)(buf->cur - buf->hdr);
+    cap = (usize)(buf->end - buf->hdr) * 2;
+    tmp = realloc(buf->hdr, cap);
+    if (!tmp) return false;
+    buf->hdr = tmp;
+    buf->cur = tmp + len;
+    buf->end = tmp + cap;
+    return true;
+}
+
+/** Write the literal for NaN or Infinity. */
+static yy_inline char *json_write_nan_inf(u64 raw, char *cur,
+                                          const json_policy *policy) {
+    if (!policy->nan_inf_literal) {
+        memcpy(cur, "null", 4);
+        return cur + 4;
+    }
+    if (raw & (((u64)1 << 52) - 1)) {
+        memcpy(cur, "NaN", 3);
+        return cur + 3;
+    }
+    if (raw >> 63) *cur++ = '-';
+    memcpy(cur, "Infinity", 8);
+    return cur + 8;
+}
+
+/** Write double array as JSON, returns the document length, or 0 if failed. */
+static usize json_write_f64_array(json_buf *buf, const f64 *vals, usize count,
+                                  dtoa_func func, const json_policy *policy) {
+    buf->cur = buf->hdr;
+    *buf->cur++ = '[';
+    for (usize i = 0; i < count; i++) {
+        if (yy_unlikely(!json_buf_reserve(buf))) return 0;
+        if (i) *buf->cur++ = ',';
+        u64 raw = f64_to_u64_raw(vals[i]);
+        if (yy_unlikely((raw & 0x7FF0000000000000ULL) == 0x7FF0000000000000ULL)) {
+            buf->cur = json_write_nan_inf(raw, buf->cur, policy);
+        } else if (yy_unlikely(raw == 0x8000000000000000ULL &&
+                               policy->neg_zero_as_zero)) {
+            *buf->cur++ = '0';
+        } else {
+            buf->cur = func(vals[i], buf->cur);
+        }
+    }
+    if (yy_unlikely(!json_buf_reserve(buf))) return 0;
+    *buf->cur++ = ']';
+    *buf->cur = '\0';
+    return (usize)(buf->cur - buf->hdr);
+}
+
+/** Write int64 array as JSON, returns the document length, or 0 if failed. */
+static usize json_write_i64_array(json_buf *buf, const i64 *vals, usize count,
+                                  itoa_i64_func func) {
+    buf->cur = buf->hdr;
+    *buf->cur++ = '[';
+    for (usize i = 0; i < count; i++) {
+        if (yy_unlikely(!json_buf_reserve(buf))) return 0;
+        if (i) *buf->cur++ = ',';
+        buf->cur = func(vals[i], buf->cur);
+    }
+    if (yy_unlikely(!json_buf_reserve(buf))) return 0;
+    *buf->cur++ = ']';
+    *buf->cur = '\0';
+    return (usize)(buf->cur - buf->hdr);
+}
+
+
+
+/*----------------------------------------------------------------------------*/
+
+/** Whitespace and delimiter: ' ', '\t', '\n', '\r', ',', ']' */
+static const u8 json_delim_table[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0
+    /* others are 0 */
+};
+
+static yy_inline bool json_is_space(u8 c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+static yy_inline const char *json_skip_space(const char *cur) {
+    while (json_is_space((u8)*cur)) cur++;
+    return cur;
+}
+
+/** Returns the ending of a number token (or literal). */
+static yy_inline const char *json_token_end(const char *cur) {
+    while (*cur && !json_delim_table[(u8)*cur]) cur++;
+    return cur;
+}
+
+/** Read `null`, `NaN`, `Infinity` and `-Infinity`. */
+static yy_inline bool json_read_nan_inf(const char *cur, usize len, f64 *val) {
+    if (len == 4 && memcmp(cur, "null", 4) == 0) {
+        *val = f64_from_u64_raw(0x7FF8000000000000ULL);
+        return true;
+    }
+    if (len == 3 && memcmp(cur, "NaN", 3) == 0) {
+        *val = f64_from_u64_raw(0x7FF8000000000000ULL);
+        return true;
+    }
+    bool sign = (*cur == '-');
+    if (len == 8 + (usize)sign && memcmp(cur + sign, "Infinity", 8) == 0) {
+        *val = f64_from_u64_raw(0x7FF0000000000000ULL | ((u64)sign << 63));
+        return true;
+    }
+    return false;
+}
+
+/**
+ Read a JSON double array, returns the number of values, or -1 if failed.
+ @param copy Copy each token to a null-terminated buffer before calling `func`,
+    used by the functions which read the whole string (such as ryu's `s2d()`).
+ */
+static i64 json_read_f64_array(const char *doc, strtod_func func, bool copy,
+                               f64 *vals, usize max_count) {
+    const char *cur = json_skip_space(doc), *tok_end;
+    char *end, tmp[JSON_NUM_LEN_MAX];
+    usize count = 0, len;
+
+    if (*cur++ != '[') return -1;
+    cur = json_skip_space(cur);
+    if (*cur == ']') return 0;
+    while (true) {
+        if (count == max_count) return -1;
+        tok_end = json_token_end(cur);
+        len = (usize)(tok_end - cur);
+        if (yy_unlikely(len == 0)) return -1;
+        if (yy_unlikely(!('0' <= *cur && *cur <= '9') &&
+                        !(*cur == '-' && '0' <= cur[1] && cur[1] <= '9'))) {
+            if (!json_read_nan_inf(cur, len, vals + count)) return -1;
+        } else if (copy) {
+            if (len >= JSON_NUM_LEN_MAX) return -1;
+            memcpy(tmp, cur, len);
+            tmp[len] = '\0';
+            vals[count] = func(tmp, len, &end);
+            if (yy_unlikely(end != tmp + len)) return -1;
+        } else {
+            vals[count] = func(cur, len, &end);
+            if (yy_unlikely(end != tok_end)) return -1;
+        }
+        count++;
+        cur = json_skip_space(tok_end);
+        if (*cur == ',') {
+            cur = json_skip_space(cur + 1);
+            continue;
+        }
+        if (*cur == ']') return (i64)count;
+        return -1;
+    }
+}
+
+/** Read a JSON int64 array, returns the number of values, or -1 if failed. */
+static i64 json_read_i64_array(const char *doc, atoi_i64_func func,
+                               i64 *vals, usize max_count) {
+    const char *cur = json_skip_space(doc), *tok_end;
+    char *end;
+    usize count = 0;
+    atoi_result res;
+
+    if (*cur++ != '[') return -1;
+    cur = json_skip_space(cur);
+    if (*cur == ']') return 0;
+    while (true) {
+        if (count == max_count) return -1;
+        tok_end = json_token_end(cur);
+        vals[count] = func(cur, (usize)(tok_end - cur), &end, &res);
+        if (yy_unlikely(res != atoi_result_suc || end != tok_end)) return -1;
+        count++;
+        cur = json_skip_space(tok_end);
+        if (*cur == ',') {
+            cur = json_skip_space(cur + 1);
+            continue;
+        }
+        if (*cur == ']') return (i64)count;
+        return -1;
+    }
+}
+
+
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct {
+    const char *name;
+    dtoa_func func;
+} dtoa_item;
+
+typedef struct {
+    const char *name;
+    itoa_i64_func func;
+} itoa_item;
+
+typedef struct {
+    const char *name;
+    strtod_func func;
+    bool copy; /* the function cannot stop at a delimiter */
+} strtod_item;
+
+typedef struct {
+    const char *name;
+    atoi_i64_func func;
+} atoi_item;
+
+static dtoa_item dtoa_arr[128];
+static itoa_item itoa_arr[128];
+static strtod_item strtod_arr[128];
+static atoi_item atoi_arr[128];
+static int dtoa_num = 0;
+static int itoa_num = 0;
+static int strtod_num = 0;
+static int atoi_num = 0;
+static int name_max = 0;
+
+// returns the function name aligned (inner memory)
+static char *get_name_aligned(const char *name, bool align_right) {
+    static char buf[64];
+    int len = (int)strlen(name);
+    int space = name_max - len;
+    if (align_right) {
+        for (int i = 0; i < space; i++) buf[i] = ' ';
+        memcpy(buf + space, name, len);
+    } else {
+        memcpy(buf, name, len);
+        for (int i = 0; i < space; i++) buf[len + i] = ' ';
+    }
+    buf[name_max] = '\0';
+    return buf;
+}
+
+static void json_func_register_name(const char *name) {
+    if ((int)strlen(name) > name_max) name_max = (int)strlen(name);
+}
+
+
+
+/*----------------------------------------------------------------------------*/
+
+/** Get random double. */
+static yy_inline f64 rand_f64(void) {
+    while (true) {
+        u64 u = yy_random64();
+        f64 f = f64_from_u64_raw(u);
+        if (isfinite(f)) return f;
+    };
+}
+
+/** Get random normalized double (in range 0.0 to 1.0). */
+static yy_inline f64 rand_f64_normalize(void) {
+    return (f64)yy_random64() / (f64)UINT64_MAX;
+}
+
+/** Get random double which can convert to integer exactly. */
+static yy_inline f64 rand_f64_integer(void) {
+    return (f64)yy_random64_range(1, (u64)1 << 53);
+}
+
+/** Get random float number as double. */
+static yy_inline f64 rand_f64_from_f32(void) {
+    while (true) {
+        u32 u = yy_random32();
+        f32 f;
+        memcpy(&f, &u, sizeof(f));
+        if (isfinite(f)) return (f64)f;
+    };
+}
+
+/** Get random double, 1% of them are -0.0, NaN or Infinity. */
+static yy_inline f64 rand_f64_special(void) {
+    switch (yy_random32_range(0, 399)) {
+        case 0: return -0.0;
+        case 1: return f64_from_u64_raw(0x7FF8000000000000ULL);
+        case 2: return f64_from_u64_raw(0x7FF0000000000000ULL);
+        case 3: return f64_from_u64_raw(0xFFF0000000000000ULL);
+        default: return rand_f64();
+    }
+}
+
+static const u64 pow10_table[] = {
+    1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL,
+    10000000ULL, 100000000ULL, 1000000000ULL, 10000000000ULL,
+    100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+    100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,
+    100000000000000000ULL, 1000000000000000000ULL
+};
+
+/** Get random int64 with random digit count (1-19). */
+static yy_inline i64 rand_i64(void) {
+    u32 len = yy_random32_range(1, 19);
+    u64 min = len == 1 ? 0 : pow10_table[len - 1];
+    u64 max = len == 19 ? INT64_MAX : pow10_table[len] - 1;
+    i64 val = (i64)yy_random64_range(min, max);
+    return (yy_random32() & 1) ? -val : val;
+}
+
+/** Get random small int64 (such as array index or counter). */
+static yy_inline i64 rand_i64_small(void) {
+    return (i64)yy_random32_range(0, 9999);
+}
+
+typedef f64 (*fill_f64_func)(void);
+typedef i64 (*fill_i64_func)(void);
+
+
+
+/*----------------------------------------------------------------------------*/
+
+/** Write the reference document with google's double-conversion. */
+static usize json_write_f64_array_expect(json_buf *buf, const f64 *vals,
+                                         usize count, const json_policy *policy) {
+    buf->cur = buf->hdr;
+    *buf->cur++ = '[';
+    for (usize i = 0; i < count; i++) {
+        if (!json_buf_reserve(buf)) return 0;
+        if (i) *buf->cur++ = ',';
+        u64 raw = f64_to_u64_raw(vals[i]);
+        if ((raw & 0x7FF0000000000000ULL) == 0x7FF0000000000000ULL) {
+            buf->cur = json_write_nan_inf(raw, buf->cur, policy);
+        } else {
+            buf->cur += google_double_to_string(vals[i], buf->cur);
+        }
+    }
+    if (!json_buf_reserve(buf)) return 0;
+    *buf->cur++ = ']';
+    *buf->cur = '\0';
+    return (usize)(buf->cur - buf->hdr);
+}
+
+/** Write the reference document with snprintf. */
+static usize json_write_i64_array_expect(json_buf *buf, const i64 *vals,
+                                         usize count) {
+    buf->cur = buf->hdr;
+    *buf->cur++ = '[';
+    for (usize i = 0; i < count; i++) {
+        if (!json_buf_reserve(buf)) return 0;
+        if (i) *buf->cur++ = ',';
+        buf->cur += yy_sint_to_string(vals[i], buf->cur);
+    }
+    if (!json_buf_reserve(buf)) return 0;
+    *buf->cur++ = ']';
+    *buf->cur = '\0';
+    return (usize)(buf->cur - buf->hdr);
+}
+
+/** Compare two double arrays, NaN equals to any NaN, -0.0 may equal to 0.0. */
+static bool json_f64_array_equal(const f64 *a, const f64 *b, usize count,
+                                 bool neg_zero_as_zero) {
+    for (usize i = 0; i < count; i++) {
+        u64 ua = f64_to_u64_raw(a[i]), ub = f64_to_u64_raw(b[i]);
+        if (isnan(a[i]) && isnan(b[i])) continue;
+        if (neg_zero_as_zero && ua == 0x8000000000000000ULL) ua = 0;
+        if (neg_zero_as_zero && ub == 0x8000000000000000ULL) ub = 0;
+        if (ua != ub) return false;
+    }
+    return true;
+}
+
+/** Returns the max ulp error of two double arrays, or -1 if any value differs
+    in class (sign, nan, inf). */
+static i64 json_f64_array_max_ulp(const f64 *a, const f64 *b, usize count) {
+    i64 max_ulp = 0;
+    for (usize i = 0; i < count; i++) {
+        u64 ua = f64_to_u64_raw(a[i]), ub = f64_to_u64_raw(b[i]);
+        if (isnan(a[i]) && isnan(b[i])) continue;
+        if (ua == 0x8000000000000000ULL) ua = 0; /* google writes -0.0 as 0 */
+        if (ub == 0x8000000000000000ULL) ub = 0;
+        if (isnan(a[i]) || isnan(b[i]) || isinf(a[i]) != isinf(b[i]) ||
+            (ua >> 63) != (ub >> 63)) return -1;
+        i64 ulp = (i64)ua - (i64)ub;
+        if (ulp < 0) ulp = -ulp;
+        if (ulp > max_ulp) max_ulp = ulp;
+    }
+    return max_ulp;
+}
+
+/* the readers used to verify the writers */
+extern double strtod_google(const char *str, size_t len, char **endptr);
+extern i64 atoi_i64_libc(const char *str, size_t len, char **endptr, atoi_result *res);
+
+static void json_func_verify_all(void) {
+    const usize count = 4096;
+    json_policy policy = { true, true }; /* keep infinity in the round trip */
+    json_buf buf;
+    f64 *vals = malloc(count * sizeof(f64));
+    f64 *outs = malloc(count * sizeof(f64));
+    i64 *ivals = malloc(count * sizeof(i64));
+    i64 *iouts = malloc(count * sizeof(i64));
+    if (!vals || !outs || !ivals || !iouts || !json_buf_init(&buf)) {
+        printf("memory allocation failed.\n");
+        return;
+    }
+
+    yy_random_reset();
+    for (usize i = 0; i < count; i++) vals[i] = rand_f64_special();
+    for (usize i = 0; i < count; i++) ivals[i] = rand_i64();
+    ivals[0] = INT64_MIN;
+    ivals[1] = INT64_MAX;
+    ivals[2] = 0;
+
+    /* writers: read the output back with google's double-conversion */
+    for (int i = 1; i < dtoa_num; i++) { // skip null func
+        dtoa_item item = dtoa_arr[i];
+        bool suc = json_write_f64_array(&buf, vals, count, item.func, &policy) > 0;
+        suc = suc && json_read_f64_array(buf.hdr, strtod_google, false,
+                                         outs, count) == (i64)count;
+        suc = suc && json_f64_array_equal(vals, outs, count, policy.neg_zero_as_zero);
+        printf("verify dtoa   %s %s\n", get_name_aligned(item.name, false),
+               suc ? "[OK]" : "[FAIL]");
+    }
+    for (int i = 1; i < itoa_num; i++) { // skip null func
+        itoa_item item = itoa_arr[i];
+        bool suc = json_write_i64_array(&buf, ivals, count, item.func) > 0;
+        suc = suc && json_read_i64_array(buf.hdr, atoi_i64_libc,
+                                         iouts, count) == (i64)count;
+        suc = suc && memcmp(ivals, iouts, count * sizeof(i64)) == 0;
+        printf("verify itoa   %s %s\n", get_name_aligned(item.name, false),
+               suc ? "[OK]" : "[FAIL]");
+    }
+
+    /* readers: read the document written by google's double-conversion */
+    json_write_f64_array_expect(&buf, vals, count, &policy);
+    for (int i = 1; i < strtod_num; i++) { // skip null func
+        strtod_item item = strtod_arr[i];
+        bool suc = json_read_f64_array(buf.hdr, item.func, item.copy,
+                                       outs, count) == (i64)count;
+        i64 ulp = suc ? json_f64_array_max_ulp(vals, outs, count) : -1;
+        printf("verify strtod %s ", get_name_aligned(item.name, false));
+        if (ulp == 0) printf("[OK]\n");
+        else if (ulp > 0) printf("[max_ulp_err:%d]\n", (int)ulp);
+        else printf("[FAIL]\n");
+    }
+    json_write_i64_array_expect(&buf, ivals, count);
+    for (int i = 1; i < atoi_num; i++) { // skip null func
+        atoi_item item = atoi_arr[i];
+        bool suc = json_read_i64_array(buf.hdr, item.func,
+                                       iouts, count) == (i64)count;
+        suc = suc && memcmp(ivals, iouts, count * sizeof(i64)) == 0;
+        printf("verify atoi   %s %s\n", get_name_aligned(item.name, false),
+               suc ? "[OK]" : "[FAIL]");
+    }
+
+    json_buf_release(&buf);
+    free(vals);
+    free(outs);
+    free(ivals);
+    free(iouts);
+}
+
+
+
+/*----------------------------------------------------------------------------*/
+
+static yy_chart *json_chart_new(const char *title, const char *subtitle) {
+    yy_chart *chart = yy_chart_new();
+    yy_chart_options op;
+    yy_chart_options_init(&op);
+    op.title = title;
+    op.subtitle = subtitle;
+    op.type = YY_CHART_BAR;
+    op.h_axis.title = "MB/s (higher is better)";
+    op.plot.value_labels_enabled = true;
+    op.plot.value_labels_decimals = 1;
+    op.plot.color_by_point = true;
+    op.plot.group_padding = 0.0f;
+    op.plot.point_padding = 0.1f;
+    op.plot.border_width = 0.0f;
+    op.legend.enabled = false;
+    op.tooltip.value_decimals = 1;
+    op.width = 640;
+    op.height = 420;
+    yy_chart_set_options(chart, &op);
+    return chart;
+}
+
+static void json_chart_finish(yy_report *report, yy_chart *chart) {
+    yy_chart_sort_items_with_value(chart, true);
+    yy_report_add_chart(report, chart);
+    yy_chart_free(chart);
+}
+
+/** Convert the minimum ticks of one document to MB/s. */
+static f64 json_ticks_to_mbps(u64 ticks, usize doc_len) {
+    f64 sec = (f64)ticks * bench_cpu_get_cycle_per_tick() / bench_cpu_get_freq();
+    if (sec <= 0) return 0;
+    return (f64)doc_len / sec / (1024.0 * 1024.0);
+}
+
+static void json_func_benchmark_all(const char *output_path) {
+    printf("initialize...\n");
+    bench_cpu_setup();
+
+    usize num_per_doc = 10000;
+    int meansure_count = 16;
+    json_policy policy = { false, false };
+
+    typedef struct {
+        const char *name;
+        const char *desc;
+        void *fill_func;
+    } dataset_t;
+
+    dataset_t f64_dataset_arr[] = {
+        { "random", "random double number in all binary range, ignore nan and inf", rand_f64 },
+        { "nomalized", "random double number in range 0.0 to 1.0", rand_f64_normalize },
+        { "integer", "random double number from integer", rand_f64_integer },
+        { "float", "random float number", rand_f64_from_f32 },
+        { "special", "random double number, 1% are -0.0, nan or inf (written as null)", rand_f64_special },
+    };
+    dataset_t i64_dataset_arr[] = {
+        { "random", "random int64 number with random digit count", rand_i64 },
+        { "small", "random int64 number in range 0 to 9999", rand_i64_small },
+    };
+    int f64_dataset_num = (int)(sizeof(f64_dataset_arr) / sizeof(dataset_t));
+    int i64_dataset_num = (int)(sizeof(i64_dataset_arr) / sizeof(dataset_t));
+
+    char title[128], subtitle[256];
+    json_buf buf, doc;
+    f64 *vals = malloc(num_per_doc * sizeof(f64));
+    f64 *outs = malloc(num_per_doc * sizeof(f64));
+    i64 *ivals = malloc(num_per_doc * sizeof(i64));
+    i64 *iouts = malloc(num_per_doc * sizeof(i64));
+    if (!vals || !outs || !ivals || !iouts ||
+        !json_buf_init(&buf) || !json_buf_init(&doc)) {
+        printf("memory allocation failed.\n");
+        return;
+    }
+
+    yy_report *report = yy_report_new();
+    bench_report_add_env_info(report);
+
+    for (int d = 0; d < f64_dataset_num; d++) {
+        dataset_t dataset = f64_dataset_arr[d];
+        printf("run benchmark double[] %s...", dataset.name);
+
+        yy_random_reset();
+        for (usize i = 0; i < num_per_doc; i++) {
+            vals[i] = ((fill_f64_func)dataset.fill_func)();
+        }
+
+        /* serialize: start from a small buffer every time, measure the growth */
+        snprintf(title, sizeof(title), "serialize double[] (%s)", dataset.name);
+        snprintf(subtitle, sizeof(subtitle), "%s, %d values per document",
+                 dataset.desc, (int)num_per_doc);
+        yy_chart *chart = json_chart_new(title, subtitle);
+        for (int f = 0; f < dtoa_num; f++) {
+            dtoa_item item = dtoa_arr[f];
+            usize doc_len = 0;
+            u64 ticks_min;
+            for (int retry = 0; ; retry++) {
+                ticks_min = UINT64_MAX;
+                for (int r = 0; r < meansure_count; r++) {
+                    json_buf_release(&buf);
+                    json_buf_init(&buf);
+                    u64 t1 = yy_time_get_ticks();
+                    doc_len = json_write_f64_array(&buf, vals, num_per_doc, item.func, &policy);
+                    u64 t2 = yy_time_get_ticks();
+                    u64 t = t2 - t1;
+                    if (t < ticks_min) ticks_min = t;
+                }
+                if (bench_cpu_check_freq(retry)) break;
+            }
+            yy_chart_item_with_float(chart, item.name, (f32)json_ticks_to_mbps(ticks_min, doc_len));
+        }
+        json_chart_finish(report, chart);
+
+        /* parse: read the document written by google's double-conversion */
+        usize doc_len = json_write_f64_array_expect(&doc, vals, num_per_doc, &policy);
+        while ((usize)(doc.end - doc.cur) < JSON_DOC_PADDING) json_buf_reserve(&doc);
+        memset(doc.cur, 0, JSON_DOC_PADDING);
+        snprintf(title, sizeof(title), "parse double[] (%s)", dataset.name);
+        snprintf(subtitle, sizeof(subtitle), "%s, %d values, %d bytes per document",
+                 dataset.desc, (int)num_per_doc, (int)doc_len);
+        chart = json_chart_new(title, subtitle);
+        for (int f = 0; f < strtod_num; f++) {
+            strtod_item item = strtod_arr[f];
+            u64 ticks_min;
+            for (int retry = 0; ; retry++) {
+                ticks_min = UINT64_MAX;
+                for (int r = 0; r < meansure_count; r++) {
+                    u64 t1 = yy_time_get_ticks();
+                    json_read_f64_array(doc.hdr, item.func, item.copy, outs, num_per_doc);
+                    u64 t2 = yy_time_get_ticks();
+                    u64 t = t2 - t1;
+                    if (t < ticks_min) ticks_min = t;
+                }
+                if (bench_cpu_check_freq(retry)) break;
+            }
+            yy_chart_item_with_float(chart, item.name, (f32)json_ticks_to_mbps(ticks_min, doc_len));
+        }
+        json_chart_finish(report, chart);
+
+        printf("[OK]\n");
+    }
+
+    for (int d = 0; d < i64_dataset_num; d++) {
+        dataset_t dataset = i64_dataset_arr[d];
+        printf("run benchmark int64[] %s...", dataset.name);
+
+        yy_random_reset();
+        for (usize i = 0; i < num_per_doc; i++) {
+            ivals[i] = ((fill_i64_func)dataset.fill_func)();
+        }
+
+        snprintf(title, sizeof(title), "serialize int64[] (%s)", dataset.name);
+        snprintf(subtitle, sizeof(subtitle), "%s, %d values per document",
+                 dataset.desc, (int)num_per_doc);
+        yy_chart *chart = json_chart_new(title, subtitle);
+        for (int f = 0; f < itoa_num; f++) {
+            itoa_item item = itoa_arr[f];
+            usize doc_len = 0;
+            u64 ticks_min;
+            for (int retry = 0; ; retry++) {
+                ticks_min = UINT64_MAX;
+                for (int r = 0; r < meansure_count; r++) {
+                    json_buf_release(&buf);
+                    json_buf_init(&buf);
+                    u64 t1 = yy_time_get_ticks();
+                    doc_len = json_write_i64_array(&buf, ivals, num_per_doc, item.func);
+                    u64 t2 = yy_time_get_ticks();
+                    u64 t = t2 - t1;
+                    if (t < ticks_min) ticks_min = t;
+                }
+                if (bench_cpu_check_freq(retry)) break;
+            }
+            yy_chart_item_with_float(chart, item.name, (f32)json_ticks_to_mbps(ticks_min, doc_len));
+        }
+        json_chart_finish(report, chart);
+
+        usize doc_len = json_write_i64_array_expect(&doc, ivals, num_per_doc);
+        while ((usize)(doc.end - doc.cur) < JSON_DOC_PADDING) json_buf_reserve(&doc);
+        memset(doc.cur, 0, JSON_DOC_PADDING);
+        snprintf(title, sizeof(title), "parse int64[] (%s)", dataset.name);
+        snprintf(subtitle, sizeof(subtitle), "%s, %d values, %d bytes per document",
+                 dataset.desc, (int)num_per_doc, (int)doc_len);
+        chart = json_chart_new(title, subtitle);
+        for (int f = 0; f < atoi_num; f++) {
+            atoi_item item = atoi_arr[f];
+            u64 ticks_min;
+            for (int retry = 0; ; retry++) {
+                ticks_min = UINT64_MAX;
+                for (int r = 0; r < meansure_count; r++) {
+                    u64 t1 = yy_time_get_ticks();
+                    json_read_i64_array(doc.hdr, item.func, iouts, num_per_doc);
+                    u64 t2 = yy_time_get_ticks();
+                    u64 t = t2 - t1;
+                    if (t < ticks_min) ticks_min = t;
+                }
+                if (bench_cpu_check_freq(retry)) break;
+            }
+            yy_chart_item_with_float(chart, item.name, (f32)json_ticks_to_mbps(ticks_min, doc_len));
+        }
+        json_chart_finish(report, chart);
+
+        printf("[OK]\n");
+    }
+
+    // export report to html
+    bench_report_add_drift_info(report);
+    bool suc = yy_report_write_html_file(report, output_path);
+    if (!suc) {
+        printf("write report file failed: %s\n", output_path);
+    }
+    yy_report_free(report);
+    json_buf_release(&buf);
+    json_buf_release(&doc);
+    free(vals);
+    free(outs);
+    free(ivals);
+    free(iouts);
+}
+
+
+
+/*----------------------------------------------------------------------------*/
+
+static void json_func_cleanup(void) {
+    dtoa_num = 0;
+    itoa_num = 0;
+    strtod_num = 0;
+    atoi_num = 0;
+    name_max = 0;
+}
+
+/*
+ The dtoa and strtod lists are shared with the other runs (dtoa_funcs.h and
+ strtod_funcs.h), the itoa and atoi lists are same as the other runs.
+ The first function of each list is "null", used to meansure the overhead of
+ the JSON writer/reader itself.
+ */
+static void json_func_register_all(void) {
+#define dtoa_func_register(_name) \
+    extern char *dtoa_##_name(double val, char *buf); \
+    dtoa_arr[dtoa_num].name = #_name; \
+    dtoa_arr[dtoa_num].func = dtoa_##_name; \
+    dtoa_num++; \
+    json_func_register_name(#_name);
+
+#define itoa_func_register(_name) \
+    extern int itoa_##_name##_available_64; \
+    extern char *itoa_i64_##_name(i64 val, char *buf); \
+    if (itoa_##_name##_available_64) { \
+        itoa_arr[itoa_num].name = #_name; \
+        itoa_arr[itoa_num].func = itoa_i64_##_name; \
+        itoa_num++; \
+        json_func_register_name(#_name); \
+    }
+
+#define strtod_func_register_args(_name, _copy) \
+    extern double strtod_##_name(const char *str, size_t len, char **endptr); \
+    strtod_arr[strtod_num].name = #_name; \
+    strtod_arr[strtod_num].func = strtod_##_name; \
+    strtod_arr[strtod_num].copy = _copy; \
+    strtod_num++; \
+    json_func_register_name(#_name);
+
+/* ryu's s2d() reads until null-terminator, the tokens are copied for it */
+#define strtod_func_register(_name) \
+    strtod_func_register_args(_name, strcmp(#_name, "ryu") == 0)
+
+#define atoi_func_register(_name) \
+    extern i64 atoi_i64_##_name(const char *str, size_t len, char **endptr, atoi_result *res); \
+    atoi_arr[atoi_num].name = #_name; \
+    atoi_arr[atoi_num].func = atoi_i64_##_name; \
+    atoi_num++; \
+    json_func_register_name(#_name);
+
+    dtoa_func_register(null) /* used to meansure the writer overhead */
+    DTOA_FUNC_LIST(dtoa_func_register) /* see dtoa_funcs.h */
+
+    itoa_func_register(null) /* used to meansure the writer overhead */
+    itoa_func_register(yy)
+    itoa_func_register(yy_largelut)
+    itoa_func_register(smalltab)
+    itoa_func_register(lut)
+    itoa_func_register(count)
+    itoa_func_register(countlut)
+    itoa_func_register(branchlut)
+    itoa_func_register(branchlut2)
+    itoa_func_register(unrolledlut)
+    itoa_func_register(naive)
+    itoa_func_register(unnamed)
+    itoa_func_register(jeaiii)
+    itoa_func_register(protobuf)
+    itoa_func_register(fmtlib)
+    itoa_func_register(sse2)
+    itoa_func_register(an)
+    itoa_func_register(tmueller)
+    itoa_func_register(amartin)
+    itoa_func_register(amartin_ljust)
+    itoa_func_register(amartin_ljust2)
+
+    strtod_func_register(null) /* used to meansure the reader overhead */
+    STRTOD_FUNC_LIST(strtod_func_register) /* see strtod_funcs.h */
+
+    atoi_func_register(null) /* used to meansure the reader overhead */
+    atoi_func_register(libc)
+    atoi_func_register(libcpp)
+    atoi_func_register(lemire)
+    atoi_func_register(yy)
+
+#undef dtoa_func_register
+#undef itoa_func_register
+#undef strtod_func_register_args
+#undef strtod_func_register
+#undef atoi_func_register
+}
+
+void benchmark(const char *output_path) {
+    json_func_register_all();
+    printf("------[verify]---------\n");
+    json_func_verify_all();
+    printf("------[benchmark]------\n");
+    json_func_benchmark_all(output_path);
+    printf("------[finish]---------\n");
+    json_func_cleanup();
+    return;
+}
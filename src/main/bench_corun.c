@@ -0,0 +1,315 @@
+/*
+ * Copyright (c) 2018 YaoYuan <ibireme@gmail.com>.
+ * Released under the MIT license (MIT).
+ */
+
+#include "bench_corun.h"
+#include "bench_cpu.h"
+
+#if defined(_WIN32)
+#   include <windows.h>
+#   include <intrin.h>
+#else
+#   include <pthread.h>
+#   include <time.h>
+#endif
+
+/* memory streamer: two buffers larger than LLC, copied by 1MB chunks */
+#define CORUN_STREAM_SIZE (32 * 1024 * 1024)
+#define CORUN_STREAM_CHUNK (1024 * 1024)
+
+/* table walker: random loads in a table larger than L1 (usually 32-48KB) */
+#define CORUN_TABLE_SIZE (128 * 1024)
+#define CORUN_TABLE_LOADS 4096
+
+/* number conversion: conversions per chunk */
+#define CORUN_NUMCONV_COUNT 64
+
+/* the antagonist type and core set by command line */
+static bench_corun_type corun_type = BENCH_CORUN_NONE;
+static int corun_core = -1;
+
+/* atomic operations: the state shared by the measuring thread and the
+   antagonist is stored with release and loaded with acquire, so the writes
+   before a store (such as the pinning result) are seen after the load */
+#if defined(_MSC_VER) && !defined(__clang__)
+#   define corun_load_relaxed(p) (*(volatile u64 *)(p))
+#   define corun_load_acquire(p) corun_load_acquire_msvc(p)
+#   define corun_store_release(p, v) do { _ReadWriteBarrier(); \
+        *(volatile u64 *)(p) = (v); } while (0)
+static yy_inline u64 corun_load_acquire_msvc(const u64 *p) {
+    u64 v = *(volatile const u64 *)p;
+    _ReadWriteBarrier();
+    return v;
+}
+#else
+#   define corun_load_relaxed(p) __atomic_load_n((p), __ATOMIC_RELAXED)
+#   define corun_load_acquire(p) __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#   define corun_store_release(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#endif
+
+/* the antagonist thread state, the flags are 0 or 1 (u64 as the counter) */
+static u64 corun_quit = 0;
+static u64 corun_active = 0;
+static u64 corun_idle = 1;
+static u64 corun_chunks = 0; /* written by the antagonist only */
+static volatile u64 corun_sink = 0; /* written by the antagonist only */
+static bool corun_started = false;
+static int corun_used_core = -1;
+static bool corun_pinned = false;
+
+#if defined(_WIN32)
+static HANDLE corun_thread;
+#else
+static pthread_t corun_thread;
+#endif
+
+static const char *corun_names[] = { "none", "stream", "table", "numconv" };
+
+bool bench_corun_set_antagonist(const char *name) {
+    for (int i = 0; i < (int)(sizeof(corun_names) / sizeof(corun_names[0])); i++) {
+        if (strcmp(name, corun_names[i]) == 0) {
+            corun_type = (bench_corun_type)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+bench_corun_type bench_corun_get_antagonist(void) {
+    return corun_type;
+}
+
+void bench_corun_set_core(int core) {
+    corun_core = core;
+}
+
+
+
+/*----------------------------------------------------------------------------*/
+
+static void corun_sleep_ms(int ms) {
+#if defined(_WIN32)
+    Sleep((DWORD)ms);
+#else
+    struct timespec ts = { 0, (long)ms * 1000000 };
+    nanosleep(&ts, NULL);
+#endif
+}
+
+/** Run one chunk of the workload (tens of microseconds). */
+static void corun_work(char *mem, u32 *seed) {
+    u64 sum = 0;
+    switch (corun_type) {
+        case BENCH_CORUN_STREAM: {
+            usize half = CORUN_STREAM_SIZE / 2;
+            u64 chunks = corun_load_relaxed(&corun_chunks);
+            usize off = (usize)(chunks % (half / CORUN_STREAM_CHUNK)) * CORUN_STREAM_CHUNK;
+            memcpy(mem + half + off, mem + off, CORUN_STREAM_CHUNK);
+            sum = (u8)mem[half + off];
+            break;
+        }
+        case BENCH_CORUN_TABLE: {
+            /* 4 independent chains to keep several loads in flight */
+            const u32 *table = (const u32 *)mem;
+            u32 mask = CORUN_TABLE_SIZE / sizeof(u32) - 1;
+            u32 a = *seed & mask, b = (*seed >> 4) & mask;
+            u32 c = (*seed >> 8) & mask, d = (*seed >> 12) & mask;
+            for (int i = 0; i < CORUN_TABLE_LOADS / 4; i++) {
+                a = table[a] & mask;
+                b = table[b] & mask;
+                c = table[c] & mask;
+                d = table[d] & mask;
+            }
+            *seed += a ^ b ^ c ^ d;
+            sum = a + b + c + d;
+            break;
+        }
+        case BENCH_CORUN_NUMCONV: {
+            char buf[32];
+            for (int i = 0; i < CORUN_NUMCONV_COUNT; i++) {
+                *seed = *seed * 1103515245u + 12345u;
+                f64 val = (f64)*seed * 1.2345e-3;
+                snprintf(buf, sizeof(buf), "%.17g", val);
+                sum += (u64)strtod(buf, NULL);
+            }
+            break;
+        }
+        default:
+            break;
+    }
+    corun_sink += sum;
+}
+
+#if defined(_WIN32)
+static DWORD WINAPI corun_thread_main(LPVOID arg) {
+#else
+static void *corun_thread_main(void *arg) {
+#endif
+    char *mem = (char *)arg;
+    u32 seed = 0x12345678;
+    corun_pinned = bench_cpu_pin_thread(corun_used_core);
+    while (!corun_load_acquire(&corun_quit)) {
+        if (!corun_load_acquire(&corun_active)) {
+            corun_store_release(&corun_idle, 1);
+            corun_sleep_ms(1);
+            continue;
+        }
+        corun_store_release(&corun_idle, 0);
+        corun_work(mem, &seed);
+        corun_store_release(&corun_chunks, corun_load_relaxed(&corun_chunks) + 1);
+    }
+    corun_store_release(&corun_idle, 1);
+    return 0;
+}
+
+/** Pause or resume the antagonist, and wait until it's paused or running. */
+static void corun_set_active(bool active) {
+    if (active) {
+        u64 chunks = corun_load_acquire(&corun_chunks);
+        corun_store_release(&corun_active, 1);
+        while (corun_load_acquire(&corun_chunks) == chunks) corun_sleep_ms(0);
+    } else {
+        corun_store_release(&corun_active, 0);
+        while (!corun_load_acquire(&corun_idle)) corun_sleep_ms(0);
+    }
+}
+
+static char *corun_mem = NULL;
+
+bool bench_corun_start(void) {
+    if (corun_type == BENCH_CORUN_NONE || corun_started) return corun_started;
+
+    corun_used_core = corun_core;
+    if (corun_used_core < 0) {
+        corun_used_core = bench_cpu_get_sibling(bench_cpu_get_pinned_core());
+        if (corun_used_core < 0) {
+            printf("[WARN] no SMT sibling of the measuring core, "
+                   "use -s to set the co-runner core\n");
+            return false;
+        }
+    }
+
+    /* prepare the memory of workload */
+    usize size = corun_type == BENCH_CORUN_STREAM ? CORUN_STREAM_SIZE : CORUN_TABLE_SIZE;
+    corun_mem = (char *)malloc(size);
+    if (!corun_mem) return false;
+    memset(corun_mem, 0, size);
+    if (corun_type == BENCH_CORUN_TABLE) {
+        /* random links, each load is likely in a different cache line */
+        u32 *table = (u32 *)corun_mem;
+        u32 seed = 1;
+        for (usize i = 0; i < size / sizeof(u32); i++) {
+            seed = seed * 1103515245u + 12345u;
+            table[i] = seed >> 8;
+        }
+    }
+
+    corun_store_release(&corun_quit, 0);
+    corun_store_release(&corun_active, 0);
+    corun_store_release(&corun_idle, 1);
+#if defined(_WIN32)
+    corun_thread = CreateThread(NULL, 0, corun_thread_main, corun_mem, 0, NULL);
+    if (!corun_thread) {
+#else
+    if (pthread_create(&corun_thread, NULL, corun_thread_main, corun_mem) != 0) {
+#endif
+        free(corun_mem);
+        corun_mem = NULL;
+        return false;
+    }
+    corun_started = true;
+
+    /* run once to make sure the thread is pinned and warmed up */
+    corun_set_active(true);
+    corun_sleep_ms(100);
+    corun_set_active(false);
+    if (!corun_pinned) {
+        printf("[WARN] cannot pin co-runner thread to CPU core %d\n", corun_used_core);
+    }
+    return true;
+}
+
+void bench_corun_stop(void) {
+    if (!corun_started) return;
+    corun_store_release(&corun_quit, 1);
+    corun_store_release(&corun_active, 0);
+#if defined(_WIN32)
+    WaitForSingleObject(corun_thread, INFINITE);
+    CloseHandle(corun_thread);
+#else
+    pthread_join(corun_thread, NULL);
+#endif
+    free(corun_mem);
+    corun_mem = NULL;
+    corun_started = false;
+}
+
+bool bench_corun_run(bench_isolate_func func, void *ctx, const void *data,
+                     u64 *ticks_alone, u64 *ticks_corun) {
+    *ticks_alone = *ticks_corun = 0;
+    if (!corun_started) return false;
+
+    /* alternate the runs, so that a slow drift affects both */
+    u64 alone = UINT64_MAX, corun = UINT64_MAX;
+    for (int round = 0; round < 2; round++) {
+        u64 t = func(ctx, data);
+        if (t < alone) alone = t;
+        corun_set_active(true);
+        t = func(ctx, data);
+        corun_set_active(false);
+        if (t < corun) corun = t;
+    }
+    *ticks_alone = alone;
+    *ticks_corun = corun;
+    return true;
+}
+
+
+
+/*----------------------------------------------------------------------------*/
+
+yy_chart *bench_corun_chart_new(const char *title) {
+    yy_chart *chart = yy_chart_new();
+    yy_chart_options op;
+    yy_chart_options_init(&op);
+    op.title = title;
+    op.subtitle = "slowdown with the co-runner on the sibling (or selected) core, "
+                  "cycles: alone -> co-run";
+    op.type = YY_CHART_BAR;
+    op.h_axis.title = "slowdown (%)";
+    op.plot.value_labels_enabled = true;
+    op.plot.value_labels_decimals = 1;
+    op.plot.color_by_point = true;
+    op.plot.group_padding = 0.0f;
+    op.plot.point_padding = 0.1f;
+    op.plot.border_width = 0.0f;
+    op.legend.enabled = false;
+    op.tooltip.value_decimals = 1;
+    op.width = 640;
+    op.height = 420;
+    yy_chart_set_options(chart, &op);
+    return chart;
+}
+
+void bench_corun_chart_add(yy_chart *chart, const char *name,
+                           u64 ticks_alone, u64 ticks_corun, usize num) {
+    char buf[128];
+    f64 cpt = bench_cpu_get_cycle_per_tick();
+    f64 alone = (f64)ticks_alone / (f64)num * cpt;
+    f64 corun = (f64)ticks_corun / (f64)num * cpt;
+    f64 slowdown = ticks_alone ? ((f64)ticks_corun / (f64)ticks_alone - 1.0) * 100.0 : 0;
+    snprintf(buf, sizeof(buf), "%s (%.1f -> %.1f)", name, alone, corun);
+    yy_chart_item_with_float(chart, buf, (f32)slowdown);
+}
+
+bool bench_report_add_corun_info(yy_report *report) {
+    char info[256];
+    int core = bench_cpu_get_pinned_core();
+    bool sibling = corun_core < 0 || bench_cpu_get_sibling(core) == corun_used_core;
+    snprintf(info, sizeof(info), "Co-runner: %s on core %d (%s core %d%s)",
+             corun_names[corun_type], corun_used_core,
+             sibling ? "SMT sibling of" : "not sibling of", core,
+             corun_pinned ? "" : ", not pinned");
+    return yy_report_add_info(report, info);
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2018 YaoYuan <ibireme@gmail.com>.
+ * Released under the MIT license (MIT).
+ */
+
+#ifndef bench_corun_h
+#define bench_corun_h
+
+#include "yybench.h"
+#include "bench_isolate.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*----------------------------------------------------------------------------*/
+/**
+ Co-runner interference: an antagonist thread is pinned on the SMT sibling of
+ the measuring core (or another core set by `bench_corun_set_core()`), and each
+ function is measured with the antagonist paused and running. The slowdown
+ shows how a function shares the core resources (caches, load ports,
+ multipliers) with other workloads.
+ */
+
+/** The antagonist workload. */
+typedef enum {
+    BENCH_CORUN_NONE = 0,
+    BENCH_CORUN_STREAM,     /* memory streamer: copy buffers larger than LLC */
+    BENCH_CORUN_TABLE,      /* table walker: random loads thrashing L1 */
+    BENCH_CORUN_NUMCONV,    /* number conversion: libc snprintf and strtod */
+} bench_corun_type;
+
+/** Set the antagonist by name: "stream", "table", "numconv", "none".
+    Returns false if the name is unknown. */
+bool bench_corun_set_antagonist(const char *name);
+
+/** Get the antagonist, BENCH_CORUN_NONE (default) if disabled. */
+bench_corun_type bench_corun_get_antagonist(void);
+
+/** Set the core of antagonist, -1 (default) to use the SMT sibling. */
+void bench_corun_set_core(int core);
+
+/** Start the antagonist thread (paused), should be called after
+    `bench_cpu_setup()`. Returns false if disabled or failed. */
+bool bench_corun_start(void);
+
+/** Stop the antagonist thread. */
+void bench_corun_stop(void);
+
+/**
+ Measure a function with the antagonist paused and running (alternately).
+ @param func The measurement function, see `bench_isolate_func`.
+ @param ctx The context passed to `func`.
+ @param data The input data passed to `func`.
+ @param ticks_alone The min ticks with the antagonist paused.
+ @param ticks_corun The min ticks with the antagonist running.
+ @return false if the antagonist is not started.
+ */
+bool bench_corun_run(bench_isolate_func func, void *ctx, const void *data,
+                     u64 *ticks_alone, u64 *ticks_corun);
+
+/** Create a bar chart for the slowdown of each function. */
+yy_chart *bench_corun_chart_new(const char *title);
+
+/** Add a function to the chart, the item name shows the cycles of both. */
+void bench_corun_chart_add(yy_chart *chart, const char *name,
+                           u64 ticks_alone, u64 ticks_corun, usize num);
+
+/** Add the antagonist info, should be called after `bench_corun_start()`. */
+bool bench_report_add_corun_info(yy_report *report);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* bench_corun_h */
@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2018 YaoYuan <ibireme@gmail.com>.
+ * Released under the MIT license (MIT).
+ */
+
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#   define _GNU_SOURCE /* sched_setaffinity, sched_getcpu */
+#endif
+
+#include "bench_cpu.h"
+#include <math.h>
+
+#if defined(_WIN32)
+#   include <windows.h>
+#elif defined(__linux__)
+#   include <sched.h>
+#endif
+
+/* the core to pin, -1 for current core */
+static int bench_core = -1;
+/* the pinned core, -1 if not pinned */
+static int bench_pinned_core = -1;
+
+/* the frequency measured in setup, the drift check does not change it */
+static f64 bench_base_freq = 0;
+static f64 bench_base_cycle_per_tick = 0;
+
+/* drift stats */
+static int bench_check_count = 0;
+static int bench_retry_count = 0;
+static int bench_flag_count = 0;
+static f64 bench_drift_max = 0;
+
+
+
+/*----------------------------------------------------------------------------*/
+
+/** Read the first line of a (sysfs) file, returns false if failed. */
+static bool bench_read_line(const char *path, char *buf, usize size) {
+    FILE *file = fopen(path, "rb");
+    if (!file) return false;
+    bool suc = fgets(buf, (int)size, file) != NULL;
+    fclose(file);
+    if (!suc) return false;
+    usize len = strlen(buf);
+    while (len > 0 && (buf[len - 1] == '\n' || buf[len - 1] == '\r')) len--;
+    buf[len] = '\0';
+    return len > 0;
+}
+
+void bench_cpu_set_core(int core) {
+    bench_core = core;
+}
+
+bool bench_cpu_pin_thread(int core) {
+#if defined(_WIN32)
+    if (core < 0 || core >= (int)(sizeof(DWORD_PTR) * 8)) return false;
+    return SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR)1 << core) != 0;
+#elif defined(__linux__)
+    if (core < 0 || core >= CPU_SETSIZE) return false;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(core, &set);
+    return sched_setaffinity(0, sizeof(set), &set) == 0;
+#else
+    (void)core; /* macOS does not support thread affinity */
+    return false;
+#endif
+}
+
+bool bench_cpu_pin(int core) {
+#if defined(_WIN32)
+    if (core < 0) core = (int)GetCurrentProcessorNumber();
+#elif defined(__linux__)
+    if (core < 0) core = sched_getcpu();
+#endif
+    if (!bench_cpu_pin_thread(core)) return false;
+    bench_pinned_core = core;
+    return true;
+}
+
+int bench_cpu_get_pinned_core(void) {
+    return bench_pinned_core;
+}
+
+int bench_cpu_get_sibling(int core) {
+    if (core < 0) return -1;
+#if defined(_WIN32)
+    DWORD len = 0;
+    GetLogicalProcessorInformation(NULL, &len);
+    SYSTEM_LOGICAL_PROCESSOR_INFORMATION *info = malloc(len);
+    int sibling = -1;
+    if (info && GetLogicalProcessorInformation(info, &len)) {
+        DWORD_PTR bit = (DWORD_PTR)1 << core;
+        usize count = len / sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION);
+        for (usize i = 0; i < count && sibling < 0; i++) {
+            if (info[i].Relationship != RelationProcessorCore) continue;
+            DWORD_PTR mask = info[i].ProcessorMask;
+            if (!(mask & bit)) continue;
+            for (int c = 0; c < (int)(sizeof(DWORD_PTR) * 8); c++) {
+                if (c != core && (mask & ((DWORD_PTR)1 << c))) {
+                    sibling = c;
+                    break;
+                }
+            }
+        }
+    }
+    free(info);
+    return sibling;
+#elif defined(__linux__)
+    /* the list is such as "1,5" or "0-1" */
+    char buf[256], path[128];
+    snprintf(path, sizeof(path),
+             "/sys/devices/system/cpu/cpu%d/topology/thread_siblings_list", core);
+    if (!bench_read_line(path, buf, sizeof(buf))) return -1;
+    const char *cur = buf;
+    while (*cur) {
+        char *end;
+        long lo = strtol(cur, &end, 10), hi = lo;
+        if (end == cur) break;
+        if (*end == '-') hi = strtol(end + 1, &end, 10);
+        for (long c = lo; c <= hi; c++) {
+            if (c != core) return (int)c;
+        }
+        cur = *end == ',' ? end + 1 : end;
+    }
+    return -1;
+#else
+    return -1;
+#endif
+}
+
+void bench_cpu_setup(void) {
+    yy_cpu_setup_priority();
+    if (!bench_cpu_pin(bench_core)) {
+        printf("[WARN] cannot pin thread to CPU core\n");
+    }
+    yy_cpu_spin(1.0);
+    yy_cpu_measure_freq();
+    bench_base_freq = (f64)yy_cpu_get_freq();
+    bench_base_cycle_per_tick = yy_cpu_get_cycle_per_tick();
+}
+
+f64 bench_cpu_get_freq(void) {
+    if (bench_base_freq <= 0) return (f64)yy_cpu_get_freq();
+    return bench_base_freq;
+}
+
+f64 bench_cpu_get_cycle_per_tick(void) {
+    if (bench_base_cycle_per_tick <= 0) return yy_cpu_get_cycle_per_tick();
+    return bench_base_cycle_per_tick;
+}
+
+bool bench_cpu_check_freq(int retry) {
+    if (bench_base_freq <= 0) return true;
+
+    /* the measured frequency has some jitter, use the closest of several;
+       yybench keeps the last one, so convert ticks with the base values */
+    f64 drift = HUGE_VAL;
+    for (int i = 0; i < BENCH_FREQ_MEASURE_COUNT && drift > BENCH_FREQ_DRIFT_MAX; i++) {
+        yy_cpu_measure_freq();
+        f64 d = fabs((f64)yy_cpu_get_freq() - bench_base_freq) / bench_base_freq;
+        if (d < drift) drift = d;
+    }
+    if (retry == 0) bench_check_count++;
+    if (drift > bench_drift_max) bench_drift_max = drift;
+    if (drift <= BENCH_FREQ_DRIFT_MAX) return true;
+
+    if (retry < BENCH_RETRY_MAX) {
+        bench_retry_count++;
+        return false;
+    }
+    bench_flag_count++;
+    return true;
+}
+
+
+
+/*----------------------------------------------------------------------------*/
+
+bool bench_report_add_env_info(yy_report *report) {
+    char info[1024], buf[256], path[128];
+    if (!yy_report_add_env_info(report)) return false;
+
+    if (bench_pinned_core >= 0) {
+        snprintf(info, sizeof(info), "CPU Pinning: core %d", bench_pinned_core);
+    } else {
+        snprintf(info, sizeof(info), "CPU Pinning: none");
+    }
+    if (!yy_report_add_info(report, info)) return false;
+
+#if defined(__linux__)
+    int core = bench_pinned_core >= 0 ? bench_pinned_core : 0;
+
+    /* cpufreq governor, such as "performance" or "powersave" */
+    snprintf(path, sizeof(path),
+             "/sys/devices/system/cpu/cpu%d/cpufreq/scaling_governor", core);
+    if (!bench_read_line(path, buf, sizeof(buf))) strcpy(buf, "unknown");
+    snprintf(info, sizeof(info), "CPU Governor: %s", buf);
+    if (!yy_report_add_info(report, info)) return false;
+
+    /* SMT (Hyper-Threading) and the sibling threads of pinned core */
+    const char *smt = "unknown";
+    if (bench_read_line("/sys/devices/system/cpu/smt/active", buf, sizeof(buf))) {
+        smt = buf[0] == '1' ? "on" : "off";
+    }
+    snprintf(path, sizeof(path),
+             "/sys/devices/system/cpu/cpu%d/topology/thread_siblings_list", core);
+    if (!bench_read_line(path, buf, sizeof(buf))) strcpy(buf, "unknown");
+    snprintf(info, sizeof(info), "CPU SMT: %s (siblings of core %d: %s)", smt, core, buf);
+    if (!yy_report_add_info(report, info)) return false;
+
+    /* turbo boost: intel_pstate or acpi-cpufreq */
+    const char *turbo = "unknown";
+    if (bench_read_line("/sys/devices/system/cpu/intel_pstate/no_turbo", buf, sizeof(buf))) {
+        turbo = buf[0] == '0' ? "on" : "off";
+    } else if (bench_read_line("/sys/devices/system/cpu/cpufreq/boost", buf, sizeof(buf))) {
+        turbo = buf[0] == '1' ? "on" : "off";
+    }
+    snprintf(info, sizeof(info), "CPU Turbo: %s", turbo);
+    if (!yy_report_add_info(report, info)) return false;
+#else
+    (void)buf;
+    (void)path;
+#endif
+    return true;
+}
+
+bool bench_report_add_drift_info(yy_report *report) {
+    char info[1024];
+    if (bench_flag_count) {
+        printf("[WARN] CPU frequency drifted in %d of %d measurements\n",
+               bench_flag_count, bench_check_count);
+    }
+    snprintf(info, sizeof(info),
+             "CPU Frequency Drift: %d measurements, %d retried, %d flagged "
+             "(drift > %.0f%% after %d retries, max drift %.1f%%)",
+             bench_check_count, bench_retry_count, bench_flag_count,
+             BENCH_FREQ_DRIFT_MAX * 100, BENCH_RETRY_MAX, bench_drift_max * 100);
+    return yy_report_add_info(report, info);
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2018 YaoYuan <ibireme@gmail.com>.
+ * Released under the MIT license (MIT).
+ */
+
+#ifndef bench_cpu_h
+#define bench_cpu_h
+
+#include "yybench.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*----------------------------------------------------------------------------*/
+/**
+ CPU setup and noise guards shared by all benchmarks.
+
+ The CPU frequency is measured once in setup as the base frequency, and
+ measured again after each measurement. If the frequency drifts (turbo,
+ thermal throttling, migration...), the measurement is retried, and flagged
+ in the report if it still drifts after several retries.
+
+ Each check overwrites the frequency of yybench, so the ticks should be
+ converted to cycles with `bench_cpu_get_cycle_per_tick()` (the base values),
+ not with `bench_cpu_get_cycle_per_tick()`.
+ */
+
+/** Max allowed CPU frequency drift (relative to the base frequency). */
+#define BENCH_FREQ_DRIFT_MAX 0.05
+
+/** Frequency measurement count of one check (the closest one is used). */
+#define BENCH_FREQ_MEASURE_COUNT 3
+
+/** Max retry count of one measurement when the CPU frequency drifts. */
+#define BENCH_RETRY_MAX 3
+
+/** Set the CPU core to pin before setup, -1 (default) to use current core. */
+void bench_cpu_set_core(int core);
+
+/** Pin current thread to a CPU core as the measuring core (-1 for current
+    core), returns false if not supported. */
+bool bench_cpu_pin(int core);
+
+/** Pin current thread to a CPU core, without changing the measuring core. */
+bool bench_cpu_pin_thread(int core);
+
+/** Get the measuring core, -1 if not pinned. */
+int bench_cpu_get_pinned_core(void);
+
+/** Get an SMT (Hyper-Threading) sibling of a core, -1 if not found. */
+int bench_cpu_get_sibling(int core);
+
+/** Raise priority, pin thread, warm up CPU, and measure the base frequency. */
+void bench_cpu_setup(void);
+
+/** Get the base CPU frequency (cycles per second) measured in setup. */
+f64 bench_cpu_get_freq(void);
+
+/** Get the CPU cycles per tick measured in setup. */
+f64 bench_cpu_get_cycle_per_tick(void);
+
+/**
+ Measure the CPU frequency again, should be called after each measurement.
+ @param retry The retry count of current measurement.
+ @return false if the frequency drifts and the measurement should be retried,
+    true if the measurement is accepted (it may be flagged as drifted).
+ */
+bool bench_cpu_check_freq(int retry);
+
+/** Add environment info and CPU state (pinning, governor, SMT, turbo). */
+bool bench_report_add_env_info(yy_report *report);
+
+/** Add the frequency drift summary, should be called after benchmark. */
+bool bench_report_add_drift_info(yy_report *report);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* bench_cpu_h */
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2018 YaoYuan <ibireme@gmail.com>.
+ * Released under the MIT license (MIT).
+ */
+
+#include "bench_direct.h"
+#include "bench_cpu.h"
+
+#if !defined(__GNUC__) && !defined(__clang__)
+const void *volatile bench_direct_sink = NULL;
+#endif
+
+/* enabled by command line */
+static bool direct_enabled = false;
+
+void bench_direct_set_enabled(bool enabled) {
+    direct_enabled = enabled;
+}
+
+bool bench_direct_get_enabled(void) {
+    return direct_enabled;
+}
+
+
+
+/*----------------------------------------------------------------------------*/
+
+void bench_direct_run(bench_isolate_func indirect, bench_isolate_func direct,
+                      void *ctx, const void *data, bench_direct *res) {
+    for (int retry = 0; ; retry++) {
+        /* alternate the runs, so that a slow drift affects both */
+        u64 ind = UINT64_MAX, dir = UINT64_MAX;
+        for (int round = 0; round < 2; round++) {
+            u64 t = indirect(ctx, data);
+            if (t < ind) ind = t;
+            t = direct(ctx, data);
+            if (t < dir) dir = t;
+        }
+        res->ticks_indirect = ind;
+        res->ticks_direct = dir;
+        if (bench_cpu_check_freq(retry)) break;
+    }
+}
+
+
+
+/*----------------------------------------------------------------------------*/
+
+/** Cycles per number with the overhead subtracted (not less than 0). */
+static f64 direct_get_cycles(u64 ticks, u64 base, usize num) {
+    f64 cpt = bench_cpu_get_cycle_per_tick();
+    f64 cycles = ((f64)ticks - (f64)base) / (f64)num * cpt;
+    return cycles > 0 ? cycles : 0;
+}
+
+yy_chart *bench_direct_chart_new(const char *title, const char **names,
+                                 const bench_direct *res, int count,
+                                 const bench_direct *base, usize num) {
+    const char *categories[] = { "indirect", "direct", NULL };
+    char subtitle[256];
+    f64 cpt = bench_cpu_get_cycle_per_tick();
+    snprintf(subtitle, sizeof(subtitle),
+             "call through pointer vs. call by name (%s), overhead subtracted: "
+             "indirect %.2f, direct %.2f cycles",
+#if defined(BENCH_LTO) && BENCH_LTO
+             "LTO",
+#else
+             "no LTO",
+#endif
+             (f64)base->ticks_indirect / (f64)num * cpt,
+             (f64)base->ticks_direct / (f64)num * cpt);
+
+    yy_chart *chart = yy_chart_new();
+    yy_chart_options op;
+    yy_chart_options_init(&op);
+    op.title = title;
+    op.subtitle = subtitle;
+    op.type = YY_CHART_BAR;
+    op.v_axis.categories = categories;
+    op.h_axis.title = "average CPU cycles (null overhead subtracted)";
+    op.plot.value_labels_enabled = true;
+    op.plot.value_labels_decimals = 2;
+    op.plot.group_padding = 0.1f;
+    op.plot.point_padding = 0.0f;
+    op.plot.border_width = 0.0f;
+    op.legend.enabled = true;
+    op.tooltip.value_decimals = 2;
+    op.tooltip.shared = true;
+    op.width = 640;
+    op.height = 120 + count * 40;
+    yy_chart_set_options(chart, &op);
+
+    /* one item for each function, one value for each loop */
+    for (int i = 0; i < count; i++) {
+        yy_chart_item_begin(chart, names[i]);
+        yy_chart_item_add_float(chart, (f32)direct_get_cycles(
+            res[i].ticks_indirect, base->ticks_indirect, num));
+        yy_chart_item_add_float(chart, (f32)direct_get_cycles(
+            res[i].ticks_direct, base->ticks_direct, num));
+        yy_chart_item_end(chart);
+    }
+    return chart;
+}
+
+bool bench_report_add_direct_info(yy_report *report) {
+    const char *info =
+#if defined(BENCH_LTO) && BENCH_LTO
+        "Direct-call: built with LTO, the calls by name may be inlined";
+#else
+        "Direct-call: built without LTO, the calls by name are not inlined "
+        "across source files";
+#endif
+    return yy_report_add_info(report, info);
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2018 YaoYuan <ibireme@gmail.com>.
+ * Released under the MIT license (MIT).
+ */
+
+#ifndef bench_direct_h
+#define bench_direct_h
+
+#include "yybench.h"
+#include "bench_isolate.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*----------------------------------------------------------------------------*/
+/**
+ Direct-call measurement: the benchmark loops call the functions through
+ function pointers, so a call is never inlined or specialized, but the code is
+ usually inlined into a serializer in real use. In this mode, each function is
+ also measured with a loop which calls it by name (generated by macro for each
+ registered function). The compiler can inline the call across source files
+ only with LTO, build with `-DCMAKE_INTERPROCEDURAL_OPTIMIZATION=ON` (or the
+ `-lto` configs of the build matrix).
+
+ Both loops are reported with the loop overhead subtracted, the overhead is
+ measured with the null function in the same way.
+ */
+
+/** Keep the memory pointed by `ptr` alive, so that an inlined call is not
+    removed as dead code. It costs nothing but a store at runtime. */
+#if defined(__GNUC__) || defined(__clang__)
+#   define bench_direct_escape(ptr) __asm__ volatile("" : : "r"(ptr) : "memory")
+#else
+#   define bench_direct_escape(ptr) (bench_direct_sink = (const void *)(ptr))
+extern const void *volatile bench_direct_sink;
+#endif
+
+/** The result of one function. */
+typedef struct {
+    u64 ticks_indirect; /* min ticks of the loop calling through pointer */
+    u64 ticks_direct;   /* min ticks of the loop calling by name */
+} bench_direct;
+
+/** Enable the direct-call mode, disabled by default. */
+void bench_direct_set_enabled(bool enabled);
+
+/** Whether the direct-call mode is enabled. */
+bool bench_direct_get_enabled(void);
+
+/**
+ Measure a function with the indirect and direct loop (alternately).
+ @param indirect The measurement function calling through pointer.
+ @param direct The measurement function calling by name.
+ @param ctx The context passed to both functions.
+ @param data The input data passed to both functions.
+ @param res The result.
+ */
+void bench_direct_run(bench_isolate_func indirect, bench_isolate_func direct,
+                      void *ctx, const void *data, bench_direct *res);
+
+/**
+ Create a bar chart with the indirect and direct cycles of each function.
+ @param title The chart title.
+ @param names The function names.
+ @param res The results of the functions.
+ @param count The function count.
+ @param base The result of the null function, subtracted from others.
+ @param num The number count of one measurement.
+ */
+yy_chart *bench_direct_chart_new(const char *title, const char **names,
+                                 const bench_direct *res, int count,
+                                 const bench_direct *base, usize num);
+
+/** Add the direct-call info (whether built with LTO). */
+bool bench_report_add_direct_info(yy_report *report);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* bench_direct_h */
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2018 YaoYuan <ibireme@gmail.com>.
+ * Released under the MIT license (MIT).
+ */
+
+#include "bench_isolate.h"
+
+#if defined(_WIN32)
+#   include <malloc.h>
+#   define bench_alloca _alloca
+#else
+#   include <alloca.h>
+#   include <sys/wait.h>
+#   include <unistd.h>
+#   define bench_alloca alloca
+#endif
+
+/* layout variant count, 0 if disabled */
+static int bench_variants = 0;
+
+void bench_isolate_set_variants(int num) {
+    if (num < 0) num = 0;
+    if (num > BENCH_ISOLATE_VARIANT_MAX) num = BENCH_ISOLATE_VARIANT_MAX;
+    bench_variants = num;
+}
+
+int bench_isolate_get_variants(void) {
+    return bench_variants;
+}
+
+
+
+/*----------------------------------------------------------------------------*/
+
+/** A small random generator for layout, independent of yy_random. */
+static u32 bench_layout_random(u32 *seed) {
+    *seed = *seed * 1103515245u + 12345u;
+    return *seed >> 16;
+}
+
+#if defined(__GNUC__) || defined(__clang__)
+__attribute__((noinline))
+#elif defined(_MSC_VER)
+__declspec(noinline)
+#endif
+static u64 bench_isolate_call(bench_isolate_func func, void *ctx,
+                              const void *data, usize size, usize heap_off) {
+    /* place the input data at shifted heap address */
+    char *mem = (char *)malloc(size + heap_off + 64);
+    if (!mem) return 0;
+    char *copy = mem + heap_off;
+    if (size) memcpy(copy, data, size);
+    u64 ticks = func(ctx, copy);
+    free(mem);
+    return ticks;
+}
+
+/** Run one variant, variant 0 is the default layout (no offset). */
+static u64 bench_isolate_variant(bench_isolate_func func, void *ctx,
+                                 const void *data, usize size, int variant) {
+    u32 seed = (u32)variant * 2654435761u;
+    usize stack_off = 0, heap_off = 0;
+    if (variant > 0) {
+        stack_off = (usize)(bench_layout_random(&seed) % 256) * 16; /* 0-4KB */
+        heap_off = (usize)(bench_layout_random(&seed) % 256) * 16; /* 0-4KB */
+    }
+
+    /* shift the stack of measurement, and the later heap allocations */
+    volatile char *stack_pad = (volatile char *)bench_alloca(stack_off + 16);
+    stack_pad[0] = 0;
+    void *heap_pad = malloc(heap_off + 16);
+    u64 ticks = bench_isolate_call(func, ctx, data, size, heap_off);
+    free(heap_pad);
+    stack_pad[0] = 1;
+    return ticks;
+}
+
+/** Run one variant in a child process, returns 0 if failed. */
+static u64 bench_isolate_variant_fork(bench_isolate_func func, void *ctx,
+                                      const void *data, usize size, int variant) {
+#if defined(_WIN32)
+    return bench_isolate_variant(func, ctx, data, size, variant);
+#else
+    int fds[2];
+    u64 ticks = 0;
+    if (pipe(fds) != 0) return 0;
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid < 0) {
+        close(fds[0]);
+        close(fds[1]);
+        return 0;
+    }
+    if (pid == 0) {
+        close(fds[0]);
+        ticks = bench_isolate_variant(func, ctx, data, size, variant);
+        ssize_t len = write(fds[1], &ticks, sizeof(ticks));
+        close(fds[1]);
+        _exit(len == (ssize_t)sizeof(ticks) ? 0 : 1);
+    }
+    close(fds[1]);
+    if (read(fds[0], &ticks, sizeof(ticks)) != (ssize_t)sizeof(ticks)) ticks = 0;
+    close(fds[0]);
+    int status = 0;
+    if (waitpid(pid, &status, 0) != pid ||
+        !WIFEXITED(status) || WEXITSTATUS(status) != 0) ticks = 0;
+    return ticks;
+#endif
+}
+
+static int bench_u64_cmp(const void *a, const void *b) {
+    u64 x = *(const u64 *)a, y = *(const u64 *)b;
+    return x < y ? -1 : x > y ? 1 : 0;
+}
+
+bool bench_isolate_run(bench_isolate_func func, void *ctx,
+                       const void *data, usize size, bench_spread *spread) {
+    u64 ticks_arr[BENCH_ISOLATE_VARIANT_MAX];
+    int num = bench_variants ? bench_variants : 1;
+    int count = 0;
+    for (int v = 0; v < num; v++) {
+        u64 ticks = bench_isolate_variant_fork(func, ctx, data, size, v);
+        if (ticks) ticks_arr[count++] = ticks;
+    }
+    memset(spread, 0, sizeof(bench_spread));
+    if (!count) return false;
+
+    qsort(ticks_arr, (size_t)count, sizeof(u64), bench_u64_cmp);
+    spread->count = count;
+    spread->ticks_min = ticks_arr[0];
+    spread->ticks_med = ticks_arr[count / 2];
+    spread->ticks_max = ticks_arr[count - 1];
+    return count == num;
+}
+
+f64 bench_spread_get_percent(const bench_spread *spread) {
+    if (!spread->ticks_med) return 0;
+    return (f64)(spread->ticks_max - spread->ticks_min) / (f64)spread->ticks_med * 100.0;
+}
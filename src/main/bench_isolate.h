@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2018 YaoYuan <ibireme@gmail.com>.
+ * Released under the MIT license (MIT).
+ */
+
+#ifndef bench_isolate_h
+#define bench_isolate_h
+
+#include "yybench.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*----------------------------------------------------------------------------*/
+/**
+ Isolated measurement: a measurement is run in a forked child process for each
+ layout variant. Each variant shifts the stack and the input data by a random
+ offset, so the result does not depend on one lucky (or unlucky) memory layout.
+ The spread of all variants is reported.
+
+ Only the data moves, the code layout can not be changed at runtime: use the
+ `layout` target (several `LAYOUT_SEED` builds, see CMakeLists.txt) to check
+ the code alignment.
+ On Windows, the variants are run in the same process (without fork).
+ */
+
+/** Max layout variant count. */
+#define BENCH_ISOLATE_VARIANT_MAX 64
+
+/**
+ A measurement function.
+ @param ctx The context passed to `bench_isolate_run()`.
+ @param data A copy of input data, placed at a shifted heap address.
+ @return The minimum ticks of this measurement.
+ */
+typedef u64 (*bench_isolate_func)(void *ctx, const void *data);
+
+/** The result of all variants. */
+typedef struct {
+    int count;      /* variant count */
+    u64 ticks_min;  /* the best variant */
+    u64 ticks_med;  /* the median variant */
+    u64 ticks_max;  /* the worst variant */
+} bench_spread;
+
+/** Set the layout variant count, 0 (default) to disable isolated mode. */
+void bench_isolate_set_variants(int num);
+
+/** Get the layout variant count, 0 if isolated mode is disabled. */
+int bench_isolate_get_variants(void);
+
+/**
+ Run the measurement for each layout variant.
+ @param func The measurement function.
+ @param ctx The context passed to `func`.
+ @param data The input data, copied for each variant.
+ @param size The input data size in bytes.
+ @param spread The result.
+ @return false if any variant failed.
+ */
+bool bench_isolate_run(bench_isolate_func func, void *ctx,
+                       const void *data, usize size, bench_spread *spread);
+
+/** Get the spread in percent: (max - min) / median. */
+f64 bench_spread_get_percent(const bench_spread *spread);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* bench_isolate_h */
@@ -0,0 +1,325 @@
+/*
+ * Copyright (c) 2018 YaoYuan <ibireme@gmail.com>.
+ * Released under the MIT license (MIT).
+ */
+
+#include "bench_memo.h"
+
+#if defined(_WIN32)
+#   include <windows.h>
+#   include <intrin.h>
+#else
+#   include <pthread.h>
+#   include <sched.h>
+#   include <unistd.h>
+#endif
+
+/* the words of string in an entry */
+#define MEMO_STR_WORDS (BENCH_MEMO_STR_MAX / 8)
+
+/* atomic operations: the entry words are accessed with relaxed atomics, the
+   sequence number orders them (a seqlock without waiting) */
+#if defined(_MSC_VER) && !defined(__clang__)
+#   define memo_load_relaxed(p) (*(volatile u64 *)(p))
+#   define memo_load_acquire(p) memo_load_acquire_msvc(p)
+#   define memo_store_relaxed(p, v) (*(volatile u64 *)(p) = (v))
+#   define memo_store_release(p, v) do { _ReadWriteBarrier(); \
+        *(volatile u64 *)(p) = (v); } while (0)
+#   define memo_fence_acquire() _ReadWriteBarrier()
+#   define memo_fence_release() _ReadWriteBarrier()
+#   define memo_cas(p, expect, desire) \
+        (_InterlockedCompareExchange64((volatile __int64 *)(p), \
+            (__int64)(desire), (__int64)(expect)) == (__int64)(expect))
+#   define memo_fetch_add(p, v) \
+        _InterlockedExchangeAdd64((volatile __int64 *)(p), (__int64)(v))
+static yy_inline u64 memo_load_acquire_msvc(const u64 *p) {
+    u64 v = *(volatile const u64 *)p;
+    _ReadWriteBarrier();
+    return v;
+}
+#else
+#   define memo_load_relaxed(p) __atomic_load_n((p), __ATOMIC_RELAXED)
+#   define memo_load_acquire(p) __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#   define memo_store_relaxed(p, v) __atomic_store_n((p), (v), __ATOMIC_RELAXED)
+#   define memo_store_release(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#   define memo_fence_acquire() __atomic_thread_fence(__ATOMIC_ACQUIRE)
+#   define memo_fence_release() __atomic_thread_fence(__ATOMIC_RELEASE)
+#   define memo_cas(p, expect, desire) __extension__ ({ \
+        u64 memo_expect_ = (expect); \
+        __atomic_compare_exchange_n((p), &memo_expect_, (desire), false, \
+            __ATOMIC_ACQUIRE, __ATOMIC_RELAXED); })
+#   define memo_fetch_add(p, v) __atomic_fetch_add((p), (v), __ATOMIC_RELAXED)
+#endif
+
+/** An entry, one cache line (64 bytes). */
+typedef struct {
+    u64 seq;                    /* odd when being written */
+    u64 key;                    /* bit pattern of the number */
+    u64 len;                    /* string length, 0 if empty */
+    u64 str[MEMO_STR_WORDS];    /* string bytes */
+} memo_entry;
+
+struct bench_memo {
+    memo_entry *entries;        /* set_count * BENCH_MEMO_WAYS, aligned */
+    void *mem;                  /* allocated memory of entries */
+    u32 set_count;
+    u32 set_shift;              /* 64 - log2(set_count) */
+    bench_memo_stats stats;     /* merged counters */
+};
+
+/** Get the first entry of the set for a key (Fibonacci hashing, so that the
+    high and low bits of the key are both used). */
+static yy_inline memo_entry *memo_get_set(bench_memo *memo, u64 key) {
+    u64 hash = key * 0x9E3779B97F4A7C15ULL;
+    usize set = memo->set_shift < 64 ? (usize)(hash >> memo->set_shift) : 0;
+    return memo->entries + set * BENCH_MEMO_WAYS;
+}
+
+bench_memo *bench_memo_new(u32 set_count) {
+    u32 count = 1, shift = 64;
+    while (count < set_count && count < ((u32)1 << 30)) {
+        count <<= 1;
+        shift--;
+    }
+
+    bench_memo *memo = (bench_memo *)calloc(1, sizeof(bench_memo));
+    if (!memo) return NULL;
+    usize size = (usize)count * BENCH_MEMO_WAYS * sizeof(memo_entry);
+    memo->mem = malloc(size + 64);
+    if (!memo->mem) {
+        free(memo);
+        return NULL;
+    }
+    memo->entries = (memo_entry *)(((usize)memo->mem + 63) & ~(usize)63);
+    memo->set_count = count;
+    memo->set_shift = shift;
+    bench_memo_clear(memo);
+    return memo;
+}
+
+void bench_memo_free(bench_memo *memo) {
+    if (!memo) return;
+    free(memo->mem);
+    free(memo);
+}
+
+void bench_memo_clear(bench_memo *memo) {
+    usize size = (usize)memo->set_count * BENCH_MEMO_WAYS * sizeof(memo_entry);
+    memset(memo->entries, 0, size);
+    memset(&memo->stats, 0, sizeof(bench_memo_stats));
+}
+
+usize bench_memo_get(bench_memo *memo, u64 key, char *buf, bench_memo_stats *stats) {
+    memo_entry *entry = memo_get_set(memo, key);
+    for (int w = 0; w < BENCH_MEMO_WAYS; w++, entry++) {
+        if (memo_load_relaxed(&entry->key) != key) continue;
+        u64 seq = memo_load_acquire(&entry->seq);
+        if (seq & 1) break;
+
+        /* copy the entry, then check whether it was changed during copy */
+        u64 str[MEMO_STR_WORDS];
+        u64 len = memo_load_relaxed(&entry->len);
+        u64 cur = memo_load_relaxed(&entry->key);
+        for (int i = 0; i < MEMO_STR_WORDS; i++) {
+            str[i] = memo_load_relaxed(&entry->str[i]);
+        }
+        memo_fence_acquire();
+        if (memo_load_relaxed(&entry->seq) != seq) break;
+        if (cur != key || len == 0 || len > BENCH_MEMO_STR_MAX) break;
+
+        memcpy(buf, str, (usize)len);
+        buf[len] = '\0';
+        stats->hit++;
+        return (usize)len;
+    }
+    stats->miss++;
+    return 0;
+}
+
+void bench_memo_put(bench_memo *memo, u64 key, const char *str, usize len,
+                    bench_memo_stats *stats) {
+    if (len == 0 || len > BENCH_MEMO_STR_MAX) return;
+
+    /* use an empty entry, or replace the entries of the set in turn
+       (the turn is counted by each thread, without shared state) */
+    memo_entry *set = memo_get_set(memo, key);
+    memo_entry *entry = set + (stats->put % BENCH_MEMO_WAYS);
+    for (int w = 0; w < BENCH_MEMO_WAYS; w++) {
+        if (memo_load_relaxed(&set[w].len) == 0) {
+            entry = set + w;
+            break;
+        }
+    }
+
+    /* claim the entry by making the sequence number odd */
+    u64 seq = memo_load_relaxed(&entry->seq);
+    if ((seq & 1) || !memo_cas(&entry->seq, seq, seq + 1)) {
+        stats->skip++;
+        return;
+    }
+    memo_fence_release();
+
+    u64 words[MEMO_STR_WORDS] = { 0 };
+    memcpy(words, str, len);
+    memo_store_relaxed(&entry->key, key);
+    memo_store_relaxed(&entry->len, (u64)len);
+    for (int i = 0; i < MEMO_STR_WORDS; i++) {
+        memo_store_relaxed(&entry->str[i], words[i]);
+    }
+    memo_store_release(&entry->seq, seq + 2);
+    stats->put++;
+}
+
+void bench_memo_add_stats(bench_memo *memo, const bench_memo_stats *stats) {
+    memo_fetch_add(&memo->stats.hit, stats->hit);
+    memo_fetch_add(&memo->stats.miss, stats->miss);
+    memo_fetch_add(&memo->stats.put, stats->put);
+    memo_fetch_add(&memo->stats.skip, stats->skip);
+}
+
+void bench_memo_get_stats(bench_memo *memo, bench_memo_stats *stats) {
+    stats->hit = memo_load_acquire(&memo->stats.hit);
+    stats->miss = memo_load_acquire(&memo->stats.miss);
+    stats->put = memo_load_acquire(&memo->stats.put);
+    stats->skip = memo_load_acquire(&memo->stats.skip);
+}
+
+f64 bench_memo_stats_get_hit_rate(const bench_memo_stats *stats) {
+    u64 total = stats->hit + stats->miss;
+    return total ? (f64)stats->hit / (f64)total : 0.0;
+}
+
+
+
+/*----------------------------------------------------------------------------*/
+
+/* the state of a thread group, the threads wait for `go` after created */
+typedef struct {
+    bench_memo_thread_func func;
+    void *ctx;
+    volatile u64 ready;
+    volatile u64 go;
+    u64 ticks_end[BENCH_MEMO_THREAD_MAX];
+} memo_group;
+
+typedef struct {
+    memo_group *group;
+    u32 idx;
+} memo_thread_arg;
+
+static void memo_yield(void) {
+#if defined(_WIN32)
+    SwitchToThread();
+#else
+    sched_yield();
+#endif
+}
+
+#if defined(_WIN32)
+static DWORD WINAPI memo_thread_main(LPVOID param) {
+#else
+static void *memo_thread_main(void *param) {
+#endif
+    memo_thread_arg *arg = (memo_thread_arg *)param;
+    memo_group *group = arg->group;
+    memo_fetch_add(&group->ready, 1);
+    while (!memo_load_acquire(&group->go)) memo_yield();
+    group->func(group->ctx, arg->idx);
+    group->ticks_end[arg->idx] = yy_time_get_ticks();
+    return 0;
+}
+
+u32 bench_memo_get_core_count(void) {
+#if defined(_WIN32)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? (u32)info.dwNumberOfProcessors : 1;
+#else
+    long num = sysconf(_SC_NPROCESSORS_ONLN);
+    return num > 0 ? (u32)num : 1;
+#endif
+}
+
+u64 bench_memo_run_threads(u32 num, bench_memo_thread_func func, void *ctx) {
+    if (num < 1 || num > BENCH_MEMO_THREAD_MAX || !func) return 0;
+
+    memo_group group;
+    memo_thread_arg args[BENCH_MEMO_THREAD_MAX];
+#if defined(_WIN32)
+    HANDLE threads[BENCH_MEMO_THREAD_MAX];
+#else
+    pthread_t threads[BENCH_MEMO_THREAD_MAX];
+#endif
+    memset(&group, 0, sizeof(group));
+    group.func = func;
+    group.ctx = ctx;
+
+    /* create the threads, they wait until all threads are ready */
+    u32 created = 1;
+    bool suc = true;
+    for (u32 i = 1; i < num; i++) {
+        args[i].group = &group;
+        args[i].idx = i;
+#if defined(_WIN32)
+        threads[i] = CreateThread(NULL, 0, memo_thread_main, &args[i], 0, NULL);
+        if (!threads[i]) {
+#else
+        if (pthread_create(&threads[i], NULL, memo_thread_main, &args[i]) != 0) {
+#endif
+            suc = false;
+            break;
+        }
+        created++;
+    }
+    while (memo_load_acquire(&group.ready) < created - 1) memo_yield();
+
+    u64 ticks_begin = yy_time_get_ticks();
+    memo_store_release(&group.go, 1);
+    if (suc) {
+        func(ctx, 0);
+        group.ticks_end[0] = yy_time_get_ticks();
+    }
+
+    u64 ticks_end = 0;
+    for (u32 i = 1; i < created; i++) {
+#if defined(_WIN32)
+        WaitForSingleObject(threads[i], INFINITE);
+        CloseHandle(threads[i]);
+#else
+        pthread_join(threads[i], NULL);
+#endif
+    }
+    if (!suc) return 0;
+    for (u32 i = 0; i < num; i++) {
+        if (group.ticks_end[i] > ticks_end) ticks_end = group.ticks_end[i];
+    }
+    return ticks_end > ticks_begin ? ticks_end - ticks_begin : 1;
+}
+
+void bench_memo_fill_zipf(u32 *idx, usize count, u32 n, f64 s) {
+    if (n == 0) return;
+    if (s <= 0.0) {
+        for (usize i = 0; i < count; i++) idx[i] = yy_random32_uniform(n);
+        return;
+    }
+
+    /* cumulative distribution, then binary search a uniform random number */
+    f64 *cdf = (f64 *)malloc((usize)n * sizeof(f64));
+    if (!cdf) return;
+    f64 sum = 0.0;
+    for (u32 k = 0; k < n; k++) {
+        sum += 1.0 / pow((f64)(k + 1), s);
+        cdf[k] = sum;
+    }
+    for (usize i = 0; i < count; i++) {
+        f64 u = (f64)yy_random64_uniform((u64)1 << 53) / (f64)((u64)1 << 53) * sum;
+        u32 lo = 0, hi = n - 1;
+        while (lo < hi) {
+            u32 mid = lo + (hi - lo) / 2;
+            if (cdf[mid] <= u) lo = mid + 1;
+            else hi = mid;
+        }
+        idx[i] = lo;
+    }
+    free(cdf);
+}
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2018 YaoYuan <ibireme@gmail.com>.
+ * Released under the MIT license (MIT).
+ */
+
+#ifndef bench_memo_h
+#define bench_memo_h
+
+#include "yybench.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*----------------------------------------------------------------------------*/
+/**
+ Memoization cache in front of a conversion function.
+
+ Telemetry-like data repeats the same numbers (0, 1, 0.5, common IDs...), the
+ cache keeps the output string of a number keyed by its bit pattern, so that
+ a repeated number is copied instead of converted again.
+
+ The cache is a fixed-size set-associative table shared by all threads. Each
+ entry is one cache line protected by a sequence number: a reader never
+ waits (a torn or busy entry is a miss), and a writer never waits (a busy
+ entry is skipped). The hit/miss counters are kept by each thread in its own
+ `bench_memo_stats`, and merged into the cache after the work.
+ */
+
+/** The ways of each set. */
+#define BENCH_MEMO_WAYS 4
+
+/** The max string length of an entry (the longer ones are not cached). */
+#define BENCH_MEMO_STR_MAX 40
+
+/** The max thread count of `bench_memo_run_threads()`. */
+#define BENCH_MEMO_THREAD_MAX 64
+
+typedef struct bench_memo bench_memo;
+
+/** The counters of a thread, or the merged counters of a cache. */
+typedef struct {
+    u64 hit;    /* found in cache */
+    u64 miss;   /* not found (or the entry is being written) */
+    u64 put;    /* written to cache */
+    u64 skip;   /* not written: the entry is being written by other thread */
+} bench_memo_stats;
+
+/** Create a cache with `set_count` sets (rounded up to power of 2). */
+bench_memo *bench_memo_new(u32 set_count);
+
+/** Free the cache. */
+void bench_memo_free(bench_memo *memo);
+
+/** Remove all entries and reset the counters, should not be called when
+    other threads are using the cache. */
+void bench_memo_clear(bench_memo *memo);
+
+/**
+ Find a string in cache.
+ @param key The bit pattern of the number.
+ @param buf The output buffer, at least `BENCH_MEMO_STR_MAX + 1` bytes,
+    the string is null-terminated.
+ @param stats The counters of current thread.
+ @return The string length, or 0 if not found.
+ */
+usize bench_memo_get(bench_memo *memo, u64 key, char *buf, bench_memo_stats *stats);
+
+/**
+ Add a string to cache, an entry of the set is replaced if the set is full.
+ @param key The bit pattern of the number.
+ @param str The string (null-terminator is not required).
+ @param len The string length, the string is not cached if it's 0 or larger
+    than `BENCH_MEMO_STR_MAX`.
+ @param stats The counters of current thread.
+ */
+void bench_memo_put(bench_memo *memo, u64 key, const char *str, usize len,
+                    bench_memo_stats *stats);
+
+/** Merge the counters of a thread into the cache (thread-safe). */
+void bench_memo_add_stats(bench_memo *memo, const bench_memo_stats *stats);
+
+/** Get the merged counters of the cache. */
+void bench_memo_get_stats(bench_memo *memo, bench_memo_stats *stats);
+
+/** Get the hit rate of the counters (0.0 to 1.0). */
+f64 bench_memo_stats_get_hit_rate(const bench_memo_stats *stats);
+
+
+
+/*----------------------------------------------------------------------------*/
+/**
+ Threads and datasets for the memoization benchmark.
+ */
+
+/** The work of one thread, `idx` is the thread index in range [0, num). */
+typedef void (*bench_memo_thread_func)(void *ctx, u32 idx);
+
+/** Get the online CPU core count (at least 1). */
+u32 bench_memo_get_core_count(void);
+
+/**
+ Run a work on several threads at the same time, the current thread is used
+ as the thread 0. The threads are created before the timer starts.
+ @param num The thread count, in range [1, BENCH_MEMO_THREAD_MAX].
+ @return The ticks from start to the end of the last thread, 0 if failed.
+ */
+u64 bench_memo_run_threads(u32 num, bench_memo_thread_func func, void *ctx);
+
+/**
+ Fill the buffer with random ranks in Zipf distribution: the probability of
+ rank k (0 based) is proportional to 1 / (k + 1)^s, the distribution is
+ uniform if `s` is 0. The ranks should be mapped to a shuffled value pool.
+ @param idx The output ranks, in range [0, n).
+ @param count The rank count.
+ @param n The distinct value count.
+ @param s The exponent.
+ */
+void bench_memo_fill_zipf(u32 *idx, usize count, u32 n, f64 s);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* bench_memo_h */
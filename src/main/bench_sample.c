@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2018 YaoYuan <ibireme@gmail.com>.
+ * Released under the MIT license (MIT).
+ */
+
+#include "bench_sample.h"
+#include "bench_cpu.h"
+
+/* seed count, 0 if disabled */
+static int sample_seeds = 0;
+
+/* summary of all measurements */
+static int sample_runs = 0;
+static int sample_converged = 0;
+static u64 sample_total = 0;
+
+void bench_sample_set_seeds(int num) {
+    if (num < 0) num = 0;
+    if (num > BENCH_SAMPLE_SEED_MAX) num = BENCH_SAMPLE_SEED_MAX;
+    sample_seeds = num;
+}
+
+int bench_sample_get_seeds(void) {
+    return sample_seeds;
+}
+
+void bench_sample_seed(int idx) {
+    /* skip a block of the default sequence for each seed, the block is larger
+       than the numbers drawn by any dataset, so the seeds do not overlap */
+    yy_random_reset();
+    for (u64 i = 0, n = (u64)idx * BENCH_SAMPLE_SEED_STRIDE; i < n; i++) {
+        (void)yy_random64();
+    }
+}
+
+
+
+/*----------------------------------------------------------------------------*/
+
+/** Insert a value into a sorted array with `count` values. */
+static void sample_insert(u64 *arr, int count, u64 val) {
+    int i = count;
+    while (i > 0 && arr[i - 1] > val) {
+        arr[i] = arr[i - 1];
+        i--;
+    }
+    arr[i] = val;
+}
+
+/** Get the median and its 95% confidence interval of sorted samples. */
+static void sample_get_interval(const u64 *arr, int count, bench_sample *res) {
+    f64 half = (f64)count / 2.0;
+    f64 dist = 0.98 * sqrt((f64)count); /* 1.96 / 2 * sqrt(n) */
+    int lo = (int)floor(half - dist);
+    int hi = (int)ceil(half + dist);
+    if (lo < 0) lo = 0;
+    if (hi > count - 1) hi = count - 1;
+    res->count = count;
+    res->ticks_med = arr[count / 2];
+    res->ticks_lo = arr[lo];
+    res->ticks_hi = arr[hi];
+}
+
+void bench_sample_run(bench_isolate_func func, void *ctx, const void *data,
+                      bench_sample *res) {
+    u64 *arr = (u64 *)malloc(BENCH_SAMPLE_MAX * sizeof(u64));
+    memset(res, 0, sizeof(bench_sample));
+    if (!arr) return;
+    
+    for (int retry = 0; ; retry++) {
+        f64 begin = yy_time_get_seconds();
+        int count = 0;
+        res->converged = false;
+        while (count < BENCH_SAMPLE_MAX) {
+            sample_insert(arr, count, func(ctx, data));
+            count++;
+            if (count < BENCH_SAMPLE_MIN) continue;
+            sample_get_interval(arr, count, res);
+            if ((f64)(res->ticks_hi - res->ticks_lo) <=
+                (f64)res->ticks_med * BENCH_SAMPLE_CI_WIDTH) {
+                res->converged = true;
+                break;
+            }
+            if (yy_time_get_seconds() - begin > BENCH_SAMPLE_BUDGET) break;
+        }
+        if (bench_cpu_check_freq(retry)) break;
+    }
+    free(arr);
+    
+    sample_runs++;
+    sample_converged += res->converged;
+    sample_total += (u64)res->count;
+}
+
+
+
+/*----------------------------------------------------------------------------*/
+
+yy_chart *bench_sample_chart_new(const char *title) {
+    const char *categories[] = { "interval low", "median", "interval high", NULL };
+    yy_chart *chart = yy_chart_new();
+    yy_chart_options op;
+    yy_chart_options_init(&op);
+    op.title = title;
+    op.subtitle = "adaptive sampling: median of the seeds, "
+                  "interval: 95% confidence interval of median of all seeds";
+    op.type = YY_CHART_BAR;
+    op.v_axis.categories = categories;
+    op.h_axis.title = "average CPU cycles";
+    op.plot.value_labels_enabled = true;
+    op.plot.value_labels_decimals = 2;
+    op.plot.group_padding = 0.1f;
+    op.plot.point_padding = 0.0f;
+    op.plot.border_width = 0.0f;
+    op.legend.enabled = true;
+    op.tooltip.value_decimals = 2;
+    op.tooltip.shared = true;
+    op.width = 640;
+    op.height = 720;
+    yy_chart_set_options(chart, &op);
+    return chart;
+}
+
+void bench_sample_chart_add(yy_chart *chart, const char *name,
+                            const bench_sample *res, int count, usize num) {
+    u64 meds[BENCH_SAMPLE_SEED_MAX];
+    u64 lo = UINT64_MAX, hi = 0;
+    char buf[128];
+    if (count <= 0) return;
+    if (count > BENCH_SAMPLE_SEED_MAX) count = BENCH_SAMPLE_SEED_MAX;
+    
+    for (int i = 0; i < count; i++) {
+        sample_insert(meds, i, res[i].ticks_med);
+        if (res[i].ticks_lo < lo) lo = res[i].ticks_lo;
+        if (res[i].ticks_hi > hi) hi = res[i].ticks_hi;
+    }
+    f64 cpt = bench_cpu_get_cycle_per_tick();
+    f64 med = (f64)meds[count / 2] / (f64)num * cpt;
+    f64 low = (f64)lo / (f64)num * cpt;
+    f64 high = (f64)hi / (f64)num * cpt;
+    f64 width = med > 0 ? (high - low) / 2.0 / med * 100.0 : 0;
+    snprintf(buf, sizeof(buf), "%s (+/-%.1f%%)", name, width);
+    
+    /* the chart has no error bar, the interval is drawn as grouped bars */
+    yy_chart_item_begin(chart, buf);
+    yy_chart_item_add_float(chart, (f32)low);
+    yy_chart_item_add_float(chart, (f32)med);
+    yy_chart_item_add_float(chart, (f32)high);
+    yy_chart_item_end(chart);
+}
+
+bool bench_report_add_sample_info(yy_report *report) {
+    char info[256];
+    snprintf(info, sizeof(info),
+             "Adaptive sampling: %d seeds, target interval %.1f%% of median, "
+             "%d/%d measurements converged, %.1f samples on average",
+             sample_seeds, BENCH_SAMPLE_CI_WIDTH * 100.0, sample_converged,
+             sample_runs, sample_runs ? (f64)sample_total / sample_runs : 0.0);
+    return yy_report_add_info(report, info);
+}
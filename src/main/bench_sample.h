@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2018 YaoYuan <ibireme@gmail.com>.
+ * Released under the MIT license (MIT).
+ */
+
+#ifndef bench_sample_h
+#define bench_sample_h
+
+#include "yybench.h"
+#include "bench_isolate.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*----------------------------------------------------------------------------*/
+/**
+ Adaptive sampling: a measurement is repeated until the 95% confidence
+ interval of the median is narrow enough (relative to the median), or the time
+ budget runs out, so a fast function is not over-measured and a slow function
+ is not under-measured. The dataset is generated with several random seeds
+ (seed 0 is the default dataset), each seed is measured separately to show the
+ variance of the dataset.
+
+ The confidence interval of the median is distribution-free: the order
+ statistics at ranks n/2 -/+ 0.98*sqrt(n) of n sorted samples.
+ */
+
+/** Max seed count. */
+#define BENCH_SAMPLE_SEED_MAX 64
+
+/** Target width of the confidence interval (relative to the median). */
+#define BENCH_SAMPLE_CI_WIDTH 0.01
+
+/** Min sample count of one measurement. */
+#define BENCH_SAMPLE_MIN 10
+
+/** Max sample count of one measurement. */
+#define BENCH_SAMPLE_MAX 1000
+
+/** Time budget of one measurement in seconds. */
+#define BENCH_SAMPLE_BUDGET 0.2
+
+/** Random numbers skipped for each seed, larger than the numbers drawn by any
+    dataset. */
+#define BENCH_SAMPLE_SEED_STRIDE ((u64)1 << 20)
+
+/** The result of one measurement. */
+typedef struct {
+    int count;      /* sample count */
+    bool converged; /* the interval is narrower than the target width */
+    u64 ticks_med;  /* the median */
+    u64 ticks_lo;   /* the lower bound of the confidence interval */
+    u64 ticks_hi;   /* the upper bound of the confidence interval */
+} bench_sample;
+
+/** Set the seed count, 0 (default) to disable adaptive sampling mode. */
+void bench_sample_set_seeds(int num);
+
+/** Get the seed count, 0 if adaptive sampling mode is disabled. */
+int bench_sample_get_seeds(void);
+
+/** Reset the random number generator (yy_random) to the seed of index: the
+    default sequence skipped by `idx * BENCH_SAMPLE_SEED_STRIDE` numbers,
+    index 0 is the default seed (same as `yy_random_reset()`). */
+void bench_sample_seed(int idx);
+
+/**
+ Measure a function adaptively.
+ @param func The measurement function, it should run the input once and
+    return the ticks (one sample), see `bench_isolate_func`.
+ @param ctx The context passed to `func`.
+ @param data The input data passed to `func`.
+ @param res The result.
+ */
+void bench_sample_run(bench_isolate_func func, void *ctx, const void *data,
+                      bench_sample *res);
+
+/** Create a bar chart for the adaptive sampling mode, each function has three
+    bars: the low bound, the median and the high bound of the interval. */
+yy_chart *bench_sample_chart_new(const char *title);
+
+/** Add a function to the chart with the results of all seeds: the median of
+    the seed medians, the interval covers the intervals of all seeds. */
+void bench_sample_chart_add(yy_chart *chart, const char *name,
+                            const bench_sample *res, int count, usize num);
+
+/** Add the sampling summary (seeds, converged measurements). */
+bool bench_report_add_sample_info(yy_report *report);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* bench_sample_h */
@@ -0,0 +1,383 @@
+/*
+ * Copyright (c) 2018 YaoYuan <ibireme@gmail.com>.
+ * Released under the MIT license (MIT).
+ */
+
+#include "bench_search.h"
+#include "bench_cpu.h"
+
+/* the function name to search */
+static const char *search_target = NULL;
+
+void bench_search_set_target(const char *name) {
+    search_target = name;
+}
+
+const char *bench_search_get_target(void) {
+    return search_target;
+}
+
+
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct {
+    char data[BENCH_SEARCH_INPUT_MAX];
+    usize len;
+    u64 ticks;
+} search_input;
+
+typedef struct {
+    search_input items[BENCH_SEARCH_CORPUS_SIZE];
+    int count;
+} search_corpus;
+
+static yy_inline u64 search_f64_to_raw(f64 f) {
+    u64 u;
+    memcpy(&u, &f, 8);
+    return u;
+}
+
+static yy_inline f64 search_f64_from_raw(u64 u) {
+    f64 f;
+    memcpy(&f, &u, 8);
+    return f;
+}
+
+static char search_rand_digit(void) {
+    return (char)('0' + yy_random32_uniform(10));
+}
+
+/** Insert `n` bytes at `pos`, the tail is dropped if the length exceeds max. */
+static usize search_insert(char *s, usize len, usize max, usize pos,
+                           const char *ins, usize n) {
+    if (pos > len) pos = len;
+    if (pos + n > max) n = max - pos;
+    usize tail = len - pos;
+    if (pos + n + tail > max) tail = max - pos - n;
+    memmove(s + pos + n, s + pos, tail);
+    memcpy(s + pos, ins, n);
+    return pos + n + tail;
+}
+
+/** Mutate a number string, returns the new length. */
+static usize search_mutate_text(char *s, usize len, usize max,
+                                const search_input *other) {
+    char buf[BENCH_SEARCH_INPUT_MAX];
+    usize pos = len ? yy_random32_uniform((u32)len) : 0;
+    switch (yy_random32_uniform(9)) {
+        case 0: /* replace a char with a digit */
+            if (len) s[pos] = search_rand_digit();
+            break;
+        case 1: /* insert a digit */
+            buf[0] = search_rand_digit();
+            len = search_insert(s, len, max, pos, buf, 1);
+            break;
+        case 2: /* delete a char */
+            if (len > 1) {
+                memmove(s + pos, s + pos + 1, len - pos - 1);
+                len--;
+            }
+            break;
+        case 3: /* insert a run of zeros (or nines) */
+        case 4: {
+            usize n = yy_random32_range(1, 16);
+            memset(buf, yy_random32_uniform(2) ? '0' : '9', n);
+            len = search_insert(s, len, max, pos, buf, n);
+            break;
+        }
+        case 5: { /* duplicate a substring */
+            usize n = yy_random32_range(1, (u32)(len - pos));
+            memcpy(buf, s + pos, n);
+            len = search_insert(s, len, max, yy_random32_uniform((u32)len + 1), buf, n);
+            break;
+        }
+        case 6: { /* replace the exponent, biased to the edges of double */
+            for (usize i = 0; i < len; i++) {
+                if (s[i] == 'e' || s[i] == 'E') {
+                    len = i;
+                    break;
+                }
+            }
+            int exp = (int)yy_random32_range(0, 700) - 350;
+            usize n = (usize)snprintf(buf, sizeof(buf), "e%d", exp);
+            len = search_insert(s, len, max, len, buf, n);
+            break;
+        }
+        case 7: { /* swap two chars */
+            usize pos2 = yy_random32_uniform((u32)len);
+            char c = s[pos];
+            s[pos] = s[pos2];
+            s[pos2] = c;
+            break;
+        }
+        default: /* splice with another input */
+            if (other && other->len) {
+                usize pos2 = yy_random32_uniform((u32)other->len);
+                usize n = other->len - pos2;
+                if (pos + n > max) n = max - pos;
+                memcpy(s + pos, other->data + pos2, n);
+                len = pos + n;
+            }
+            break;
+    }
+    return len ? len : 1;
+}
+
+/** Mutate a double, keeps it finite. */
+static void search_mutate_f64(char *s, const search_input *other) {
+    u64 raw;
+    memcpy(&raw, s, 8);
+    u64 sig_mask = ((u64)1 << 52) - 1;
+    switch (yy_random32_uniform(7)) {
+        case 0: /* flip a bit */
+            raw ^= (u64)1 << yy_random32_uniform(64);
+            break;
+        case 1: /* a few ulp */
+            raw += yy_random32_range(1, 4);
+            break;
+        case 2:
+            raw -= yy_random32_range(1, 4);
+            break;
+        case 3: { /* randomize the low bits of significand */
+            u64 mask = ((u64)1 << yy_random32_range(1, 52)) - 1;
+            raw = (raw & ~mask) | (yy_random64() & mask);
+            break;
+        }
+        case 4: { /* fill the low bits of significand with 0 or 1 */
+            u64 mask = ((u64)1 << yy_random32_range(1, 52)) - 1;
+            raw = yy_random32_uniform(2) ? (raw | mask) : (raw & ~mask);
+            break;
+        }
+        case 5: /* random exponent */
+            raw = (raw & ~(0x7FFULL << 52)) | ((u64)yy_random32_uniform(0x7FF) << 52);
+            break;
+        default: /* exponent of another input */
+            if (other) {
+                u64 raw2;
+                memcpy(&raw2, other->data, 8);
+                raw = (raw & (sig_mask | (1ULL << 63))) | (raw2 & ~(sig_mask | (1ULL << 63)));
+            }
+            break;
+    }
+    if (((raw >> 52) & 0x7FF) == 0x7FF) raw &= ~(1ULL << 62); /* nan or inf */
+    memcpy(s, &raw, 8);
+}
+
+/** Measure an input several times, returns the min ticks, 0 if invalid. */
+static u64 search_measure(const bench_search_options *op, const search_input *in, int count) {
+    u64 ticks_min = UINT64_MAX;
+    for (int i = 0; i < count; i++) {
+        u64 t = op->measure(op->ctx, in->data, in->len);
+        if (!t) return 0;
+        if (t < ticks_min) ticks_min = t;
+    }
+    return ticks_min;
+}
+
+/** Add an input to the corpus if it is slower than the fastest one. */
+static bool search_corpus_add(search_corpus *corpus, const search_input *in) {
+    int min_idx = 0;
+    for (int i = 0; i < corpus->count; i++) {
+        const search_input *cur = &corpus->items[i];
+        if (cur->len == in->len && memcmp(cur->data, in->data, in->len) == 0) return false;
+        if (cur->ticks < corpus->items[min_idx].ticks) min_idx = i;
+    }
+    if (corpus->count < BENCH_SEARCH_CORPUS_SIZE) {
+        corpus->items[corpus->count++] = *in;
+        return true;
+    }
+    if (in->ticks <= corpus->items[min_idx].ticks) return false;
+    corpus->items[min_idx] = *in;
+    return true;
+}
+
+/** Pick an input with tournament selection: the slower of two. */
+static const search_input *search_corpus_pick(const search_corpus *corpus) {
+    const search_input *a = &corpus->items[yy_random32_uniform((u32)corpus->count)];
+    const search_input *b = &corpus->items[yy_random32_uniform((u32)corpus->count)];
+    return a->ticks >= b->ticks ? a : b;
+}
+
+/** Set an input from text (a seed or a random number). */
+static bool search_input_set_text(const bench_search_options *op, search_input *in,
+                                  const char *str) {
+    usize len = strlen(str);
+    if (op->kind == BENCH_SEARCH_F64) {
+        f64 val = strtod(str, NULL);
+        if (!isfinite(val)) return false;
+        u64 raw = search_f64_to_raw(val);
+        memcpy(in->data, &raw, 8);
+        in->len = 8;
+    } else {
+        if (len == 0 || len > BENCH_SEARCH_INPUT_MAX) return false;
+        if (op->len_max && len > op->len_max) return false;
+        memcpy(in->data, str, len);
+        in->len = len;
+    }
+    return true;
+}
+
+static int search_input_cmp(const void *a, const void *b) {
+    u64 x = ((const search_input *)a)->ticks, y = ((const search_input *)b)->ticks;
+    return x < y ? 1 : x > y ? -1 : 0;
+}
+
+bool bench_search_run(const bench_search_options *op, const char *output_path) {
+    search_corpus *corpus = (search_corpus *)calloc(1, sizeof(search_corpus));
+    if (!corpus) return false;
+    usize len_max = op->len_max;
+    if (len_max == 0 || len_max > BENCH_SEARCH_INPUT_MAX) len_max = BENCH_SEARCH_INPUT_MAX;
+    f64 cpt = bench_cpu_get_cycle_per_tick() / BENCH_SEARCH_CALLS;
+    yy_random_reset();
+
+    /* initial corpus: seeds, then random numbers */
+    search_input in;
+    for (int i = 0; i < op->seed_count; i++) {
+        if (!search_input_set_text(op, &in, op->seeds[i])) continue;
+        if ((in.ticks = search_measure(op, &in, 4))) search_corpus_add(corpus, &in);
+    }
+    for (int i = 0; i < BENCH_SEARCH_CORPUS_SIZE * 4 &&
+                    corpus->count < BENCH_SEARCH_CORPUS_SIZE; i++) {
+        char str[32];
+        snprintf(str, sizeof(str), "%.17g",
+                 search_f64_from_raw(yy_random64() & ~(1ULL << 62)));
+        if (!search_input_set_text(op, &in, str)) continue;
+        if ((in.ticks = search_measure(op, &in, 4))) search_corpus_add(corpus, &in);
+    }
+    if (!corpus->count) {
+        printf("[ERROR] no valid input for search: %s\n", op->name);
+        free(corpus);
+        return false;
+    }
+
+    /* evolve the corpus until time is up */
+    u64 iter = 0, accepted = 0;
+    f64 time_begin = yy_time_get_seconds(), time_print = time_begin;
+    for (;;) {
+        f64 now = yy_time_get_seconds();
+        if (now - time_begin > BENCH_SEARCH_SECONDS) break;
+        if (now - time_print >= 5.0) {
+            /* measure the corpus again, so a noisy result does not stay */
+            u64 worst = 0;
+            for (int i = 0; i < corpus->count; i++) {
+                search_input *cur = &corpus->items[i];
+                u64 t = search_measure(op, cur, 4);
+                if (t && t < cur->ticks) cur->ticks = t;
+                if (cur->ticks > worst) worst = cur->ticks;
+            }
+            printf("search %s: %llu mutations, %llu accepted, worst %.1f cycles\n",
+                   op->name, (unsigned long long)iter, (unsigned long long)accepted,
+                   (f64)worst * cpt);
+            time_print = now;
+        }
+
+        in = *search_corpus_pick(corpus);
+        const search_input *other = &corpus->items[yy_random32_uniform((u32)corpus->count)];
+        int rounds = (int)yy_random32_range(1, 4);
+        for (int r = 0; r < rounds; r++) {
+            if (op->kind == BENCH_SEARCH_F64) search_mutate_f64(in.data, other);
+            else in.len = search_mutate_text(in.data, in.len, len_max, other);
+        }
+        iter++;
+
+        /* measure again before accepting, to filter out the noise */
+        if (!(in.ticks = search_measure(op, &in, 2))) continue;
+        if (corpus->count == BENCH_SEARCH_CORPUS_SIZE) {
+            u64 min = UINT64_MAX;
+            for (int i = 0; i < corpus->count; i++) {
+                if (corpus->items[i].ticks < min) min = corpus->items[i].ticks;
+            }
+            if (in.ticks <= min) continue;
+            u64 t = search_measure(op, &in, 4);
+            if (t < in.ticks) in.ticks = t;
+        }
+        if (search_corpus_add(corpus, &in)) accepted++;
+    }
+
+    /* measure the corpus again, and sort by cycles */
+    for (int i = 0; i < corpus->count; i++) {
+        corpus->items[i].ticks = search_measure(op, &corpus->items[i], 16);
+    }
+    qsort(corpus->items, (size_t)corpus->count, sizeof(search_input), search_input_cmp);
+    printf("search %s: worst %.1f cycles, %d inputs\n", op->name,
+           (f64)corpus->items[0].ticks * cpt, corpus->count);
+
+    /* write dataset file */
+    usize size = 1024 + (usize)corpus->count * (BENCH_SEARCH_INPUT_MAX + 2);
+    char *dat = (char *)malloc(size);
+    if (!dat) {
+        free(corpus);
+        return false;
+    }
+    char limit[32] = { 0 };
+    if (op->kind == BENCH_SEARCH_TEXT) snprintf(limit, sizeof(limit), "max %d chars, ", (int)len_max);
+    usize pos = (usize)snprintf(dat, size,
+        "# ==============================================================================\n"
+        "# Worst-case inputs of %s, found by cycles-guided search\n"
+        "# (%s%llu mutations), sorted by cycles per call:\n"
+        "# %.1f (worst) to %.1f, %s\n\n",
+        op->name, limit, (unsigned long long)iter,
+        (f64)corpus->items[0].ticks * cpt,
+        (f64)corpus->items[corpus->count - 1].ticks * cpt, yy_env_get_cpu_desc());
+    for (int i = 0; i < corpus->count; i++) {
+        const search_input *cur = &corpus->items[i];
+        if (op->kind == BENCH_SEARCH_F64) {
+            u64 raw;
+            memcpy(&raw, cur->data, 8);
+            pos += (usize)snprintf(dat + pos, size - pos, "%.17g\n", search_f64_from_raw(raw));
+        } else {
+            memcpy(dat + pos, cur->data, cur->len);
+            pos += cur->len;
+            dat[pos++] = '\n';
+        }
+    }
+    bool suc = yy_file_write(output_path, (u8 *)dat, pos);
+    if (!suc) printf("[ERROR] write dataset failed: %s\n", output_path);
+    else printf("dataset generated: %s\n", output_path);
+    free(dat);
+    free(corpus);
+    return suc;
+}
+
+
+
+/*----------------------------------------------------------------------------*/
+
+char **bench_search_read_lines(const char *dir, const char *prefix, int *count) {
+    int file_count = 0, line_count = 0, line_cap = 0;
+    char **lines = NULL;
+    char **file_names = yy_dir_read(dir, &file_count);
+    *count = 0;
+    if (!file_names) return NULL;
+
+    for (int f = 0; f < file_count; f++) {
+        if (!yy_str_has_prefix(file_names[f], prefix)) continue;
+        char path[YY_MAX_PATH];
+        yy_path_combine(path, dir, file_names[f], NULL);
+        yy_dat dat;
+        if (!yy_dat_init_with_file(&dat, path)) continue;
+        usize len;
+        char *line;
+        while ((line = yy_dat_copy_line(&dat, &len))) {
+            if (len == 0 || line[0] == '#') {
+                free(line);
+                continue;
+            }
+            if (line_count == line_cap) {
+                line_cap = line_cap ? line_cap * 2 : 64;
+                lines = (char **)realloc(lines, (usize)line_cap * sizeof(char *));
+            }
+            lines[line_count++] = line;
+        }
+        yy_dat_release(&dat);
+    }
+    yy_dir_free(file_names);
+    *count = line_count;
+    return lines;
+}
+
+void bench_search_free_lines(char **lines, int count) {
+    for (int i = 0; i < count; i++) free(lines[i]);
+    free(lines);
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2018 YaoYuan <ibireme@gmail.com>.
+ * Released under the MIT license (MIT).
+ */
+
+#ifndef bench_search_h
+#define bench_search_h
+
+#include "yybench.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*----------------------------------------------------------------------------*/
+/**
+ Worst-case input search ("performance fuzzing"): a built-in mutator evolves a
+ corpus of inputs to maximize the CPU cycles per call of one function, such as
+ long runs of zeros or values near a halfway point that force a slow path
+ (bigint fallback, Grisu fallback...). The worst inputs are written as a
+ dataset file, in the same format as the files in `data/`.
+
+ The search is guided by cycles only, the functions are not instrumented for
+ coverage, so a corpus of many different inputs is kept.
+ */
+
+/** Max input length in bytes. */
+#define BENCH_SEARCH_INPUT_MAX 64
+
+/** Corpus size, and the number of inputs written to the dataset file. */
+#define BENCH_SEARCH_CORPUS_SIZE 64
+
+/** Calls per measurement (the input is cached, like a hostile payload). */
+#define BENCH_SEARCH_CALLS 16
+
+/** Search time in seconds. */
+#define BENCH_SEARCH_SECONDS 60
+
+/** Input kind, decides how inputs are mutated and written. */
+typedef enum {
+    BENCH_SEARCH_TEXT,  /* number string, such as "1.2345e-300" */
+    BENCH_SEARCH_F64,   /* double (8 bytes), written as "%.17g" */
+} bench_search_kind;
+
+/**
+ Measure an input.
+ @param ctx The context in `bench_search_options`.
+ @param input The input (not null-terminated).
+ @param len The input length in bytes.
+ @return The min ticks of `BENCH_SEARCH_CALLS` calls, 0 if the input is
+    invalid (such as a string not fully consumed, or a nan).
+ */
+typedef u64 (*bench_search_measure_func)(void *ctx, const char *input, usize len);
+
+typedef struct {
+    const char *name;               /* function name, such as "strtod yy" */
+    bench_search_kind kind;
+    usize len_max;                  /* max text length (<= BENCH_SEARCH_INPUT_MAX) */
+    bench_search_measure_func measure;
+    void *ctx;
+    const char **seeds;             /* seed inputs (text), may be NULL */
+    int seed_count;
+} bench_search_options;
+
+/** Set the function name to search, NULL (default) to run the benchmark. */
+void bench_search_set_target(const char *name);
+
+/** Get the function name to search, NULL if search mode is disabled. */
+const char *bench_search_get_target(void);
+
+/** Run the search and write the worst inputs to a dataset file. */
+bool bench_search_run(const bench_search_options *op, const char *output_path);
+
+/**
+ Read the inputs of dataset files with a name prefix (such as "worst_strtod_")
+ in a directory, each line is an input, '#' for comments.
+ @return The inputs (free with `bench_search_free_lines()`), NULL if not found.
+ */
+char **bench_search_read_lines(const char *dir, const char *prefix, int *count);
+
+/** Free the return value of `bench_search_read_lines()`. */
+void bench_search_free_lines(char **lines, int count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* bench_search_h */
@@ -4,17 +4,55 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <stdbool.h>
 
 extern void benchmark(const char *path);
+extern void bench_cpu_set_core(int core);
+extern void bench_isolate_set_variants(int num);
+extern bool bench_corun_set_antagonist(const char *name);
+extern void bench_corun_set_core(int core);
+extern void bench_search_set_target(const char *name);
+extern void bench_sample_set_seeds(int num);
+extern void bench_direct_set_enabled(bool enabled);
 
 int main(int argc, const char *argv[]) {
-    
-    if (argc != 3 || strcmp(argv[1], "-o") != 0 || strlen(argv[2]) < 1) {
-        printf("usage: -o report.html\n");
+    const char *path = NULL;
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (strcmp(argv[i], "-o") == 0) {
+            path = argv[i + 1];
+        } else if (strcmp(argv[i], "-c") == 0) {
+            bench_cpu_set_core(atoi(argv[i + 1]));
+        } else if (strcmp(argv[i], "-i") == 0) {
+            bench_isolate_set_variants(atoi(argv[i + 1]));
+        } else if (strcmp(argv[i], "-a") == 0) {
+            if (!bench_corun_set_antagonist(argv[i + 1])) {
+                path = NULL;
+                break;
+            }
+        } else if (strcmp(argv[i], "-s") == 0) {
+            bench_corun_set_core(atoi(argv[i + 1]));
+        } else if (strcmp(argv[i], "-w") == 0) {
+            bench_search_set_target(argv[i + 1]);
+        } else if (strcmp(argv[i], "-r") == 0) {
+            bench_sample_set_seeds(atoi(argv[i + 1]));
+        } else if (strcmp(argv[i], "-d") == 0) {
+            bench_direct_set_enabled(atoi(argv[i + 1]) != 0);
+        } else {
+            path = NULL;
+            break;
+        }
+    }
+    if ((argc % 2) != 1 || !path || strlen(path) < 1) {
+        printf("usage: -o report.html [-c cpu_core] [-i offset_variants]\n"
+               "       [-a stream|table|numconv] [-s co-runner_core] [-r seeds]\n"
+               "       [-d 0|1 (direct-call)]\n"
+               "       -o dataset.txt -w func_name (worst-case search, dtoa and strtod)\n");
         return 0;
     }
-    
-    benchmark(argv[2]);
+
+    benchmark(path);
     return 0;
 }
@@ -0,0 +1,661 @@
+/*
+ * Copyright (c) 2018 YaoYuan <ibireme@gmail.com>.
+ * Released under the MIT license (MIT).
+ */
+
+#include "quad.h"
+#include "yybench.h"
+#include "bench_cpu.h"
+#include <inttypes.h>
+
+/*----------------------------------------------------------------------------*/
+/**
+ This benchmark writes and reads 128-bit floats (binary128, `__float128`) and
+ 80-bit floats (x87 extended, `long double` on x86). `libc` uses libquadmath
+ and the C library as the baseline, it's skipped if the type is not supported.
+
+ The output should read back as the same value with the shortest digits. The
+ input is verified with the exact halfway points between two adjacent values,
+ which are written with all decimal digits (up to 11500 digits).
+ */
+
+/** Value count of each case. */
+#define QUAD_SAMPLE_COUNT 2000
+
+/** Value count of each dataset in verification. */
+#define QUAD_VERIFY_COUNT 10000
+
+/** Halfway point count of each dataset in verification. */
+#define QUAD_VERIFY_HALFWAY_COUNT 500
+
+/** Slot size of each string. */
+#define QUAD_SLOT_LEN 64
+
+/** Build the power of 10 table of quad_yy.c (not thread-safe). */
+void quad_yy_init(void);
+
+extern int quad_yy_available;
+extern int quad_libc_available_f128;
+extern int quad_libc_available_f80;
+
+#if defined(__SIZEOF_INT128__)
+
+typedef unsigned __int128 u128;
+
+
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct {
+    const char *name;
+    int prec; /* significant bits */
+    int digits; /* max output digits */
+    bool is_f80; /* explicit integer bit, the exponent in low 16 bits of hi */
+} quad_type;
+
+static const quad_type quad_type_arr[] = {
+    { "binary128", 113, QUAD_F128_DIGITS, false },
+    { "x87 extended", 64, QUAD_F80_DIGITS, true },
+};
+static const int quad_type_num = (int)(sizeof(quad_type_arr) / sizeof(quad_type));
+
+typedef struct {
+    quad_to_str_func to_str[2]; /* binary128, x87 extended */
+    quad_from_str_func from_str[2];
+    bool available[2];
+    const char *name;
+    bool exact; /* shortest output, correctly rounded input */
+} quad_group;
+
+static int quad_group_num = 0;
+static quad_group quad_group_arr[16];
+static int quad_group_name_max = 0;
+
+static char *quad_group_get_name_aligned(quad_group group) {
+    static char buf[64];
+    int len = (int)strlen(group.name);
+    int space = quad_group_name_max - len;
+    memcpy(buf, group.name, len);
+    for (int i = 0; i < space; i++) buf[len + i] = ' ';
+    buf[quad_group_name_max] = '\0';
+    return buf;
+}
+
+/** Returns the exponent field. */
+static u32 quad_get_field(quad_raw raw, quad_type type) {
+    return (u32)(type.is_f80 ? raw.hi : raw.hi >> 48) & 0x7FFF;
+}
+
+static bool quad_is_special(quad_raw raw, quad_type type) {
+    return quad_get_field(raw, type) == 0x7FFF;
+}
+
+static bool quad_is_nan(quad_raw raw, quad_type type) {
+    if (!quad_is_special(raw, type)) return false;
+    if (type.is_f80) return (raw.lo << 1) != 0;
+    return ((raw.hi & 0x0000FFFFFFFFFFFFULL) | raw.lo) != 0;
+}
+
+static bool quad_is_neg(quad_raw raw, quad_type type) {
+    return type.is_f80 ? ((raw.hi >> 15) & 1) : (raw.hi >> 63);
+}
+
+/** Same value (NaN equals to NaN), the unused bits of x87 extended are ignored. */
+static bool quad_equal(quad_raw a, quad_raw b, quad_type type) {
+    if (quad_is_nan(a, type) || quad_is_nan(b, type)) {
+        return quad_is_nan(a, type) && quad_is_nan(b, type);
+    }
+    if (type.is_f80) return a.lo == b.lo && (a.hi & 0xFFFF) == (b.hi & 0xFFFF);
+    return a.lo == b.lo && a.hi == b.hi;
+}
+
+/** Make a value with the exponent field and the significand (the fraction
+    bits for binary128, all 64 bits for x87 extended). */
+static quad_raw quad_make(quad_type type, bool neg, u32 field, u128 sig) {
+    quad_raw raw;
+    if (type.is_f80) {
+        raw.lo = (u64)sig;
+        raw.hi = (u64)field | ((u64)neg << 15);
+    } else {
+        raw.lo = (u64)sig;
+        raw.hi = ((u64)(sig >> 64) & 0x0000FFFFFFFFFFFFULL) |
+                 ((u64)field << 48) | ((u64)neg << 63);
+    }
+    return raw;
+}
+
+/** Decode a finite value: abs(value) == sig * 2^exp. */
+static void quad_get_sig_exp(quad_raw raw, quad_type type, u128 *sig, i32 *exp) {
+    u32 field = quad_get_field(raw, type);
+    i32 e = (field ? (i32)field : 1) - 16383 - (type.prec - 1);
+    if (type.is_f80) {
+        *sig = raw.lo;
+    } else {
+        *sig = ((u128)(raw.hi & 0x0000FFFFFFFFFFFFULL) << 64) | raw.lo;
+        if (field) *sig |= (u128)1 << 112;
+    }
+    *exp = e;
+}
+
+/** The next value away from zero (finite only, may be inf). */
+static quad_raw quad_next(quad_raw raw, quad_type type) {
+    if (type.is_f80) {
+        u32 field = quad_get_field(raw, type);
+        raw.lo++;
+        if (raw.lo == 0) { /* carry: 1.111 -> 10.000 */
+            raw.lo = 1ULL << 63;
+            raw.hi++;
+        } else if (field == 0 && raw.lo == (1ULL << 63)) { /* subnormal to normal */
+            raw.hi++;
+        }
+    } else {
+        raw.lo++;
+        if (raw.lo == 0) raw.hi++;
+    }
+    return raw;
+}
+
+/** Write u128 as decimal string, returns the end. */
+static char *u128_to_str(u128 val, char *buf) {
+    char tmp[48];
+    int len = 0;
+    do {
+        tmp[len++] = (char)('0' + (int)(val % 10));
+        val /= 10;
+    } while (val);
+    while (len) *buf++ = tmp[--len];
+    *buf = '\0';
+    return buf;
+}
+
+/**
+ Read the significant digits of a decimal string (such as -1.25e-5) without
+ the leading and trailing zeros, `exp` is set to the power of the last digit.
+ Returns the digit count.
+ */
+static int dec_get_digits(const char *str, char *digits, i32 *exp) {
+    const char *cur = str;
+    int len = 0, frac = 0, first = 0;
+    bool dot = false;
+    for (; *cur && *cur != 'e' && *cur != 'E'; cur++) {
+        if (*cur == '.') dot = true;
+        if (*cur < '0' || *cur > '9') continue;
+        digits[len++] = *cur;
+        frac += dot;
+    }
+    *exp = (*cur ? (i32)atoi(cur + 1) : 0) - frac;
+    while (len && digits[len - 1] == '0') {
+        len--;
+        (*exp)++;
+    }
+    while (first < len && digits[first] == '0') first++;
+    memmove(digits, digits + first, (usize)(len - first));
+    len -= first;
+    digits[len] = '\0';
+    return len;
+}
+
+/**
+ Write `sig * 2^exp` with all decimal digits (such as 15e-1), the last digit is
+ not zero. The buffer should be at least 12000 bytes.
+ */
+static void dec_write_exact(u128 sig, i32 exp, char *buf) {
+    static u32 limbs[1400]; /* base 1e9, little-endian */
+    u32 len = 0;
+    i32 exp10 = 0;
+
+    while (sig) {
+        limbs[len++] = (u32)(sig % 1000000000);
+        sig /= 1000000000;
+    }
+    /* multiply by 2^exp, or by 5^-exp (with the power of 10 decreased) */
+    u32 count = (u32)(exp < 0 ? -exp : exp);
+    while (count) {
+        u32 step, mul;
+        if (exp > 0) {
+            step = count < 29 ? count : 29;
+            mul = 1u << step;
+        } else {
+            step = count < 12 ? count : 12;
+            mul = 1;
+            for (u32 i = 0; i < step; i++) mul *= 5;
+        }
+        u64 carry = 0;
+        for (u32 i = 0; i < len; i++) {
+            carry += (u64)limbs[i] * mul;
+            limbs[i] = (u32)(carry % 1000000000);
+            carry /= 1000000000;
+        }
+        while (carry) {
+            limbs[len++] = (u32)(carry % 1000000000);
+            carry /= 1000000000;
+        }
+        count -= step;
+    }
+    if (exp < 0) exp10 = exp;
+
+    char *cur = buf + sprintf(buf, "%u", limbs[len - 1]);
+    for (u32 i = len - 1; i-- > 0;) cur += sprintf(cur, "%09u", limbs[i]);
+    while (cur[-1] == '0') {
+        cur--;
+        exp10++;
+    }
+    sprintf(cur, "e%d", exp10);
+}
+
+
+
+/*----------------------------------------------------------------------------*/
+
+typedef enum {
+    dataset_random,
+    dataset_random_len,
+    dataset_normalized,
+    dataset_integer,
+    dataset_subnormal
+} dataset_kind;
+
+typedef struct {
+    const char *name;
+    const char *desc;
+    dataset_kind kind;
+} dataset_t;
+
+static dataset_t dataset_arr[] = {
+    { "random", "random number in all binary range, ignore nan and inf", dataset_random },
+    { "random length", "random number with random significant digit count", dataset_random_len },
+    { "nomalized", "random number in range 0.0 to 1.0", dataset_normalized },
+    { "integer", "random number from integer", dataset_integer },
+    { "subnormal", "random subnormal number", dataset_subnormal },
+};
+static const int dataset_num = (int)(sizeof(dataset_arr) / sizeof(dataset_t));
+
+static u128 rand_u128(void) {
+    return ((u128)yy_random64() << 64) | yy_random64();
+}
+
+/** Fill random values of the dataset, `parse` reads the random length input. */
+static void fill_quad_random(quad_raw *vals, u32 count, quad_type type,
+                             dataset_t dataset, quad_from_str_func parse) {
+    u128 man_mask = type.is_f80 ? (u128)UINT64_MAX : ((u128)1 << 112) - 1;
+    for (u32 i = 0; i < count; i++) {
+        bool neg = yy_random32_uniform(2);
+        u32 field;
+        u128 sig;
+        switch (dataset.kind) {
+            case dataset_random:
+            default: {
+                field = yy_random32_uniform(0x7FFF);
+                sig = rand_u128() & man_mask;
+                if (type.is_f80) {
+                    if (field) sig |= (u128)1 << 63;
+                    else sig &= ~((u128)1 << 63);
+                }
+                break;
+            }
+            case dataset_random_len: {
+                char str[QUAD_SLOT_LEN], *end;
+                u32 len = yy_random32_range(1, (u32)type.digits);
+                str[0] = (char)('0' + yy_random32_range(1, 9));
+                for (u32 d = 1; d < len; d++) str[d] = (char)('0' + yy_random32_uniform(10));
+                snprintf(str + len, 16, "e%d", (int)yy_random32_uniform(9800) - 4900);
+                vals[i] = parse(str, strlen(str), &end);
+                if (neg) vals[i].hi |= type.is_f80 ? 0x8000 : (1ULL << 63);
+                continue;
+            }
+            case dataset_normalized: { /* uniform in [0, 1) */
+                u64 r = yy_random64();
+                u32 zeros = 0;
+                while (zeros < 63 && !(r >> 63)) {
+                    r <<= 1;
+                    zeros++;
+                }
+                field = 16383 - 1 - zeros;
+                sig = rand_u128() & man_mask;
+                if (type.is_f80) sig |= (u128)1 << 63;
+                break;
+            }
+            case dataset_integer: {
+                u32 len = yy_random32_range(1, (u32)type.prec);
+                sig = (rand_u128() >> (128 - len)) | ((u128)1 << (len - 1));
+                field = 16383 + len - 1;
+                sig = (sig << (type.prec - len)) & man_mask;
+                if (type.is_f80) sig |= (u128)1 << 63;
+                break;
+            }
+            case dataset_subnormal: {
+                field = 0;
+                do {
+                    sig = rand_u128() & (type.is_f80 ? (((u128)1 << 63) - 1) : man_mask);
+                    sig >>= yy_random32_uniform((u32)type.prec - 1);
+                } while (!sig);
+                break;
+            }
+        }
+        vals[i] = quad_make(type, neg, field, sig);
+    }
+}
+
+/** Write a random decimal string (maybe long), returns the length. */
+static u32 fill_dec_random(char *str) {
+    char *cur = str;
+    u32 len = yy_random32_uniform(4) ? yy_random32_range(1, 40) : yy_random32_range(41, 200);
+    if (yy_random32_uniform(2)) *cur++ = '-';
+    *cur++ = (char)('0' + yy_random32_range(1, 9));
+    for (u32 d = 1; d < len; d++) *cur++ = (char)('0' + yy_random32_uniform(10));
+    cur += sprintf(cur, "e%d", (int)yy_random32_uniform(10000) - 5100);
+    return (u32)(cur - str);
+}
+
+
+
+/*----------------------------------------------------------------------------*/
+
+static void quad_group_verify_all(void) {
+    quad_group ref = quad_group_arr[0]; /* yy */
+    quad_raw *vals = malloc(QUAD_VERIFY_COUNT * sizeof(quad_raw));
+    char *tie = malloc(12100), *str = malloc(12100);
+    if (!vals || !tie || !str) {
+        printf("memory allocation failed.\n");
+        free(vals);
+        free(tie);
+        free(str);
+        return;
+    }
+
+    for (int g = 0; g < quad_group_num; g++) {
+        quad_group group = quad_group_arr[g];
+        int trip_err = 0, short_err = 0, tie_err = 0, cmp_err = 0;
+
+        for (int t = 0; t < quad_type_num; t++) {
+            quad_type type = quad_type_arr[t];
+            quad_to_str_func to_str = group.to_str[t];
+            quad_from_str_func from_str = group.from_str[t];
+            quad_from_str_func ref_from_str = ref.from_str[t];
+            if (!group.available[t]) continue;
+
+            yy_random_reset();
+            for (int d = 0; d < dataset_num; d++) {
+                fill_quad_random(vals, QUAD_VERIFY_COUNT, type, dataset_arr[d], ref_from_str);
+
+                /* read back as the same value, and the shortest */
+                for (u32 i = 0; i < QUAD_VERIFY_COUNT; i++) {
+                    quad_raw val = vals[i], back;
+                    char out[QUAD_SLOT_LEN], digits[QUAD_SLOT_LEN], *end;
+                    char *out_end = to_str(val, out);
+                    if (out_end != out + strlen(out)) {
+                        trip_err++;
+                        continue;
+                    }
+                    back = from_str(out, strlen(out), &end);
+                    if (!quad_equal(back, val, type) || end != out_end) {
+                        if (trip_err++ < 4 && group.exact) {
+                            printf("%s_%s round trip fail, bits:0x%016" PRIX64 "%016" PRIX64
+                                   ", str:%s\n", type.name, group.name, val.hi, val.lo, out);
+                        }
+                    }
+
+                    /* no shorter decimal (the neighbors of the nearest) reads back */
+                    i32 exp10;
+                    int n = dec_get_digits(out, digits, &exp10);
+                    if (n < 2) continue;
+                    u128 trunc = 0;
+                    for (int k = 0; k < n - 1; k++) trunc = trunc * 10 + (u128)(digits[k] - '0');
+                    for (int k = -1; k <= 2; k++) {
+                        char tmp[QUAD_SLOT_LEN * 2], *cur = tmp;
+                        if (quad_is_neg(val, type)) *cur++ = '-';
+                        cur = u128_to_str(trunc + (u128)(i64)k, cur);
+                        sprintf(cur, "e%d", exp10 + 1);
+                        if (quad_equal(ref_from_str(tmp, strlen(tmp), &end), val, type)) {
+                            if (short_err++ < 4 && group.exact) {
+                                printf("%s_%s not shortest, str:%s, shorter:%s\n",
+                                       type.name, group.name, out, tmp);
+                            }
+                            break;
+                        }
+                    }
+                }
+
+                /* exact halfway points between two adjacent values */
+                for (u32 i = 0; i < QUAD_VERIFY_HALFWAY_COUNT; i++) {
+                    quad_raw lo = vals[i], hi, even;
+                    u128 sig;
+                    i32 exp;
+                    lo.hi &= type.is_f80 ? 0x7FFF : 0x7FFFFFFFFFFFFFFFULL; /* abs */
+                    hi = quad_next(lo, type);
+                    even = (lo.lo & 1) ? hi : lo;
+                    quad_get_sig_exp(lo, type, &sig, &exp);
+                    dec_write_exact(sig * 2 + 1, exp - 1, tie);
+                    char *e = strchr(tie, 'e');
+                    usize mant_len = (usize)(e - tie);
+
+                    for (int k = 0; k < 3; k++) {
+                        quad_raw expect;
+                        memcpy(str + 1, tie, mant_len);
+                        char *cur = str + 1 + mant_len;
+                        i32 exp_adj = 0;
+                        if (k == 0) { /* tie: to even */
+                            expect = even;
+                        } else if (k == 1) { /* a bit above: up */
+                            memcpy(cur, "0001", 4);
+                            cur += 4;
+                            exp_adj = 4;
+                            expect = hi;
+                        } else { /* a bit below: down (the last digit is not zero) */
+                            cur[-1]--;
+                            memcpy(cur, "9999", 4);
+                            cur += 4;
+                            exp_adj = 4;
+                            expect = lo;
+                        }
+                        sprintf(cur, "e%d", atoi(e + 1) - exp_adj);
+                        str[0] = '-';
+                        for (int s = 0; s < 2; s++) {
+                            const char *in = s ? str : str + 1;
+                            char *end;
+                            quad_raw val = from_str(in, strlen(in), &end);
+                            quad_raw exp_val = expect;
+                            if (s) exp_val.hi |= type.is_f80 ? 0x8000 : (1ULL << 63);
+                            if (!quad_equal(val, exp_val, type)) {
+                                if (tie_err++ < 4 && group.exact) {
+                                    printf("%s_%s halfway fail, bits:0x%016" PRIX64 "%016" PRIX64
+                                           ", input:%.64s...\n", type.name, group.name,
+                                           lo.hi, lo.lo, in);
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+
+            /* random decimal strings, compared with the reference */
+            if (g == 0) continue;
+            for (u32 i = 0; i < QUAD_VERIFY_COUNT; i++) {
+                char *end;
+                u32 len = fill_dec_random(str);
+                quad_raw val = from_str(str, len, &end);
+                quad_raw exp_val = ref_from_str(str, len, &end);
+                if (!quad_equal(val, exp_val, type)) cmp_err++;
+            }
+        }
+
+        if (group.exact) {
+            printf("verify %s [%s]\n", quad_group_get_name_aligned(group),
+                   (trip_err || short_err || tie_err) ? "FAIL" : "OK");
+        } else {
+            printf("verify %s [round trip:%d, not shortest:%d, halfway:%d, mismatch:%d]\n",
+                   quad_group_get_name_aligned(group), trip_err, short_err, tie_err, cmp_err);
+        }
+    }
+    free(vals);
+    free(tie);
+    free(str);
+}
+
+
+
+/*----------------------------------------------------------------------------*/
+
+static void quad_group_benchmark_all(const char *output_path) {
+    static const int repeat_count = 16;
+
+    printf("initialize...\n");
+    bench_cpu_setup();
+
+    char *buf = malloc((usize)QUAD_SAMPLE_COUNT * QUAD_SLOT_LEN);
+    u32 *lens = malloc(QUAD_SAMPLE_COUNT * sizeof(u32));
+    quad_raw *vals = malloc(QUAD_SAMPLE_COUNT * sizeof(quad_raw));
+    if (!buf || !lens || !vals) {
+        printf("memory allocation failed.\n");
+        free(buf);
+        free(lens);
+        free(vals);
+        return;
+    }
+
+    yy_report *report = yy_report_new();
+    bench_report_add_env_info(report);
+
+    for (int t = 0; t < quad_type_num; t++) {
+        quad_type type = quad_type_arr[t];
+        for (int d = 0; d < dataset_num; d++) {
+            dataset_t dataset = dataset_arr[d];
+            printf("run benchmark %s %s...", type.name, dataset.name);
+
+            /* the values, and the strings written by yy */
+            yy_random_reset();
+            fill_quad_random(vals, QUAD_SAMPLE_COUNT, type, dataset, quad_group_arr[0].from_str[t]);
+            memset(buf, 0, (usize)QUAD_SAMPLE_COUNT * QUAD_SLOT_LEN);
+            for (u32 s = 0; s < QUAD_SAMPLE_COUNT; s++) {
+                char *str = buf + (usize)s * QUAD_SLOT_LEN;
+                lens[s] = (u32)(quad_group_arr[0].to_str[t](vals[s], str) - str);
+            }
+
+            for (int c = 0; c < 2; c++) {
+                bool is_write = (c == 0);
+                char title[128];
+                snprintf(title, sizeof(title), "%s %s (%s)", type.name,
+                         is_write ? "to string" : "from string", dataset.name);
+
+                yy_chart *chart = yy_chart_new();
+                yy_chart_options op;
+                yy_chart_options_init(&op);
+                op.title = title;
+                op.subtitle = dataset.desc;
+                op.type = YY_CHART_BAR;
+                op.h_axis.title = "average CPU cycles";
+                op.plot.value_labels_enabled = true;
+                op.plot.value_labels_decimals = 2;
+                op.plot.color_by_point = true;
+                op.plot.group_padding = 0.0f;
+                op.plot.point_padding = 0.1f;
+                op.plot.border_width = 0.0f;
+                op.legend.enabled = false;
+                op.tooltip.value_decimals = 2;
+                op.width = 640;
+                op.height = 240;
+
+                for (int g = 0; g < quad_group_num; g++) {
+                    quad_group group = quad_group_arr[g];
+                    quad_to_str_func to_str = group.to_str[t];
+                    quad_from_str_func from_str = group.from_str[t];
+                    char out[QUAD_SLOT_LEN];
+                    char *end;
+                    u64 ticks_min;
+                    if (!group.available[t]) continue;
+                    for (int retry = 0; ; retry++) {
+                        ticks_min = UINT64_MAX;
+                        for (int r = 0; r < repeat_count; r++) {
+                            u64 t1 = yy_time_get_ticks();
+                            if (is_write) {
+                                for (u32 s = 0; s < QUAD_SAMPLE_COUNT; s++) {
+                                    to_str(vals[s], out);
+                                }
+                            } else {
+                                for (u32 s = 0; s < QUAD_SAMPLE_COUNT; s++) {
+                                    from_str(buf + (usize)s * QUAD_SLOT_LEN, lens[s], &end);
+                                }
+                            }
+                            u64 t2 = yy_time_get_ticks();
+                            u64 t = t2 - t1;
+                            if (t < ticks_min) ticks_min = t;
+                        }
+                        if (bench_cpu_check_freq(retry)) break;
+                    }
+                    f64 cycles = (f64)ticks_min / QUAD_SAMPLE_COUNT * bench_cpu_get_cycle_per_tick();
+                    yy_chart_item_with_float(chart, group.name, (f32)cycles);
+                }
+                yy_chart_sort_items_with_value(chart, false);
+                yy_chart_set_options(chart, &op);
+                yy_report_add_chart(report, chart);
+                yy_chart_free(chart);
+            }
+            printf("[OK]\n");
+        }
+    }
+
+    bench_report_add_drift_info(report);
+    if (!yy_report_write_html_file(report, output_path)) {
+        printf("[ERROR] report write failed: %s\n", output_path);
+    } else {
+        printf("report generated: %s\n", output_path);
+    }
+    yy_report_free(report);
+    free(buf);
+    free(lens);
+    free(vals);
+}
+
+
+
+/*----------------------------------------------------------------------------*/
+
+static void quad_group_cleanup(void) {
+    quad_group_num = 0;
+    quad_group_name_max = 0;
+}
+
+static void quad_group_register_all(void) {
+#define register_group_name(_name, _exact, _f128_available, _f80_available) \
+    extern char *f128_to_str_##_name(quad_raw val, char *buf); \
+    extern char *f80_to_str_##_name(quad_raw val, char *buf); \
+    extern quad_raw str_to_f128_##_name(const char *str, size_t len, char **endptr); \
+    extern quad_raw str_to_f80_##_name(const char *str, size_t len, char **endptr); \
+    quad_group_arr[quad_group_num].name = #_name; \
+    quad_group_arr[quad_group_num].to_str[0] = f128_to_str_##_name; \
+    quad_group_arr[quad_group_num].to_str[1] = f80_to_str_##_name; \
+    quad_group_arr[quad_group_num].from_str[0] = str_to_f128_##_name; \
+    quad_group_arr[quad_group_num].from_str[1] = str_to_f80_##_name; \
+    quad_group_arr[quad_group_num].available[0] = (_f128_available) != 0; \
+    quad_group_arr[quad_group_num].available[1] = (_f80_available) != 0; \
+    quad_group_arr[quad_group_num].exact = _exact; \
+    if (quad_group_name_max < (int)strlen(#_name)) quad_group_name_max = (int)strlen(#_name); \
+    quad_group_num++;
+
+    register_group_name(yy, true, 1, 1); /* the first one is used as reference */
+    register_group_name(libc, false, quad_libc_available_f128, quad_libc_available_f80);
+}
+
+void benchmark(const char *output_path) {
+    if (!quad_yy_available) {
+        printf("quad benchmark requires 128-bit integer support.\n");
+        return;
+    }
+    quad_group_register_all();
+    quad_yy_init();
+    printf("------[verify]---------\n");
+    quad_group_verify_all();
+    printf("------[benchmark]------\n");
+    quad_group_benchmark_all(output_path);
+    printf("------[finish]---------\n");
+    quad_group_cleanup();
+}
+
+#else
+
+void benchmark(const char *output_path) {
+    (void)output_path;
+    printf("quad benchmark requires 128-bit integer support.\n");
+}
+
+#endif
@@ -0,0 +1,45 @@
+#ifndef quad_h
+#define quad_h
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ 128-bit and 80-bit floating point number to/from string.
+
+ binary128 (IEEE 754 quad, GCC `__float128`): 1 sign bit, 15 exponent bits,
+ 112 fraction bits (113 significant bits with the hidden bit).
+ x87 extended (`long double` on x86): 1 sign bit, 15 exponent bits, 64
+ significant bits (the integer bit is explicit).
+
+ The number is passed as raw bits. The string format is the same as `dtoa_yy`
+ (such as 0.1, 1.0, 1e-4966, NaN, Infinity), with the shortest digits which
+ read back as the same value (up to 36 digits for binary128, 21 digits for x87
+ extended). The string is null-terminated, the buffer should be at least 64
+ bytes.
+
+ The reader accepts the same grammar as `yy_string_to_double()` (JSON number,
+ Inf, Infinity and NaN), the result is correctly rounded (round to nearest,
+ ties to even). Returns 0 and sets `endptr` to `str` if failed.
+ */
+
+/** Raw bits of a 128-bit or 80-bit float, in little-endian order: the x87
+    extended value uses the 64-bit significand in `lo` and the sign and the
+    exponent in the low 16 bits of `hi`. */
+typedef struct {
+    uint64_t lo;
+    uint64_t hi;
+} quad_raw;
+
+/** Write a float (raw bits) as string, returns the end of string. */
+typedef char *(*quad_to_str_func)(quad_raw val, char *buf);
+
+/** Read a string as float (raw bits), `len` is the string length (the string
+    is also null-terminated). */
+typedef quad_raw (*quad_from_str_func)(const char *str, size_t len, char **endptr);
+
+/** The max significant digit count of the output. */
+#define QUAD_F128_DIGITS 36
+#define QUAD_F80_DIGITS 21
+
+#endif /* quad_h */
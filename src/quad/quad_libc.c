@@ -0,0 +1,82 @@
+/*
+ 128-bit and 80-bit float to/from string with the C library:
+ binary128: quadmath_snprintf("%.36Qg") and strtoflt128() (GCC libquadmath).
+ x87 extended: snprintf("%.21Lg") and strtold().
+
+ The output always has 36 (or 21) significant digits, which read back as the
+ same value, but it's not the shortest.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <float.h>
+#include "quad.h"
+
+#if QUAD_HAS_QUADMATH
+#   include <quadmath.h>
+#endif
+
+#if LDBL_MANT_DIG == 64 && (defined(__x86_64__) || defined(__i386__))
+#   define QUAD_NATIVE_F80 1
+#endif
+
+char *f128_to_str_libc(quad_raw val, char *buf) {
+#if QUAD_HAS_QUADMATH
+    __float128 num;
+    memcpy(&num, &val, 16);
+    return buf + quadmath_snprintf(buf, 64, "%.36Qg", num);
+#else
+    (void)val;
+    *buf = '\0';
+    return buf;
+#endif
+}
+
+quad_raw str_to_f128_libc(const char *str, size_t len, char **endptr) {
+    quad_raw raw = { 0, 0 };
+    (void)len;
+#if QUAD_HAS_QUADMATH
+    __float128 num = strtoflt128(str, endptr);
+    memcpy(&raw, &num, 16);
+#else
+    *endptr = (char *)str;
+#endif
+    return raw;
+}
+
+char *f80_to_str_libc(quad_raw val, char *buf) {
+#if QUAD_NATIVE_F80
+    long double num = 0;
+    memcpy(&num, &val, 10);
+    return buf + snprintf(buf, 64, "%.21Lg", num);
+#else
+    (void)val;
+    *buf = '\0';
+    return buf;
+#endif
+}
+
+quad_raw str_to_f80_libc(const char *str, size_t len, char **endptr) {
+    quad_raw raw = { 0, 0 };
+    (void)len;
+#if QUAD_NATIVE_F80
+    long double num = strtold(str, endptr);
+    memcpy(&raw, &num, 10);
+#else
+    *endptr = (char *)str;
+#endif
+    return raw;
+}
+
+/* benckmark config */
+#if QUAD_HAS_QUADMATH
+int quad_libc_available_f128 = 1;
+#else
+int quad_libc_available_f128 = 0;
+#endif
+#if QUAD_NATIVE_F80
+int quad_libc_available_f80 = 1;
+#else
+int quad_libc_available_f80 = 0;
+#endif
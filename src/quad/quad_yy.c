@@ -0,0 +1,1130 @@
+/*
+ 128-bit (binary128) and 80-bit (x87 extended) float to/from string by ibireme.
+
+ Both types have a 15-bit exponent, the numbers are in range 1e-4966 to
+ 1e4932, so the exact computation needs big integers up to about 40000 bits.
+
+ Both directions use a table of 192-bit powers of 10 (1e-5010 to 1e5010, about
+ 240KB, built by `quad_yy_init()` at first use). The truncated product gives an
+ interval around the exact value, and the result is returned only if the whole
+ interval decides it; the few ambiguous cases fall back to exact big integers.
+
+ Format: the value and its halfway bounds are scaled to 37 (or 22) digits,
+ the digits are removed while the bounds still contain one candidate, then the
+ closest candidate is taken. The fallback is Burger & Dybvig's free-format
+ algorithm. Integers below 2^113 (or 2^64) are written directly. The output is
+ in the same format as `dtoa_yy`.
+
+ Parse: Clinger's fast path with the native type is tried first if both the
+ significand and the power of 10 are exact, then the table for input up to 38
+ digits, then the top 128 bits and a sticky bit of the exact value are
+ computed with big integers.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <float.h>
+#include <math.h>
+#include "quad.h"
+
+#if defined(__SIZEOF_INT128__)
+
+typedef unsigned __int128 u128;
+
+/* x87 extended is the native long double (GCC/Clang on x86). */
+#if LDBL_MANT_DIG == 64 && (defined(__x86_64__) || defined(__i386__))
+#   define QUAD_NATIVE_F80 1
+#endif
+
+/* binary128 is supported as __float128 (GCC/Clang on x86_64, aarch64...). */
+#if defined(__SIZEOF_FLOAT128__) && !defined(__clang__)
+#   define QUAD_NATIVE_F128 1
+#endif
+
+/* Both types: exponent bias 16383, max exponent field 0x7FFF. */
+#define QUAD_EXP_BIAS 16383
+#define QUAD_EXP_MAX 0x7FFF
+
+/* The max significant digits of input, the others are replaced with a sticky
+   digit. The exact decimal of all halfway points between two values fits in
+   this length (about 11500 digits for the smallest one). */
+#define QUAD_DIGITS_MAX 12000
+
+/* 32-bit limbs of a big integer: 1e12000 * 2^128 / 5^(-4966-12000) */
+#define BIG_LIMBS 1320
+
+typedef struct {
+    int prec;    /* significant bits: 113 or 64 */
+    bool is_f80; /* x87 extended (explicit integer bit) */
+} quad_type;
+
+static const quad_type type_f128 = { 113, false };
+static const quad_type type_f80 = { 64, true };
+
+
+
+/*==============================================================================
+ * Big Integer
+ *============================================================================*/
+
+typedef struct {
+    uint32_t len;               /* limb count, no leading zero limb */
+    uint32_t limbs[BIG_LIMBS];  /* little-endian */
+} bigint;
+
+static const uint32_t pow10_u32[10] = {
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+};
+
+static const uint32_t pow5_u32[14] = {
+    1, 5, 25, 125, 625, 3125, 15625, 78125, 390625, 1953125, 9765625,
+    48828125, 244140625, 1220703125
+};
+
+static const uint64_t pow10_u64[20] = {
+    1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL,
+    10000000ULL, 100000000ULL, 1000000000ULL, 10000000000ULL,
+    100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+    100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,
+    100000000000000000ULL, 1000000000000000000ULL,
+    10000000000000000000ULL
+};
+
+static inline int u32_clz(uint32_t v) {
+    return __builtin_clz(v);
+}
+
+static inline int u128_bit_len(u128 v) {
+    uint64_t hi = (uint64_t)(v >> 64);
+    if (hi) return 128 - __builtin_clzll(hi);
+    return (uint64_t)v ? 64 - __builtin_clzll((uint64_t)v) : 0;
+}
+
+static void big_set_u128(bigint *big, u128 val) {
+    big->len = 0;
+    while (val) {
+        big->limbs[big->len++] = (uint32_t)val;
+        val >>= 32;
+    }
+}
+
+static uint32_t big_bit_len(const bigint *big) {
+    if (!big->len) return 0;
+    return big->len * 32 - (uint32_t)u32_clz(big->limbs[big->len - 1]);
+}
+
+/** big = big * mul + add */
+static void big_mul_add_u32(bigint *big, uint32_t mul, uint32_t add) {
+    uint64_t carry = add;
+    uint32_t i;
+    for (i = 0; i < big->len; i++) {
+        carry += (uint64_t)big->limbs[i] * mul;
+        big->limbs[i] = (uint32_t)carry;
+        carry >>= 32;
+    }
+    if (carry && big->len < BIG_LIMBS) big->limbs[big->len++] = (uint32_t)carry;
+}
+
+static void big_mul_pow5(bigint *big, uint32_t exp) {
+    while (exp >= 13) {
+        big_mul_add_u32(big, pow5_u32[13], 0);
+        exp -= 13;
+    }
+    if (exp) big_mul_add_u32(big, pow5_u32[exp], 0);
+}
+
+static void big_shl(bigint *big, uint32_t bits) {
+    uint32_t word = bits / 32, shift = bits % 32, len = big->len, i;
+    if (!len) return;
+    if (shift == 0) {
+        memmove(big->limbs + word, big->limbs, len * sizeof(uint32_t));
+    } else {
+        uint32_t top = big->limbs[len - 1] >> (32 - shift);
+        for (i = len - 1; i > 0; i--) {
+            big->limbs[i + word] = (big->limbs[i] << shift) |
+                                   (big->limbs[i - 1] >> (32 - shift));
+        }
+        big->limbs[word] = big->limbs[0] << shift;
+        if (top) big->limbs[len++ + word] = top;
+    }
+    memset(big->limbs, 0, word * sizeof(uint32_t));
+    big->len = len + word;
+}
+
+static int big_cmp(const bigint *a, const bigint *b) {
+    uint32_t i;
+    if (a->len != b->len) return a->len > b->len ? 1 : -1;
+    for (i = a->len; i-- > 0;) {
+        if (a->limbs[i] != b->limbs[i]) return a->limbs[i] > b->limbs[i] ? 1 : -1;
+    }
+    return 0;
+}
+
+/** a = a - b (a >= b) */
+static void big_sub(bigint *a, const bigint *b) {
+    uint64_t borrow = 0;
+    uint32_t i;
+    for (i = 0; i < a->len; i++) {
+        uint64_t sub = (uint64_t)(i < b->len ? b->limbs[i] : 0) + borrow;
+        borrow = a->limbs[i] < sub;
+        a->limbs[i] = (uint32_t)((uint64_t)a->limbs[i] - sub);
+    }
+    while (a->len && !a->limbs[a->len - 1]) a->len--;
+}
+
+/** dst = a + b */
+static void big_add(bigint *dst, const bigint *a, const bigint *b) {
+    const bigint *lo = a->len < b->len ? a : b;
+    const bigint *hi = a->len < b->len ? b : a;
+    uint64_t carry = 0;
+    uint32_t i;
+    for (i = 0; i < hi->len; i++) {
+        carry += (uint64_t)hi->limbs[i] + (i < lo->len ? lo->limbs[i] : 0);
+        dst->limbs[i] = (uint32_t)carry;
+        carry >>= 32;
+    }
+    dst->len = hi->len;
+    if (carry) dst->limbs[dst->len++] = (uint32_t)carry;
+}
+
+/** Returns 128 bits from the bit `pos`, `sticky` is set if any lower bit is 1. */
+static u128 big_get_bits(const bigint *big, uint32_t pos, bool *sticky) {
+    uint32_t word = pos / 32, shift = pos % 32, i;
+    u128 val = 0;
+    bool low = false;
+    for (i = 0; i < word && i < big->len && !low; i++) low = big->limbs[i] != 0;
+    if (shift && word < big->len) low |= (big->limbs[word] & ((1u << shift) - 1)) != 0;
+    for (i = 5; i-- > 0;) {
+        uint32_t limb = word + i < big->len ? big->limbs[word + i] : 0;
+        if (i == 4) {
+            val = shift ? (u128)limb << (128 - shift) : 0;
+        } else {
+            val |= ((u128)limb << (32 * i)) >> shift;
+        }
+    }
+    *sticky = low;
+    return val;
+}
+
+/**
+ Divide `u` by `v` (Knuth's Algorithm D), `u` is set to the remainder (shifted
+ left, only for zero check), `v` is changed (shifted).
+ */
+static void big_divmod(bigint *u, bigint *v, bigint *quo) {
+    uint32_t n = v->len, shift = (uint32_t)u32_clz(v->limbs[n - 1]), i;
+    uint32_t vtop, vsec;
+    int32_t j, m;
+
+    big_shl(v, shift);
+    big_shl(u, shift);
+    quo->len = 0;
+    if (u->len < n) return;
+    m = (int32_t)(u->len - n);
+    quo->len = (uint32_t)m + 1;
+    u->limbs[u->len] = 0;
+    vtop = v->limbs[n - 1];
+    vsec = n >= 2 ? v->limbs[n - 2] : 0;
+
+    for (j = m; j >= 0; j--) {
+        uint64_t num = ((uint64_t)u->limbs[j + n] << 32) | u->limbs[j + n - 1];
+        uint64_t qhat = num / vtop, rhat = num % vtop;
+        int64_t borrow = 0, t;
+        uint32_t usec = n >= 2 ? u->limbs[j + n - 2] : 0;
+        while (qhat >> 32 || qhat * vsec > ((rhat << 32) | usec)) {
+            qhat--;
+            rhat += vtop;
+            if (rhat >> 32) break;
+        }
+
+        /* u -= qhat * v */
+        for (i = 0; i < n; i++) {
+            uint64_t p = qhat * v->limbs[i];
+            t = (int64_t)u->limbs[i + j] - borrow - (int64_t)(p & 0xFFFFFFFF);
+            u->limbs[i + j] = (uint32_t)t;
+            borrow = (int64_t)(p >> 32) - (t >> 32);
+        }
+        t = (int64_t)u->limbs[j + n] - borrow;
+        u->limbs[j + n] = (uint32_t)t;
+
+        /* qhat is 1 too large (rare): add back */
+        if (t < 0) {
+            uint64_t carry = 0;
+            qhat--;
+            for (i = 0; i < n; i++) {
+                carry += (uint64_t)u->limbs[i + j] + v->limbs[i];
+                u->limbs[i + j] = (uint32_t)carry;
+                carry >>= 32;
+            }
+            u->limbs[j + n] += (uint32_t)carry;
+        }
+        quo->limbs[j] = (uint32_t)qhat;
+    }
+
+    u->len = n;
+    while (u->len && !u->limbs[u->len - 1]) u->len--;
+    while (quo->len && !quo->limbs[quo->len - 1]) quo->len--;
+}
+
+
+
+/*==============================================================================
+ * Raw Bits
+ *============================================================================*/
+
+typedef enum {
+    num_zero,
+    num_finite,
+    num_inf,
+    num_nan
+} num_class;
+
+/** Decode the value as `sig * 2^exp`, `closer` is set if the lower neighbor
+    is closer than the upper one (the significand is a power of 2). */
+static num_class quad_decode(quad_raw raw, quad_type type, bool *neg,
+                             u128 *sig, int32_t *exp, bool *closer) {
+    uint32_t field;
+    u128 frac;
+    if (!type.is_f80) {
+        *neg = raw.hi >> 63;
+        field = (uint32_t)(raw.hi >> 48) & QUAD_EXP_MAX;
+        frac = ((u128)(raw.hi & 0xFFFFFFFFFFFFULL) << 64) | raw.lo;
+        if (field == QUAD_EXP_MAX) return frac ? num_nan : num_inf;
+        if (field == 0 && frac == 0) return num_zero;
+        *sig = field ? frac | ((u128)1 << 112) : frac;
+        *closer = (frac == 0 && field > 1);
+    } else {
+        *neg = (raw.hi >> 15) & 1;
+        field = (uint32_t)raw.hi & QUAD_EXP_MAX;
+        frac = raw.lo;
+        if (field == QUAD_EXP_MAX) {
+            return (raw.lo == 0x8000000000000000ULL) ? num_inf : num_nan;
+        }
+        if (field == 0 && frac == 0) return num_zero;
+        if (field && !(raw.lo >> 63)) return num_nan; /* unnormal: invalid */
+        *sig = frac;
+        *closer = (raw.lo == 0x8000000000000000ULL && field > 1);
+    }
+    *exp = (int32_t)(field ? field : 1) - QUAD_EXP_BIAS - (type.prec - 1);
+    return num_finite;
+}
+
+static quad_raw quad_encode(bool neg, uint32_t field, u128 sig, quad_type type) {
+    quad_raw raw;
+    if (!type.is_f80) {
+        raw.lo = (uint64_t)sig;
+        raw.hi = ((uint64_t)neg << 63) | ((uint64_t)field << 48) |
+                 ((uint64_t)(sig >> 64) & 0xFFFFFFFFFFFFULL);
+    } else {
+        raw.lo = (uint64_t)sig;
+        raw.hi = ((uint64_t)neg << 15) | field;
+    }
+    return raw;
+}
+
+static quad_raw quad_inf(bool neg, quad_type type) {
+    return quad_encode(neg, QUAD_EXP_MAX, type.is_f80 ? (u128)1 << 63 : 0, type);
+}
+
+static quad_raw quad_nan(quad_type type) {
+    return quad_encode(false, QUAD_EXP_MAX,
+                       type.is_f80 ? (u128)3 << 62 : (u128)1 << 111, type);
+}
+
+/** Encode the rounded value `rnd * 2^ulp`, `rnd` may be 2^prec (carry). */
+static quad_raw quad_encode_rounded(bool neg, u128 rnd, int32_t ulp, quad_type type) {
+    int32_t prec = type.prec;
+    uint32_t field;
+    if (rnd == (u128)1 << prec) {
+        rnd >>= 1;
+        ulp++;
+    }
+    if (!(rnd >> (prec - 1))) return quad_encode(neg, 0, rnd, type); /* subnormal */
+    field = (uint32_t)(ulp + (prec - 1) + QUAD_EXP_BIAS);
+    if (field >= QUAD_EXP_MAX) return quad_inf(neg, type);
+    return quad_encode(neg, field, rnd, type);
+}
+
+/**
+ Round `(sig + sticky) * 2^exp` to the type (to nearest, ties to even), the
+ `sticky` means there are more nonzero bits below the `sig`.
+ */
+static quad_raw quad_round(bool neg, u128 sig, int32_t exp, bool sticky, quad_type type) {
+    int32_t prec = type.prec;
+    int32_t ulp_min = 1 - QUAD_EXP_BIAS - (prec - 1); /* ulp of subnormal */
+    int32_t len = u128_bit_len(sig);
+    int32_t ulp = exp + len - prec > ulp_min ? exp + len - prec : ulp_min;
+    int32_t shift = ulp - exp;
+    u128 rnd, rem, half;
+
+    if (shift <= 0) { /* exact */
+        rnd = sig << -shift;
+    } else if (shift > 128) { /* less than half of the min subnormal */
+        rnd = 0;
+    } else {
+        rnd = shift == 128 ? 0 : sig >> shift;
+        rem = shift == 128 ? sig : sig & (((u128)1 << shift) - 1);
+        half = (u128)1 << (shift - 1);
+        rnd += (rem > half || (rem == half && (sticky || (rnd & 1))));
+    }
+    return quad_encode_rounded(neg, rnd, ulp, type);
+}
+
+
+
+/*==============================================================================
+ * Power of 10 Table
+ *============================================================================*/
+
+/* The range of the table: the output uses 10^-5002 to 10^4896 (the value is
+   scaled to 37 or 38 digits), the input uses 10^-5004 to 10^4933. */
+#define POW10_MIN -5010
+#define POW10_MAX 5010
+#define POW10_NUM (POW10_MAX - POW10_MIN + 1)
+
+/* 10^q ~ sig * 2^exp, the sig is the top 192 bits (truncated, in 3 words from
+   low to high), the relative error is less than 2^-191. The table (240 KB) is
+   built on the first call, call quad_yy_init() before using it in threads. */
+static uint64_t pow10_sig_tab[POW10_NUM][3];
+static int16_t pow10_exp_tab[POW10_NUM];
+static volatile int pow10_tab_ready = 0;
+
+/** Returns 64 bits from the bit `pos` (may be negative). */
+static uint64_t big_get_u64(const bigint *big, int32_t pos) {
+    int32_t k0 = pos >= 0 ? pos / 32 : -((-pos + 31) / 32), k;
+    uint64_t val = 0;
+    for (k = k0; k <= k0 + 2; k++) {
+        int32_t off = 32 * k - pos;
+        uint64_t limb;
+        if (k < 0 || k >= (int32_t)big->len || off >= 64) continue;
+        limb = big->limbs[k];
+        val |= off >= 0 ? limb << off : limb >> -off;
+    }
+    return val;
+}
+
+void quad_yy_init(void) {
+    bigint pow, num, div, quo;
+    int32_t q, i;
+    if (pow10_tab_ready) return;
+
+    big_set_u128(&pow, 1);
+    for (q = 0; q <= POW10_MAX; q++) {
+        int32_t len;
+        if (q) big_mul_add_u32(&pow, 10, 0);
+        len = (int32_t)big_bit_len(&pow);
+        for (i = 0; i < 3; i++) {
+            pow10_sig_tab[q - POW10_MIN][i] = big_get_u64(&pow, len - 192 + 64 * i);
+        }
+        pow10_exp_tab[q - POW10_MIN] = (int16_t)(len - 192);
+
+        /* 10^-q = 2^(len + 191) / 10^q, the quotient is 192 bits */
+        if (q && -q >= POW10_MIN) {
+            big_set_u128(&num, 1);
+            big_shl(&num, (uint32_t)(len + 191));
+            div.len = pow.len;
+            memcpy(div.limbs, pow.limbs, pow.len * sizeof(uint32_t));
+            big_divmod(&num, &div, &quo);
+            for (i = 0; i < 3; i++) {
+                pow10_sig_tab[-q - POW10_MIN][i] = big_get_u64(&quo, 64 * i);
+            }
+            pow10_exp_tab[-q - POW10_MIN] = (int16_t)-(len + 191);
+        }
+    }
+    pow10_tab_ready = 1;
+}
+
+/** The 320-bit product of a 128-bit and a 192-bit integer (words from low to
+    high). */
+static void mul_u128_u192(u128 a, const uint64_t *b, uint64_t *out) {
+    uint64_t av[2] = { (uint64_t)a, (uint64_t)(a >> 64) };
+    int i, j;
+    memset(out, 0, 5 * sizeof(uint64_t));
+    for (i = 0; i < 2; i++) {
+        uint64_t carry = 0;
+        for (j = 0; j < 3; j++) {
+            u128 p = (u128)av[i] * b[j] + out[i + j] + carry;
+            out[i + j] = (uint64_t)p;
+            carry = (uint64_t)(p >> 64);
+        }
+        out[i + 3] = carry;
+    }
+}
+
+/** Returns 64 bits of the 320-bit product from the bit `pos`. */
+static uint64_t words_get_u64(const uint64_t *words, int32_t pos) {
+    int32_t k = pos >= 0 ? pos / 64 : -((-pos + 63) / 64);
+    int32_t off = pos - k * 64;
+    uint64_t lo = (k >= 0 && k < 5) ? words[k] : 0;
+    uint64_t hi = (k + 1 >= 0 && k + 1 < 5) ? words[k + 1] : 0;
+    return off ? (lo >> off) | (hi << (64 - off)) : lo;
+}
+
+
+
+/*==============================================================================
+ * Format
+ *============================================================================*/
+
+/**
+ Generate the shortest digits (0-9) of `sig * 2^exp` which read back as the
+ same value, the closest one if there are several. Returns the digit count,
+ the value is `0.d1d2d3... * 10^dp`.
+ */
+static int quad_shortest_digits(u128 sig, int32_t exp, bool closer,
+                                uint8_t *digits, int32_t *dp) {
+    bigint r, s, mp, mm, tmp;
+    bool even = !(sig & 1); /* the boundaries read back as this value */
+    int32_t k;
+    int n = 0, c;
+
+    /* v = r / s, the boundaries are v - mm / s and v + mp / s */
+    big_set_u128(&r, sig);
+    big_set_u128(&mp, 1);
+    if (exp >= 0) {
+        big_shl(&r, (uint32_t)exp + 1 + closer);
+        big_set_u128(&s, (u128)2 << closer);
+        big_shl(&mp, (uint32_t)exp + closer);
+    } else {
+        big_shl(&r, 1 + closer);
+        big_set_u128(&s, 1);
+        big_shl(&s, (uint32_t)(1 - exp) + closer);
+        big_shl(&mp, closer);
+    }
+    big_set_u128(&mm, 1);
+    if (exp >= 0) big_shl(&mm, (uint32_t)exp);
+
+    /* k = ceil(log10(v)), may be 1 less than the exact one */
+    k = (int32_t)ceil((double)(u128_bit_len(sig) - 1 + exp) * 0.30102999566398114 - 1e-9);
+    if (k >= 0) {
+        big_mul_pow5(&s, (uint32_t)k);
+        big_shl(&s, (uint32_t)k);
+    } else {
+        big_mul_pow5(&r, (uint32_t)-k);
+        big_shl(&r, (uint32_t)-k);
+        big_mul_pow5(&mp, (uint32_t)-k);
+        big_shl(&mp, (uint32_t)-k);
+        big_mul_pow5(&mm, (uint32_t)-k);
+        big_shl(&mm, (uint32_t)-k);
+    }
+    for (;;) { /* the upper boundary should be less than 10^k */
+        big_add(&tmp, &r, &mp);
+        c = big_cmp(&tmp, &s);
+        if (c < 0 || (c == 0 && !even)) break;
+        k++;
+        big_mul_add_u32(&s, 10, 0);
+    }
+
+    for (;;) {
+        uint8_t d = 0;
+        bool low, high;
+        big_mul_add_u32(&r, 10, 0);
+        big_mul_add_u32(&mp, 10, 0);
+        big_mul_add_u32(&mm, 10, 0);
+        while (big_cmp(&r, &s) >= 0) {
+            big_sub(&r, &s);
+            d++;
+        }
+        c = big_cmp(&r, &mm);
+        low = c < 0 || (c == 0 && even);
+        big_add(&tmp, &r, &mp);
+        c = big_cmp(&tmp, &s);
+        high = c > 0 || (c == 0 && even);
+        if (!low && !high) {
+            digits[n++] = d;
+            continue;
+        }
+        if (low && high) { /* both read back, choose the closer one */
+            big_add(&tmp, &r, &r);
+            c = big_cmp(&tmp, &s);
+            d += (c > 0 || (c == 0 && (d & 1)));
+        } else {
+            d += high;
+        }
+        digits[n++] = d;
+        break;
+    }
+
+    /* carry (should not happen with the initial check) */
+    while (n > 1 && digits[n - 1] == 10) {
+        digits[--n] = 0;
+        digits[n - 1]++;
+    }
+    if (digits[0] == 10) {
+        digits[0] = 1;
+        k++;
+    }
+    while (n > 1 && digits[n - 1] == 0) n--;
+    *dp = k;
+    return n;
+}
+
+/** Digits of an integer (not 0), returns the digit count. */
+static int u128_to_digits(u128 val, uint8_t *digits) {
+    uint8_t tmp[40];
+    int n = 0, i;
+    while (val >> 64) {
+        uint64_t lo = (uint64_t)(val % 10000000000000000000ULL);
+        val /= 10000000000000000000ULL;
+        for (i = 0; i < 19; i++) {
+            tmp[n++] = (uint8_t)(lo % 10);
+            lo /= 10;
+        }
+    }
+    for (uint64_t v = (uint64_t)val; v; v /= 10) tmp[n++] = (uint8_t)(v % 10);
+    for (i = 0; i < n; i++) digits[i] = tmp[n - 1 - i];
+    return n;
+}
+
+/** Returns true if `x * 2^exp * 10^q` is an integer (x is not 0). */
+static bool quad_scaled_is_int(u128 x, int32_t exp, int32_t q) {
+    int32_t tz = (uint64_t)x ? __builtin_ctzll((uint64_t)x) :
+                 64 + __builtin_ctzll((uint64_t)(x >> 64));
+    u128 pow5 = 1;
+    if (exp + q + tz < 0) return false;
+    if (q >= 0) return true;
+    if (q < -49) return false; /* 5^50 > 2^116 */
+    for (; q < 0; q++) pow5 *= 5;
+    return (x >> tz) % pow5 == 0;
+}
+
+/**
+ Compute the integer part of `x * 2^exp * 10^q` with the table. Returns false
+ if the result may be wrong (the error of the table is less than 2^-64 of the
+ integer part, it only matters if the value is very close to an integer).
+ */
+static bool quad_scale(u128 x, int32_t exp, int32_t q, u128 *ip, bool *is_int) {
+    uint64_t prod[5], frac;
+    int32_t shift = -(exp + pow10_exp_tab[q - POW10_MIN]);
+    mul_u128_u192(x, pow10_sig_tab[q - POW10_MIN], prod);
+    frac = words_get_u64(prod, shift - 64);
+    *ip = (u128)words_get_u64(prod, shift) | ((u128)words_get_u64(prod, shift + 64) << 64);
+    *is_int = quad_scaled_is_int(x, exp, q);
+    if (*is_int) {
+        *ip += (frac != 0); /* the product is less than or equal to the exact one */
+        return true;
+    }
+    return frac < UINT64_MAX - 1;
+}
+
+/**
+ Generate the shortest digits with the power of 10 table: the value and the
+ boundaries are scaled to 37 or 38 digits (22 or 23 for x87 extended), the
+ trailing digits are removed while an integer stays between the boundaries.
+ Returns false if the result may be wrong, the same as quad_shortest_digits().
+ */
+static bool quad_shortest_digits_fast(u128 sig, int32_t exp, bool closer, int digits_max,
+                                      uint8_t *digits, int *count, int32_t *dp) {
+    bool even = !(sig & 1); /* the boundaries read back as this value */
+    int32_t k = (int32_t)floor((double)(u128_bit_len(sig) - 1 + exp) *
+                               0.30102999566398114) - digits_max;
+    int32_t j = 0, n, step;
+    u128 xv = sig << 2, vi, li, ui, lo = 0, hi = 0, pow = 1, d, r;
+    bool v_int, l_int, u_int;
+
+    /* v = xv * 2^(exp-2), the boundaries are (xv - 2) and (xv + 2), or
+       (xv - 1) if the lower one is closer */
+    if (-k < POW10_MIN || -k > POW10_MAX) return false;
+    if (!quad_scale(xv, exp - 2, -k, &vi, &v_int) ||
+        !quad_scale(xv - 2 + closer, exp - 2, -k, &li, &l_int) ||
+        !quad_scale(xv + 2, exp - 2, -k, &ui, &u_int)) return false;
+
+    /* [lo, hi]: the integers between the boundaries after removing j digits,
+       the digits are removed in steps of 16, 8, 4, 2, 1 (if [lo, hi] is empty
+       after removing j digits, it's also empty after removing more) */
+    for (step = 16; step; step /= 2) {
+        while (j + step <= 38) {
+            u128 p = pow * pow10_u64[step], l = li / p, h = ui / p;
+            if (!l_int || li != l * p || !even) l++; /* ceil, or the next one */
+            if (u_int && ui == h * p && !even) h--;
+            if (l > h) break;
+            lo = l;
+            hi = h;
+            pow = p;
+            j += step;
+        }
+    }
+    if (j == 0) return false;
+
+    /* the closest one to the value */
+    d = vi / pow;
+    r = vi - d * pow;
+    d += (r > pow / 2 || (r == pow / 2 && (!v_int || (d & 1))));
+    if (d < lo) d = lo;
+    if (d > hi) d = hi;
+
+    n = u128_to_digits(d, digits);
+    *dp = n + j + k;
+    while (digits[n - 1] == 0) n--;
+    *count = n;
+    return true;
+}
+
+/** Write `0.d1d2d3... * 10^dp` in the format of `dtoa_yy`. */
+static char *quad_write_digits(bool neg, const uint8_t *digits, int n, int32_t dp, char *buf) {
+    int32_t x = dp - 1; /* the exponent of the first digit */
+    int i;
+    *buf = '-';
+    buf += neg;
+    if (x < -6 || x >= 21) { /* scientific: 1.5e-7 */
+        uint32_t abs = (uint32_t)(x < 0 ? -x : x);
+        char tmp[8];
+        int len = 0;
+        *buf++ = (char)('0' + digits[0]);
+        if (n > 1) {
+            *buf++ = '.';
+            for (i = 1; i < n; i++) *buf++ = (char)('0' + digits[i]);
+        }
+        *buf++ = 'e';
+        *buf = '-';
+        buf += x < 0;
+        do {
+            tmp[len++] = (char)('0' + abs % 10);
+            abs /= 10;
+        } while (abs);
+        while (len) *buf++ = tmp[--len];
+    } else if (x < 0) { /* 0.00015 */
+        *buf++ = '0';
+        *buf++ = '.';
+        for (i = -1; i > x; i--) *buf++ = '0';
+        for (i = 0; i < n; i++) *buf++ = (char)('0' + digits[i]);
+    } else if (n <= x + 1) { /* 1500.0 */
+        for (i = 0; i < n; i++) *buf++ = (char)('0' + digits[i]);
+        for (i = n; i <= x; i++) *buf++ = '0';
+        *buf++ = '.';
+        *buf++ = '0';
+    } else { /* 15.25 */
+        for (i = 0; i < n; i++) {
+            *buf++ = (char)('0' + digits[i]);
+            if (i == x) *buf++ = '.';
+        }
+    }
+    *buf = '\0';
+    return buf;
+}
+
+static char *quad_to_str(quad_raw raw, quad_type type, int digits_max, char *buf) {
+    uint8_t digits[48];
+    bool neg, closer;
+    u128 sig;
+    int32_t exp, dp;
+    int n;
+
+    switch (quad_decode(raw, type, &neg, &sig, &exp, &closer)) {
+        case num_nan:
+            memcpy(buf, "NaN", 4);
+            return buf + 3;
+        case num_inf:
+            *buf = '-';
+            buf += neg;
+            memcpy(buf, "Infinity", 9);
+            return buf + 8;
+        case num_zero:
+            *buf = '-';
+            buf += neg;
+            memcpy(buf, "0.0", 4);
+            return buf + 3;
+        default:
+            break;
+    }
+
+    if (exp <= 0 && exp > -type.prec && !(sig & (((u128)1 << -exp) - 1))) {
+        /* integer below 2^prec: all digits are significant */
+        n = u128_to_digits(sig >> -exp, digits);
+        dp = n;
+        while (digits[n - 1] == 0) n--;
+    } else {
+        if (!pow10_tab_ready) quad_yy_init();
+        if (!quad_shortest_digits_fast(sig, exp, closer, digits_max, digits, &n, &dp)) {
+            n = quad_shortest_digits(sig, exp, closer, digits, &dp);
+        }
+    }
+    return quad_write_digits(neg, digits, n, dp, buf);
+}
+
+
+
+/*==============================================================================
+ * Parse
+ *============================================================================*/
+
+static inline bool char_is_digit(char c) {
+    return (uint8_t)(c - '0') <= 9;
+}
+
+static inline char char_lower(char c) {
+    return (char)(c | 0x20);
+}
+
+/** The decimal number read from string: `sig * 10^exp`. */
+typedef struct {
+    bool neg;
+    num_class cls;
+    const char *sig_hdr;  /* the first nonzero digit */
+    const char *sig_end;  /* after the last nonzero digit */
+    int32_t count;        /* significant digit count */
+    int32_t exp;          /* the exponent of the last digit */
+    int32_t exp_first;    /* the exponent of the first digit */
+} quad_decimal;
+
+/** Read a number in JSON grammar (or Inf, Infinity, NaN), returns false if
+    failed. */
+static bool quad_read_decimal(const char *str, char **endptr, quad_decimal *dec) {
+    const char *cur = str, *int_hdr, *int_end, *frac_hdr = NULL, *frac_end = NULL;
+    const char *hdr = NULL, *last = NULL;
+    int64_t exp_lit = 0, pos_last = 0, pos_first = 0;
+    bool exp_neg = false;
+
+    dec->neg = (*cur == '-');
+    cur += dec->neg;
+
+    if (!char_is_digit(*cur)) {
+        if (char_lower(cur[0]) == 'i' && char_lower(cur[1]) == 'n' &&
+            char_lower(cur[2]) == 'f') {
+            cur += 3;
+            if (char_lower(cur[0]) == 'i' && char_lower(cur[1]) == 'n' &&
+                char_lower(cur[2]) == 'i' && char_lower(cur[3]) == 't' &&
+                char_lower(cur[4]) == 'y') cur += 5;
+            dec->cls = num_inf;
+        } else if (char_lower(cur[0]) == 'n' && char_lower(cur[1]) == 'a' &&
+                   char_lower(cur[2]) == 'n') {
+            cur += 3;
+            dec->cls = num_nan;
+        } else {
+            return false;
+        }
+        *endptr = (char *)cur;
+        return true;
+    }
+
+    /* integer part: no leading zero */
+    int_hdr = cur;
+    if (*cur == '0') {
+        cur++;
+        if (char_is_digit(*cur)) return false;
+    } else {
+        while (char_is_digit(*cur)) cur++;
+    }
+    int_end = cur;
+
+    /* fraction part */
+    if (*cur == '.') {
+        frac_hdr = ++cur;
+        if (!char_is_digit(*cur)) return false;
+        while (char_is_digit(*cur)) cur++;
+        frac_end = cur;
+    }
+
+    /* exponent part */
+    if (*cur == 'e' || *cur == 'E') {
+        cur++;
+        exp_neg = (*cur == '-');
+        cur += (*cur == '-' || *cur == '+');
+        if (!char_is_digit(*cur)) return false;
+        for (; char_is_digit(*cur); cur++) {
+            if (exp_lit < 100000000) exp_lit = exp_lit * 10 + (*cur - '0');
+        }
+        if (exp_neg) exp_lit = -exp_lit;
+    }
+    *endptr = (char *)cur;
+
+    /* the first and the last nonzero digits */
+    for (cur = int_hdr; cur < int_end; cur++) {
+        if (*cur != '0') {
+            if (!hdr) {
+                hdr = cur;
+                pos_first = int_end - cur - 1;
+            }
+            last = cur;
+            pos_last = int_end - cur - 1;
+        }
+    }
+    for (cur = frac_hdr; frac_hdr && cur < frac_end; cur++) {
+        if (*cur != '0') {
+            if (!hdr) {
+                hdr = cur;
+                pos_first = frac_hdr - cur - 1;
+            }
+            last = cur;
+            pos_last = frac_hdr - cur - 1;
+        }
+    }
+    if (!hdr) {
+        dec->cls = num_zero;
+        return true;
+    }
+
+    dec->cls = num_finite;
+    dec->sig_hdr = hdr;
+    dec->sig_end = last + 1;
+    dec->count = (int32_t)(pos_first - pos_last + 1);
+    dec->exp = (int32_t)(exp_lit + pos_last);
+    dec->exp_first = (int32_t)(exp_lit + pos_first);
+    return true;
+}
+
+/** Read the significant digits into big integer, returns the exponent. */
+static int32_t quad_decimal_to_big(const quad_decimal *dec, bigint *big) {
+    const char *cur = dec->sig_hdr;
+    int32_t count = 0, exp = dec->exp;
+    uint32_t chunk = 0, chunk_len = 0;
+
+    big->len = 0;
+    for (; cur < dec->sig_end && count < QUAD_DIGITS_MAX; cur++) {
+        if (*cur == '.') continue;
+        chunk = chunk * 10 + (uint32_t)(*cur - '0');
+        count++;
+        if (++chunk_len == 9) {
+            big_mul_add_u32(big, pow10_u32[9], chunk);
+            chunk = chunk_len = 0;
+        }
+    }
+    if (chunk_len) {
+        big_mul_add_u32(big, pow10_u32[chunk_len], chunk);
+    }
+
+    /* too many digits: the dropped digits are not all zero, add a sticky 1 */
+    if (count < dec->count) {
+        exp += dec->count - count - 1;
+        big_mul_add_u32(big, 10, 1);
+    }
+    return exp;
+}
+
+/** Read the significant digits into u64 (at most 19 digits). */
+static uint64_t quad_decimal_to_u64(const quad_decimal *dec) {
+    const char *cur = dec->sig_hdr;
+    uint64_t sig = 0;
+    for (; cur < dec->sig_end; cur++) {
+        if (*cur != '.') sig = sig * 10 + (uint64_t)(*cur - '0');
+    }
+    return sig;
+}
+
+/** Read the significant digits into u128 (at most 38 digits). */
+static u128 quad_decimal_to_u128(const quad_decimal *dec) {
+    const char *cur = dec->sig_hdr;
+    uint64_t part = 0;
+    int len = 0;
+    u128 sig = 0;
+    for (; cur < dec->sig_end; cur++) {
+        if (*cur == '.') continue;
+        part = part * 10 + (uint64_t)(*cur - '0');
+        if (++len == 19) {
+            sig = sig * pow10_u64[19] + part;
+            part = 0;
+            len = 0;
+        }
+    }
+    return sig * pow10_u64[len] + part;
+}
+
+/** Exact conversion with big integers. */
+static quad_raw quad_decimal_to_raw(const quad_decimal *dec, quad_type type) {
+    bigint num, div, quo;
+    int32_t exp, exp2;
+    u128 sig;
+    bool sticky;
+
+    /* out of range */
+    if (dec->exp_first > 4933) return quad_inf(dec->neg, type);
+    if (dec->exp_first < -4967) return quad_encode(dec->neg, 0, 0, type);
+
+    exp = quad_decimal_to_big(dec, &num);
+    if (exp >= 0) {
+        /* sig * 10^exp: the top 128 bits of (sig * 5^exp) */
+        uint32_t len;
+        big_mul_pow5(&num, (uint32_t)exp);
+        len = big_bit_len(&num);
+        if (len > 128) {
+            sig = big_get_bits(&num, len - 128, &sticky);
+            exp2 = exp + (int32_t)(len - 128);
+        } else {
+            sig = big_get_bits(&num, 0, &sticky);
+            exp2 = exp;
+        }
+    } else {
+        /* sig / 10^-exp: (sig * 2^k) / 5^-exp in range [2^126, 2^128) */
+        int32_t k;
+        bool unused;
+        big_set_u128(&div, 1);
+        big_mul_pow5(&div, (uint32_t)-exp);
+        k = (int32_t)big_bit_len(&div) + 127 - (int32_t)big_bit_len(&num);
+        if (k >= 0) big_shl(&num, (uint32_t)k);
+        else big_shl(&div, (uint32_t)-k);
+        big_divmod(&num, &div, &quo);
+        sig = big_get_bits(&quo, 0, &unused);
+        sticky = num.len != 0;
+        exp2 = exp - k;
+    }
+    return quad_round(dec->neg, sig, exp2, sticky, type);
+}
+
+/**
+ Conversion with the power of 10 table (at most 38 digits). Returns false if
+ the result may be wrong: the error of the table is less than 3 units of the
+ 64 bits below the top 128 bits, it only matters if the value is very close
+ to the halfway point of two adjacent values.
+ */
+static bool quad_decimal_to_raw_fast(const quad_decimal *dec, quad_type type, quad_raw *raw) {
+    int32_t prec = type.prec;
+    int32_t ulp_min = 1 - QUAD_EXP_BIAS - (prec - 1);
+    int32_t top, exp, ulp, shift;
+    uint64_t prod[5], low;
+    u128 sig, rem, half;
+
+    if (dec->count > 38 || dec->exp < POW10_MIN || dec->exp > POW10_MAX) return false;
+    if (!pow10_tab_ready) quad_yy_init();
+    mul_u128_u192(quad_decimal_to_u128(dec), pow10_sig_tab[dec->exp - POW10_MIN], prod);
+
+    /* the top 192 bits: (sig + low / 2^64) * 2^exp */
+    for (top = 4; !prod[top]; top--);
+    top = top * 64 + 64 - __builtin_clzll(prod[top]);
+    sig = (u128)words_get_u64(prod, top - 128) | ((u128)words_get_u64(prod, top - 64) << 64);
+    low = words_get_u64(prod, top - 192);
+    exp = pow10_exp_tab[dec->exp - POW10_MIN] + top - 128;
+
+    ulp = exp + 128 - prec > ulp_min ? exp + 128 - prec : ulp_min;
+    shift = ulp - exp;
+    if (shift > 127) return false;
+    rem = sig & (((u128)1 << shift) - 1);
+    half = (u128)1 << (shift - 1);
+    if ((rem == half - 1 && low >= UINT64_MAX - 4) || (rem == half && low == 0)) return false;
+    *raw = quad_encode_rounded(dec->neg, (sig >> shift) + (rem >= half), ulp, type);
+    return true;
+}
+
+static quad_raw quad_special(const quad_decimal *dec, quad_type type) {
+    if (dec->cls == num_nan) return quad_nan(type);
+    if (dec->cls == num_inf) return quad_inf(dec->neg, type);
+    return quad_encode(dec->neg, 0, 0, type); /* zero */
+}
+
+
+
+/*==============================================================================
+ * Fast Path
+ *============================================================================*/
+
+#if QUAD_NATIVE_F128
+/* 1e0 to 1e48, the max power of 10 which is exact in binary128 */
+#define F128_1E22 ((__float128)1e22)
+static const __float128 f128_pow10_tab[49] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12,
+    1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+    F128_1E22 * 1e1, F128_1E22 * 1e2, F128_1E22 * 1e3, F128_1E22 * 1e4,
+    F128_1E22 * 1e5, F128_1E22 * 1e6, F128_1E22 * 1e7, F128_1E22 * 1e8,
+    F128_1E22 * 1e9, F128_1E22 * 1e10, F128_1E22 * 1e11, F128_1E22 * 1e12,
+    F128_1E22 * 1e13, F128_1E22 * 1e14, F128_1E22 * 1e15, F128_1E22 * 1e16,
+    F128_1E22 * 1e17, F128_1E22 * 1e18, F128_1E22 * 1e19, F128_1E22 * 1e20,
+    F128_1E22 * 1e21, F128_1E22 * 1e22, F128_1E22 * F128_1E22 * 1e1,
+    F128_1E22 * F128_1E22 * 1e2, F128_1E22 * F128_1E22 * 1e3,
+    F128_1E22 * F128_1E22 * 1e4
+};
+#endif
+
+#if QUAD_NATIVE_F80
+/* 1e0 to 1e27, the max power of 10 which is exact in x87 extended */
+static const long double f80_pow10_tab[28] = {
+    1e0L, 1e1L, 1e2L, 1e3L, 1e4L, 1e5L, 1e6L, 1e7L, 1e8L, 1e9L, 1e10L,
+    1e11L, 1e12L, 1e13L, 1e14L, 1e15L, 1e16L, 1e17L, 1e18L, 1e19L, 1e20L,
+    1e21L, 1e22L, 1e23L, 1e24L, 1e25L, 1e26L, 1e27L
+};
+#endif
+
+
+
+/*==============================================================================
+ * Functions
+ *============================================================================*/
+
+char *f128_to_str_yy(quad_raw val, char *buf) {
+    return quad_to_str(val, type_f128, QUAD_F128_DIGITS, buf);
+}
+
+char *f80_to_str_yy(quad_raw val, char *buf) {
+    return quad_to_str(val, type_f80, QUAD_F80_DIGITS, buf);
+}
+
+quad_raw str_to_f128_yy(const char *str, size_t len, char **endptr) {
+    quad_decimal dec;
+    quad_raw raw = { 0, 0 };
+    (void)len;
+    if (!quad_read_decimal(str, endptr, &dec)) {
+        *endptr = (char *)str;
+        return raw;
+    }
+    if (dec.cls != num_finite) return quad_special(&dec, type_f128);
+#if QUAD_NATIVE_F128
+    /* the significand (< 2^113) and the power of 10 are exact */
+    if (dec.count <= 34 && dec.exp >= -48 && dec.exp <= 48) {
+        __float128 val = (__float128)quad_decimal_to_u128(&dec);
+        val = dec.exp >= 0 ? val * f128_pow10_tab[dec.exp] : val / f128_pow10_tab[-dec.exp];
+        if (dec.neg) val = -val;
+        memcpy(&raw, &val, 16);
+        return raw;
+    }
+#endif
+    if (quad_decimal_to_raw_fast(&dec, type_f128, &raw)) return raw;
+    return quad_decimal_to_raw(&dec, type_f128);
+}
+
+quad_raw str_to_f80_yy(const char *str, size_t len, char **endptr) {
+    quad_decimal dec;
+    quad_raw raw = { 0, 0 };
+    (void)len;
+    if (!quad_read_decimal(str, endptr, &dec)) {
+        *endptr = (char *)str;
+        return raw;
+    }
+    if (dec.cls != num_finite) return quad_special(&dec, type_f80);
+#if QUAD_NATIVE_F80
+    /* the significand (< 2^64) and the power of 10 are exact */
+    if (dec.count <= 19 && dec.exp >= -27 && dec.exp <= 27) {
+        long double val = (long double)quad_decimal_to_u64(&dec);
+        val = dec.exp >= 0 ? val * f80_pow10_tab[dec.exp] : val / f80_pow10_tab[-dec.exp];
+        if (dec.neg) val = -val;
+        memcpy(&raw, &val, 10);
+        return raw;
+    }
+#endif
+    if (quad_decimal_to_raw_fast(&dec, type_f80, &raw)) return raw;
+    return quad_decimal_to_raw(&dec, type_f80);
+}
+
+#else /* no 128-bit integer */
+
+char *f128_to_str_yy(quad_raw val, char *buf) {
+    (void)val;
+    *buf = '\0';
+    return buf;
+}
+
+char *f80_to_str_yy(quad_raw val, char *buf) {
+    (void)val;
+    *buf = '\0';
+    return buf;
+}
+
+quad_raw str_to_f128_yy(const char *str, size_t len, char **endptr) {
+    quad_raw raw = { 0, 0 };
+    (void)len;
+    *endptr = (char *)str;
+    return raw;
+}
+
+quad_raw str_to_f80_yy(const char *str, size_t len, char **endptr) {
+    quad_raw raw = { 0, 0 };
+    (void)len;
+    *endptr = (char *)str;
+    return raw;
+}
+
+#endif
+
+/* benckmark config */
+#if defined(__SIZEOF_INT128__)
+int quad_yy_available = 1;
+#else
+int quad_yy_available = 0;
+#endif
@@ -0,0 +1,384 @@
+/*
+ * Copyright (c) 2018 YaoYuan <ibireme@gmail.com>.
+ * Released under the MIT license (MIT).
+ */
+
+#include "yybench.h"
+#include "bench_cpu.h"
+#include "yy_double.h"
+#include "../dtoa/dtoa_funcs.h"
+#include "../strtod/strtod_funcs.h"
+#include <inttypes.h>
+
+/*----------------------------------------------------------------------------*/
+/**
+ This benchmark writes each double with a function of `run_dtoa`, and reads
+ the string back with a function of `run_strtod`, for every pair of them. The
+ output formats differ (such as `1e-7`, `1e-07` and `0.0000001`), and a reader
+ may be fast on one and slow on another, so the per-direction charts cannot
+ tell which pair is the best for a write-then-read workload (cache files).
+
+ Function prototypes (same as the other runs):
+ */
+typedef char *(*dtoa_func)(double val, char *buf);
+typedef double (*strtod_func)(const char *str, size_t len, char **endptr);
+
+/** Value count of each case. */
+#define ROUNDTRIP_SAMPLE_COUNT 4096
+
+/** Value count of each dataset in verification. */
+#define ROUNDTRIP_VERIFY_COUNT 10000
+
+/** Buffer size of each string (with padding for the readers). */
+#define ROUNDTRIP_SLOT_LEN 64
+
+
+
+/*----------------------------------------------------------------------------*/
+
+typedef union {
+    f64 f; u64 u;
+} f64_uni;
+
+static yy_inline u64 f64_to_u64_raw(f64 f) {
+    f64_uni uni;
+    uni.f = f;
+    return uni.u;
+}
+
+static yy_inline f64 f64_from_u64_raw(u64 u) {
+    f64_uni uni;
+    uni.u = u;
+    return uni.f;
+}
+
+
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct {
+    const char *name;
+    dtoa_func func;
+} dtoa_item;
+
+typedef struct {
+    const char *name;
+    strtod_func func;
+} strtod_item;
+
+static dtoa_item dtoa_arr[64];
+static strtod_item strtod_arr[64];
+static int dtoa_num = 0;
+static int strtod_num = 0;
+static int dtoa_name_max = 0;
+static int strtod_name_max = 0;
+
+/** The pairs which are not bit-exact in verification (not charted). */
+static bool pair_fail[64][64];
+
+// returns the function name aligned (inner memory)
+static char *get_name_aligned(const char *name, int name_max, bool align_right) {
+    static char buf[64];
+    int len = (int)strlen(name);
+    int space = name_max - len;
+    if (align_right) {
+        for (int i = 0; i < space; i++) buf[i] = ' ';
+        memcpy(buf + space, name, len);
+    } else {
+        memcpy(buf, name, len);
+        for (int i = 0; i < space; i++) buf[len + i] = ' ';
+    }
+    buf[name_max] = '\0';
+    return buf;
+}
+
+
+
+/*----------------------------------------------------------------------------*/
+
+/** Get random double. */
+static yy_inline f64 rand_f64(void) {
+    while (true) {
+        u64 u = yy_random64();
+        f64 f = f64_from_u64_raw(u);
+        if (isfinite(f)) return f;
+    };
+}
+
+/** Get random double with random significant digit count (1 to 17), the
+    decimal exponent is in range [exp_min, exp_max]. */
+static yy_inline f64 rand_f64_len_exp(int exp_min, int exp_max) {
+    char buf[64], *cur = buf, *end;
+    u32 len = yy_random32_range(1, 17);
+    if (yy_random32() & 1) *cur++ = '-';
+    *cur++ = (char)('0' + yy_random32_range(1, 9));
+    *cur++ = '.';
+    for (u32 i = 1; i < len; i++) *cur++ = (char)('0' + yy_random32_uniform(10));
+    snprintf(cur, 16, "e%d", (int)yy_random32_range(0, (u32)(exp_max - exp_min)) + exp_min);
+    return yy_string_to_double(buf, &end);
+}
+
+/** Get random double with random digit count (exponent -20 to 20). */
+static yy_inline f64 rand_f64_len(void) {
+    return rand_f64_len_exp(-20, 20);
+}
+
+/** Get random double around the exponent notation boundary of most writers. */
+static yy_inline f64 rand_f64_small(void) {
+    return rand_f64_len_exp(-9, -5);
+}
+
+/** Get random normalized double (in range 0.0 to 1.0). */
+static yy_inline f64 rand_f64_normalize(void) {
+    return (f64)yy_random64() / (f64)UINT64_MAX;
+}
+
+/** Get random double which can convert to integer exactly. */
+static yy_inline f64 rand_f64_integer(void) {
+    return (f64)yy_random64_range(1, (u64)1 << 53);
+}
+
+typedef f64 (*fill_f64_func)(void);
+
+typedef struct {
+    const char *name;
+    const char *desc;
+    fill_f64_func fill;
+} dataset_t;
+
+static dataset_t dataset_arr[] = {
+    { "random", "random double number in all binary range, ignore nan and inf", rand_f64 },
+    { "random length", "random double number with random significant digit count", rand_f64_len },
+    { "small", "random double number in range 1e-9 to 1e-4 (where the writers switch to exponent notation)", rand_f64_small },
+    { "nomalized", "random double number in range 0.0 to 1.0", rand_f64_normalize },
+    { "integer", "random double number from integer", rand_f64_integer },
+};
+static const int dataset_num = (int)(sizeof(dataset_arr) / sizeof(dataset_t));
+
+
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ Verify all pairs: the string written by the dtoa function should be read back
+ by the strtod function as the same bits. The mismatch count of each pair is
+ printed as a matrix (dtoa in rows, strtod in columns).
+ */
+static void roundtrip_func_verify_all(void) {
+    f64 *vals = malloc((usize)ROUNDTRIP_VERIFY_COUNT * dataset_num * sizeof(f64));
+    u32 *lens = malloc((usize)ROUNDTRIP_VERIFY_COUNT * dataset_num * sizeof(u32));
+    char *strs = malloc((usize)ROUNDTRIP_VERIFY_COUNT * dataset_num * ROUNDTRIP_SLOT_LEN);
+    usize count = (usize)ROUNDTRIP_VERIFY_COUNT * dataset_num;
+    if (!vals || !lens || !strs) {
+        printf("memory allocation failed.\n");
+        free(vals);
+        free(lens);
+        free(strs);
+        return;
+    }
+
+    yy_random_reset();
+    for (int d = 0; d < dataset_num; d++) {
+        for (u32 i = 0; i < ROUNDTRIP_VERIFY_COUNT; i++) {
+            vals[(usize)d * ROUNDTRIP_VERIFY_COUNT + i] = dataset_arr[d].fill();
+        }
+    }
+
+    /* header: strtod names */
+    int col_len = strtod_name_max < 6 ? 6 : strtod_name_max;
+    printf("verify %s", get_name_aligned("", dtoa_name_max, false));
+    for (int s = 0; s < strtod_num; s++) {
+        printf(" %s", get_name_aligned(strtod_arr[s].name, col_len, true));
+    }
+    printf("\n");
+
+    for (int t = 0; t < dtoa_num; t++) {
+        dtoa_func dtoa = dtoa_arr[t].func;
+        memset(strs, 0, count * ROUNDTRIP_SLOT_LEN);
+        for (usize i = 0; i < count; i++) {
+            char *str = strs + i * ROUNDTRIP_SLOT_LEN;
+            lens[i] = (u32)(dtoa(vals[i], str) - str);
+        }
+
+        printf("verify %s", get_name_aligned(dtoa_arr[t].name, dtoa_name_max, false));
+        for (int s = 0; s < strtod_num; s++) {
+            strtod_func strtod = strtod_arr[s].func;
+            u64 errors = 0;
+            for (usize i = 0; i < count; i++) {
+                char *str = strs + i * ROUNDTRIP_SLOT_LEN, *end;
+                f64 val = strtod(str, lens[i], &end);
+                if (f64_to_u64_raw(val) != f64_to_u64_raw(vals[i]) ||
+                    end != str + lens[i]) errors++;
+            }
+            pair_fail[t][s] = errors > 0;
+            if (errors) {
+                char num[32];
+                snprintf(num, sizeof(num), "%" PRIu64, errors);
+                printf(" %s", get_name_aligned(num, col_len, true));
+            } else {
+                printf(" %s", get_name_aligned("OK", col_len, true));
+            }
+        }
+        printf("\n");
+    }
+
+    free(vals);
+    free(lens);
+    free(strs);
+}
+
+
+
+/*----------------------------------------------------------------------------*/
+
+static void roundtrip_func_benchmark_all(const char *output_path) {
+    static const int repeat_count = 16;
+
+    printf("initialize...\n");
+    bench_cpu_setup();
+
+    f64 *vals = malloc(ROUNDTRIP_SAMPLE_COUNT * sizeof(f64));
+    if (!vals) {
+        printf("memory allocation failed.\n");
+        return;
+    }
+
+    const char *categories[64 + 1];
+    for (int t = 0; t < dtoa_num; t++) categories[t] = dtoa_arr[t].name;
+    categories[dtoa_num] = NULL;
+
+    yy_report *report = yy_report_new();
+    bench_report_add_env_info(report);
+
+    for (int d = 0; d < dataset_num; d++) {
+        dataset_t dataset = dataset_arr[d];
+        printf("run benchmark %s...", dataset.name);
+
+        yy_random_reset();
+        for (u32 i = 0; i < ROUNDTRIP_SAMPLE_COUNT; i++) vals[i] = dataset.fill();
+
+        char title[128];
+        snprintf(title, sizeof(title), "dtoa then strtod (%s)", dataset.name);
+        yy_chart *chart = yy_chart_new();
+        yy_chart_options op;
+        yy_chart_options_init(&op);
+        op.title = title;
+        op.subtitle = dataset.desc;
+        op.type = YY_CHART_BAR;
+        op.v_axis.title = "dtoa";
+        op.v_axis.categories = categories;
+        op.h_axis.title = "average CPU cycles (write + read), 0 if not bit-exact";
+        op.plot.value_labels_enabled = true;
+        op.plot.value_labels_decimals = 1;
+        op.plot.group_padding = 0.1f;
+        op.plot.point_padding = 0.0f;
+        op.plot.border_width = 0.0f;
+        op.legend.enabled = true;
+        op.tooltip.value_decimals = 2;
+        op.tooltip.shared = true;
+        op.tooltip.crosshairs = true;
+        op.width = 800;
+        op.height = 120 + dtoa_num * (strtod_num * 8 + 16);
+
+        /* one item for each strtod, one value for each dtoa */
+        for (int s = 0; s < strtod_num; s++) {
+            strtod_func strtod = strtod_arr[s].func;
+            yy_chart_item_begin(chart, strtod_arr[s].name);
+            for (int t = 0; t < dtoa_num; t++) {
+                dtoa_func dtoa = dtoa_arr[t].func;
+                char buf[ROUNDTRIP_SLOT_LEN] = { 0 };
+                char *end;
+                u64 ticks_min;
+                if (pair_fail[t][s]) {
+                    yy_chart_item_add_float(chart, 0.0f);
+                    continue;
+                }
+                for (int retry = 0; ; retry++) {
+                    ticks_min = UINT64_MAX;
+                    for (int r = 0; r < repeat_count; r++) {
+                        u64 t1 = yy_time_get_ticks();
+                        for (u32 i = 0; i < ROUNDTRIP_SAMPLE_COUNT; i++) {
+                            char *str_end = dtoa(vals[i], buf);
+                            strtod(buf, (usize)(str_end - buf), &end);
+                        }
+                        u64 t2 = yy_time_get_ticks();
+                        u64 t = t2 - t1;
+                        if (t < ticks_min) ticks_min = t;
+                    }
+                    if (bench_cpu_check_freq(retry)) break;
+                }
+                f64 cycles = (f64)ticks_min / ROUNDTRIP_SAMPLE_COUNT * bench_cpu_get_cycle_per_tick();
+                yy_chart_item_add_float(chart, (f32)cycles);
+            }
+            yy_chart_item_end(chart);
+        }
+        yy_chart_set_options(chart, &op);
+        yy_report_add_chart(report, chart);
+        yy_chart_free(chart);
+        printf("[OK]\n");
+    }
+
+    bench_report_add_drift_info(report);
+    if (!yy_report_write_html_file(report, output_path)) {
+        printf("[ERROR] report write failed: %s\n", output_path);
+    } else {
+        printf("report generated: %s\n", output_path);
+    }
+    yy_report_free(report);
+    free(vals);
+}
+
+
+
+/*----------------------------------------------------------------------------*/
+
+static void roundtrip_func_cleanup(void) {
+    dtoa_num = 0;
+    strtod_num = 0;
+    dtoa_name_max = 0;
+    strtod_name_max = 0;
+    memset(pair_fail, 0, sizeof(pair_fail));
+}
+
+/*
+ The function lists are shared with the dtoa and strtod runs (dtoa_funcs.h and
+ strtod_funcs.h), without the "null" functions (the output cannot be read
+ back). The format variants of yy are included, as the same digits in
+ different notations.
+ */
+static void roundtrip_func_register_all(void) {
+#define dtoa_func_register(_name) \
+    extern char *dtoa_##_name(double val, char *buf); \
+    dtoa_arr[dtoa_num].name = #_name; \
+    dtoa_arr[dtoa_num].func = dtoa_##_name; \
+    dtoa_num++; \
+    if ((int)strlen(#_name) > dtoa_name_max) dtoa_name_max = (int)strlen(#_name);
+
+#define strtod_func_register(_name) \
+    extern double strtod_##_name(const char *str, size_t len, char **endptr); \
+    strtod_arr[strtod_num].name = #_name; \
+    strtod_arr[strtod_num].func = strtod_##_name; \
+    strtod_num++; \
+    if ((int)strlen(#_name) > strtod_name_max) strtod_name_max = (int)strlen(#_name);
+
+    DTOA_FUNC_LIST(dtoa_func_register) /* see dtoa_funcs.h */
+    dtoa_func_register(fmt_ecma) /* JavaScript Number.prototype.toString() */
+    dtoa_func_register(fmt_repr) /* Python repr() */
+    dtoa_func_register(fmt_g) /* C "%.17g" with shortest digits */
+    dtoa_func_register(fmt_json) /* the shorter notation */
+
+    STRTOD_FUNC_LIST(strtod_func_register) /* see strtod_funcs.h */
+
+#undef dtoa_func_register
+#undef strtod_func_register
+}
+
+void benchmark(const char *output_path) {
+    roundtrip_func_register_all();
+    printf("------[verify]---------\n");
+    roundtrip_func_verify_all();
+    printf("------[benchmark]------\n");
+    roundtrip_func_benchmark_all(output_path);
+    printf("------[finish]---------\n");
+    roundtrip_func_cleanup();
+}
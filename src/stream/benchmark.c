@@ -0,0 +1,336 @@
+/*
+ * Copyright (c) 2018 YaoYuan <ibireme@gmail.com>.
+ * Released under the MIT license (MIT).
+ */
+
+#include "stream.h"
+#include "yybench.h"
+#include "bench_cpu.h"
+#include <inttypes.h>
+
+/*----------------------------------------------------------------------------*/
+/**
+ This benchmark reads a document of numbers (e.g. `[1.5,2,-3e-7]`) which is
+ split into chunks, as when the input comes from a network or file stream.
+ The chunk size is varied from 64B to 1MB, the result is reported in MB/s.
+ */
+
+/* the readers used by the stream parser */
+extern double strtod_yy_fast(const char *str, size_t len, char **end);
+
+/** Document size (the numbers are appended until the size is reached). */
+#define STREAM_DOC_SIZE (4 * 1024 * 1024)
+
+/** Chunk size for benchmark: 64B to 1MB. */
+#define STREAM_CHUNK_MIN 64
+#define STREAM_CHUNK_MAX (1024 * 1024)
+
+
+
+/*----------------------------------------------------------------------------*/
+
+typedef union {
+    f64 f; u64 u;
+} f64_uni;
+
+static yy_inline f64 f64_from_u64_raw(u64 u) {
+    f64_uni uni;
+    uni.u = u;
+    return uni.f;
+}
+
+/** Get random double in all binary range (ignore nan and inf). */
+static usize write_f64_random(char *buf) {
+    while (true) {
+        f64 f = f64_from_u64_raw(yy_random64());
+        if (isfinite(f)) return (usize)snprintf(buf, 32, "%.17g", f);
+    }
+}
+
+/** Get random normalized double (in range 0.0 to 1.0) with 1-8 digits. */
+static usize write_f64_short(char *buf) {
+    f64 f = (f64)yy_random64() / (f64)UINT64_MAX;
+    return (usize)snprintf(buf, 32, "%.*g", (int)yy_random32_range(1, 8), f);
+}
+
+static const u64 pow10_table[] = {
+    1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL,
+    10000000ULL, 100000000ULL, 1000000000ULL, 10000000000ULL,
+    100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+    100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,
+    100000000000000000ULL, 1000000000000000000ULL
+};
+
+/** Get random int64 with random digit count (1-19). */
+static usize write_i64_random(char *buf) {
+    u32 len = yy_random32_range(1, 19);
+    u64 min = len == 1 ? 0 : pow10_table[len - 1];
+    u64 max = len == 19 ? INT64_MAX : pow10_table[len] - 1;
+    i64 val = (i64)yy_random64_range(min, max);
+    if (yy_random32() & 1) val = -val;
+    return (usize)snprintf(buf, 32, "%" PRId64, val);
+}
+
+typedef usize (*write_num_func)(char *buf);
+
+typedef struct {
+    const char *name;
+    const char *desc;
+    stream_type type;
+    write_num_func func;
+} dataset_t;
+
+static dataset_t dataset_arr[] = {
+    { "double (random)", "random double number in all binary range", stream_type_f64, write_f64_random },
+    { "double (short)", "random double number in range 0.0 to 1.0 with 1 to 8 digits", stream_type_f64, write_f64_short },
+    { "int64 (random)", "random int64 number with random digit count", stream_type_i64, write_i64_random },
+};
+static const int dataset_num = (int)(sizeof(dataset_arr) / sizeof(dataset_t));
+
+/** A document of numbers and the values (the values are read in place). */
+typedef struct {
+    char *str;
+    usize len;
+    usize count;
+    void *vals;
+} stream_doc;
+
+/** Create a document (null-terminated) with about `size` bytes. */
+static bool stream_doc_create(stream_doc *doc, dataset_t dataset, usize size) {
+    usize cap = size + 64, max = size / 2 + 1;
+    doc->str = malloc(cap);
+    doc->vals = malloc(max * sizeof(u64));
+    doc->len = 0;
+    doc->count = 0;
+    if (!doc->str || !doc->vals) return false;
+
+    yy_random_reset();
+    char *cur = doc->str;
+    *cur++ = '[';
+    while ((usize)(cur - doc->str) < size) {
+        if (doc->count) *cur++ = ',';
+        cur += dataset.func(cur);
+        doc->count++;
+    }
+    *cur++ = ']';
+    *cur = '\0';
+    doc->len = (usize)(cur - doc->str);
+
+    /* the expected values, read from the whole document */
+    const char *str = doc->str;
+    for (usize i = 0; i < doc->count; i++) {
+        char *end;
+        str++; /* skip '[' or ',' */
+        if (dataset.type == stream_type_f64) {
+            ((f64 *)doc->vals)[i] = strtod_yy_fast(str, 32, &end);
+        } else {
+            ((i64 *)doc->vals)[i] = (i64)strtoll(str, &end, 10);
+        }
+        str = end;
+    }
+    return true;
+}
+
+static void stream_doc_release(stream_doc *doc) {
+    free(doc->str);
+    free(doc->vals);
+    doc->str = NULL;
+    doc->vals = NULL;
+}
+
+/** Read the document with the specified chunk size. */
+static yy_inline bool stream_read_doc(stream_parser *p, stream_doc *doc,
+                                      stream_type type, void *vals, usize chunk) {
+    const char *cur = doc->str, *end = doc->str + doc->len;
+    stream_parser_init(p, type, vals, doc->count);
+    while (cur < end) {
+        usize len = (usize)(end - cur);
+        if (len > chunk) len = chunk;
+        if (!stream_parser_feed(p, cur, len)) return false;
+        cur += len;
+    }
+    return stream_parser_finish(p);
+}
+
+
+
+/*----------------------------------------------------------------------------*/
+
+/** Feed a string with the chunk size, each chunk is copied to an exact-size
+    allocation, so that any out-of-range read can be detected by sanitizer. */
+static bool stream_verify_str(stream_parser *p, const char *str, usize chunk) {
+    usize len = strlen(str);
+    const char *cur = str, *end = str + len;
+    while (cur < end) {
+        usize n = (usize)(end - cur);
+        if (n > chunk) n = chunk;
+        char *tmp = malloc(n);
+        if (!tmp) return false;
+        memcpy(tmp, cur, n);
+        bool suc = stream_parser_feed(p, tmp, n);
+        free(tmp);
+        if (!suc) return false;
+        cur += n;
+    }
+    return stream_parser_finish(p);
+}
+
+static void stream_func_verify_all(void) {
+    usize chunk_arr[] = { 1, 2, 3, 5, 7, 13, 64, 1000, 4096, 65536 };
+    int chunk_num = (int)(sizeof(chunk_arr) / sizeof(usize));
+    stream_parser p;
+
+    for (int d = 0; d < dataset_num; d++) {
+        dataset_t dataset = dataset_arr[d];
+        stream_doc doc;
+        void *outs = malloc((256 * 1024 + 1) * sizeof(u64));
+        bool suc = outs && stream_doc_create(&doc, dataset, 512 * 1024);
+        for (int c = 0; c < chunk_num && suc; c++) {
+            usize chunk = chunk_arr[c];
+            stream_parser_init(&p, dataset.type, outs, doc.count);
+            if (chunk < 64) {
+                /* small chunks are slow to copy, use a part of document */
+                char tmp[4096];
+                usize len = doc.len < 3000 ? doc.len : 3000;
+                while (len < doc.len && doc.str[len] != ',') len++;
+                memcpy(tmp, doc.str, len);
+                tmp[len] = '\0';
+                suc = stream_verify_str(&p, tmp, chunk);
+            } else {
+                suc = stream_read_doc(&p, &doc, dataset.type, outs, chunk) &&
+                      p.count == doc.count;
+            }
+            suc = suc && memcmp(outs, doc.vals, p.count * sizeof(u64)) == 0;
+            if (!suc) {
+                printf("verify %s, chunk size %d: [FAIL]\n",
+                       dataset.name, (int)chunk);
+            }
+        }
+        stream_doc_release(&doc);
+        free(outs);
+        printf("verify %s [%s]\n", dataset.name, suc ? "OK" : "FAIL");
+    }
+
+    /* the stream should be rejected */
+    typedef struct {
+        stream_type type;
+        const char *str;
+    } fail_case;
+    char long_num[STREAM_SEAM_MAX + 8];
+    memset(long_num, '1', sizeof(long_num) - 1);
+    long_num[sizeof(long_num) - 1] = '\0';
+    fail_case fail_arr[] = {
+        { stream_type_f64, "[1.2.3]" },
+        { stream_type_f64, "[1e]" },
+        { stream_type_f64, "-" },
+        { stream_type_f64, long_num },
+        { stream_type_i64, "[1.5]" },
+        { stream_type_i64, "[99999999999999999999]" },
+    };
+    int fail_num = (int)(sizeof(fail_arr) / sizeof(fail_case));
+    bool suc = true;
+    u64 outs[8];
+    for (int i = 0; i < fail_num; i++) {
+        for (usize chunk = 1; chunk <= 8; chunk++) {
+            stream_parser_init(&p, fail_arr[i].type, outs, 8);
+            if (stream_verify_str(&p, fail_arr[i].str, chunk)) {
+                printf("verify fail case \"%s\", chunk size %d: [FAIL]\n",
+                       fail_arr[i].str, (int)chunk);
+                suc = false;
+            }
+        }
+    }
+    printf("verify fail cases [%s]\n", suc ? "OK" : "FAIL");
+}
+
+
+
+/*----------------------------------------------------------------------------*/
+
+/** Convert the minimum ticks of one document to MB/s. */
+static f64 stream_ticks_to_mbps(u64 ticks, usize doc_len) {
+    f64 sec = (f64)ticks * bench_cpu_get_cycle_per_tick() / bench_cpu_get_freq();
+    if (sec <= 0) return 0;
+    return (f64)doc_len / sec / (1024.0 * 1024.0);
+}
+
+static void stream_func_benchmark_all(const char *output_path) {
+    printf("initialize...\n");
+    bench_cpu_setup();
+
+    int meansure_count = 16;
+
+    yy_report *report = yy_report_new();
+    bench_report_add_env_info(report);
+
+    yy_chart_options op;
+    yy_chart_options_init(&op);
+    op.title = "stream parse (chunked)";
+    op.subtitle = "4MB document, read without copy except the numbers which straddle chunks";
+    op.type = YY_CHART_LINE;
+    op.v_axis.title = "MB/s (higher is better)";
+    op.h_axis.title = "chunk size (2^n bytes)";
+    op.h_axis.tick_interval = 1;
+    op.plot.point_start = 6; /* 64B */
+    op.tooltip.value_decimals = 1;
+    op.tooltip.shared = true;
+    op.tooltip.crosshairs = true;
+    op.width = 800;
+    op.height = 540;
+    yy_chart *chart = yy_chart_new();
+    yy_chart_set_options(chart, &op);
+
+    stream_parser p;
+    for (int d = 0; d < dataset_num; d++) {
+        dataset_t dataset = dataset_arr[d];
+        printf("run benchmark %s...", dataset.name);
+
+        stream_doc doc;
+        void *outs = malloc((STREAM_DOC_SIZE / 2 + 1) * sizeof(u64));
+        if (!outs || !stream_doc_create(&doc, dataset, STREAM_DOC_SIZE)) {
+            printf("memory allocation failed.\n");
+            return;
+        }
+
+        yy_chart_item_begin(chart, dataset.name);
+        for (usize chunk = STREAM_CHUNK_MIN; chunk <= STREAM_CHUNK_MAX; chunk *= 2) {
+            u64 ticks_min;
+            for (int retry = 0; ; retry++) {
+                ticks_min = UINT64_MAX;
+                for (int r = 0; r < meansure_count; r++) {
+                    u64 t1 = yy_time_get_ticks();
+                    stream_read_doc(&p, &doc, dataset.type, outs, chunk);
+                    u64 t2 = yy_time_get_ticks();
+                    u64 t = t2 - t1;
+                    if (t < ticks_min) ticks_min = t;
+                }
+                if (bench_cpu_check_freq(retry)) break;
+            }
+            yy_chart_item_add_float(chart, (f32)stream_ticks_to_mbps(ticks_min, doc.len));
+        }
+        yy_chart_item_end(chart);
+
+        stream_doc_release(&doc);
+        free(outs);
+        printf("[OK]\n");
+    }
+    yy_report_add_chart(report, chart);
+    yy_chart_free(chart);
+
+    // export report to html
+    bench_report_add_drift_info(report);
+    bool suc = yy_report_write_html_file(report, output_path);
+    if (!suc) {
+        printf("write report file failed: %s\n", output_path);
+    }
+    yy_report_free(report);
+}
+
+void benchmark(const char *output_path) {
+    printf("------[verify]---------\n");
+    stream_func_verify_all();
+    printf("------[benchmark]------\n");
+    stream_func_benchmark_all(output_path);
+    printf("------[finish]---------\n");
+    return;
+}
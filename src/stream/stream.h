@@ -0,0 +1,51 @@
+#ifndef stream_h
+#define stream_h
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/**
+ A resumable number stream parser.
+
+ The input is a sequence of numbers separated by any non-number characters,
+ such as `[1.5, 2, -3e-7]` or one number per line. The input can be split into
+ chunks at any position, a number which straddles two chunks is copied into a
+ small seam buffer, other numbers are read from the chunk directly.
+
+ The chunk does not need to be null-terminated, and is never read out of range.
+ */
+
+/** Max length of a number which straddles chunks. */
+#define STREAM_SEAM_MAX 128
+
+typedef enum {
+    stream_result_suc = 0,
+    stream_result_fail = 1,
+} stream_result;
+
+typedef enum {
+    stream_type_f64 = 0, /* read with `strtod_yy_fast()` */
+    stream_type_i64 = 1, /* read with `atoi_i64_yy()` */
+} stream_type;
+
+typedef struct {
+    stream_type type;
+    stream_result res;
+    size_t count;   /* number of values read */
+    void *vals;     /* output buffer, `double *` or `int64_t *` */
+    size_t max;     /* capacity of the output buffer */
+    size_t seam_len; /* length of the pending number in seam buffer */
+    char seam[STREAM_SEAM_MAX + 1];
+} stream_parser;
+
+/** Initialize the parser with an output buffer. */
+void stream_parser_init(stream_parser *p, stream_type type, void *vals, size_t max);
+
+/** Feed a chunk to the parser, returns false if failed. */
+bool stream_parser_feed(stream_parser *p, const char *chunk, size_t len);
+
+/** Read the pending number at the end of stream, returns false if failed. */
+bool stream_parser_finish(stream_parser *p);
+
+#endif /* stream_h */
@@ -0,0 +1,202 @@
+/*
+ A resumable number stream parser by ibireme.
+ The numbers are read by `strtod_yy_fast()` and `atoi_i64_yy()`.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "stream.h"
+#include "../atoi/benchmark.h"
+
+
+/* compiler builtin check (clang) */
+#ifndef yy_has_builtin
+#   ifdef __has_builtin
+#       define yy_has_builtin(x) __has_builtin(x)
+#   else
+#       define yy_has_builtin(x) 0
+#   endif
+#endif
+
+/* compiler attribute check (gcc/clang) */
+#ifndef yy_has_attribute
+#   ifdef __has_attribute
+#       define yy_has_attribute(x) __has_attribute(x)
+#   else
+#       define yy_has_attribute(x) 0
+#   endif
+#endif
+
+/* inline */
+#ifndef yy_inline
+#   if _MSC_VER >= 1200
+#       define yy_inline __forceinline
+#   elif defined(_MSC_VER)
+#       define yy_inline __inline
+#   elif yy_has_attribute(always_inline) || __GNUC__ >= 4
+#       define yy_inline __inline__ __attribute__((always_inline))
+#   elif defined(__clang__) || defined(__GNUC__)
+#       define yy_inline __inline__
+#   elif defined(__cplusplus) || (__STDC__ >= 1 && __STDC_VERSION__ >= 199901L)
+#       define yy_inline inline
+#   else
+#       define yy_inline
+#   endif
+#endif
+
+/* likely */
+#ifndef yy_likely
+#   if yy_has_builtin(__builtin_expect) || __GNUC__ >= 4
+#       define yy_likely(expr) __builtin_expect(!!(expr), 1)
+#   else
+#       define yy_likely(expr) (expr)
+#   endif
+#endif
+
+/* unlikely */
+#ifndef yy_unlikely
+#   if yy_has_builtin(__builtin_expect) || __GNUC__ >= 4
+#       define yy_unlikely(expr) __builtin_expect(!!(expr), 0)
+#   else
+#       define yy_unlikely(expr) (expr)
+#   endif
+#endif
+
+/* the readers, see `strtod_yy_fast.c` and `atoi_yy.c` */
+double strtod_yy_fast(const char *str, size_t len, char **end);
+int64_t atoi_i64_yy(const char *str, size_t len, char **endptr, atoi_result *res);
+
+
+
+/*==============================================================================
+ * Digit Character Matcher
+ *============================================================================*/
+
+/**
+ Digit type table, same as `strtod_yy_fast.c`:
+ '0' (0x01), [1-9] (0x02), '+' (0x04), '-' (0x08), '.' (0x10), [eE] (0x20).
+ Any character in this table may be a part of a number, others are separators.
+ */
+static const uint8_t digi_table[256] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0x10, 0x00,
+    0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+/** Match a character which may be a part of number. */
+static yy_inline bool digi_is_num(uint8_t d) {
+    return digi_table[d] != 0;
+}
+
+
+
+/*==============================================================================
+ * Stream Parser
+ *============================================================================*/
+
+/**
+ Read a number which is followed by a separator in memory,
+ returns the end of number, or NULL if failed.
+ */
+static yy_inline const char *stream_read_num(stream_parser *p,
+                                             const char *cur, size_t len) {
+    char *end;
+    if (yy_unlikely(p->count == p->max)) return NULL;
+    if (p->type == stream_type_f64) {
+        double val = strtod_yy_fast(cur, len, &end);
+        ((double *)p->vals)[p->count] = val;
+    } else {
+        atoi_result res;
+        int64_t val = atoi_i64_yy(cur, len, &end, &res);
+        if (yy_unlikely(res != atoi_result_suc)) return NULL;
+        ((int64_t *)p->vals)[p->count] = val;
+    }
+    /* the number should be ended with a separator */
+    if (yy_unlikely(end == cur || digi_is_num((uint8_t)*end))) return NULL;
+    p->count++;
+    return end;
+}
+
+/** Read the number in seam buffer. */
+static bool stream_read_seam(stream_parser *p) {
+    p->seam[p->seam_len] = '\0'; /* null is a separator */
+    const char *end = stream_read_num(p, p->seam, p->seam_len);
+    if (yy_unlikely(end != p->seam + p->seam_len)) {
+        p->res = stream_result_fail;
+        return false;
+    }
+    p->seam_len = 0;
+    return true;
+}
+
+void stream_parser_init(stream_parser *p, stream_type type, void *vals, size_t max) {
+    p->type = type;
+    p->res = stream_result_suc;
+    p->count = 0;
+    p->vals = vals;
+    p->max = max;
+    p->seam_len = 0;
+}
+
+bool stream_parser_feed(stream_parser *p, const char *chunk, size_t len) {
+    const char *cur = chunk, *end = chunk + len, *safe, *tmp;
+    size_t tail;
+
+    if (yy_unlikely(p->res != stream_result_suc)) return false;
+
+    /* complete the number which straddles the previous chunk */
+    if (p->seam_len) {
+        tmp = cur;
+        while (tmp < end && digi_is_num((uint8_t)*tmp)) tmp++;
+        tail = (size_t)(tmp - cur);
+        if (yy_unlikely(p->seam_len + tail > STREAM_SEAM_MAX)) goto fail;
+        memcpy(p->seam + p->seam_len, cur, tail);
+        p->seam_len += tail;
+        if (tmp == end) return true; /* still not finished */
+        if (!stream_read_seam(p)) return false;
+        cur = tmp;
+    }
+
+    /* find the last separator, the numbers before it can be read in place */
+    safe = end;
+    while (safe > cur && digi_is_num((uint8_t)safe[-1])) safe--;
+
+    while (true) {
+        while (cur < safe && !digi_is_num((uint8_t)*cur)) cur++;
+        if (cur >= safe) break;
+        cur = stream_read_num(p, cur, (size_t)(safe - cur));
+        if (yy_unlikely(!cur)) goto fail;
+    }
+
+    /* copy the unfinished number to seam buffer */
+    tail = (size_t)(end - safe);
+    if (yy_unlikely(tail > STREAM_SEAM_MAX)) goto fail;
+    memcpy(p->seam, safe, tail);
+    p->seam_len = tail;
+    return true;
+
+fail:
+    p->res = stream_result_fail;
+    return false;
+}
+
+bool stream_parser_finish(stream_parser *p) {
+    if (yy_unlikely(p->res != stream_result_suc)) return false;
+    if (p->seam_len) return stream_read_seam(p);
+    return true;
+}
@@ -5,9 +5,24 @@
 
 #include "benchmark_helper.h"
 #include "yybench.h"
+#include "bench_cpu.h"
+#include "bench_corun.h"
+#include "bench_search.h"
+#include "bench_sample.h"
+#include "bench_direct.h"
+#include "strtod_funcs.h"
 #include <inttypes.h>
 #include <fenv.h>
 
+#if !defined(_WIN32)
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#define BOUNDED_PROBE_ENABLED 1
+#else
+#define BOUNDED_PROBE_ENABLED 0
+#endif
+
 #ifndef BENCHMARK_DATA_PATH
 extern const char *benchmark_get_data_path(void);
 #define BENCHMARK_DATA_PATH benchmark_get_data_path()
@@ -23,6 +38,12 @@ extern const char *benchmark_get_data_path(void);
  */
 typedef double (*strtod_func)(const char *str, size_t len, char **endptr);
 
+/**
+ A function prototype to convert string to double with a rounding mode.
+ @param mode The rounding mode: FE_TONEAREST, FE_UPWARD, FE_DOWNWARD or FE_TOWARDZERO.
+ */
+typedef double (*strtod_round_func)(const char *str, size_t len, char **endptr, int mode);
+
 
 
 /*----------------------------------------------------------------------------*/
@@ -53,8 +74,31 @@ static yy_inline f64 f64_from_u64_raw(u64 u) {
 static int func_count = 0;
 static strtod_func func_arr[128];
 static char *func_name_arr[128];
+static bench_isolate_func func_direct_arr[128]; /* see STRTOD_DIRECT_MEASURE */
 static int func_name_max = 0;
 
+/* whether the function reads exactly `len` bytes (probed with a guard page) */
+static bool func_bounded_arr[128];
+
+/* the bounded wrappers of the functions which require null-terminated input */
+static int bounded_func_count = 0;
+static strtod_func bounded_func_arr[128];
+static char *bounded_func_name_arr[128];
+
+/* the functions which read hex-float string, such as `0x1.8p+3` */
+static int hex_func_count = 0;
+static strtod_func hex_func_arr[128];
+static char *hex_func_name_arr[128];
+
+/* the functions which read with a rounding mode, the first one is the reference */
+static int round_func_count = 0;
+static strtod_round_func round_func_arr[128];
+static char *round_func_name_arr[128];
+
+/* the IEEE-754 rounding modes */
+static const int round_mode_arr[4] = { FE_TONEAREST, FE_UPWARD, FE_DOWNWARD, FE_TOWARDZERO };
+static const char *round_mode_name_arr[4] = { "nearest", "upward", "downward", "toward zero" };
+
 
 // returns the function name aligned (inner memory)
 static char *get_name_aligned(const char *name, bool align_right) {
@@ -75,8 +119,6 @@ static char *get_name_aligned(const char *name, bool align_right) {
 
 
 static void strtod_func_verify_all(void) {
-//    fesetround(FE_TOWARDZERO);
-    
     for (int i = 1; i < func_count; i++) { // skip null func
         const char *name = func_name_arr[i];
         strtod_func func = func_arr[i];
@@ -182,6 +224,278 @@ static void strtod_func_verify_all(void) {
 
 /*----------------------------------------------------------------------------*/
 
+typedef enum {
+    bounded_safe = 0,
+    bounded_wrong_len = 1,   /* returns wrong ending pointer */
+    bounded_out_of_range = 2, /* reads the guard page */
+    bounded_unknown = 3,
+} bounded_result;
+
+static const char *bounded_result_desc(bounded_result res) {
+    switch (res) {
+        case bounded_safe: return "[OK]";
+        case bounded_wrong_len: return "[UNSAFE: wrong length]";
+        case bounded_out_of_range: return "[UNSAFE: read out of range]";
+        default: return "[SKIP: not supported on this platform]";
+    }
+}
+
+/* numbers placed right before the guard page, in various forms */
+static const char *bounded_probe_strs[] = {
+    "0", "1", "-1", "7", "12345", "-0.0", "1.5", "0.001", "-3.25e-7", "1e300",
+    "1E-300", "123456789012345678", "9007199254740993", "18446744073709551616",
+    "1.7976931348623157e308", "4.9e-324", "2.2250738585072011e-308",
+    "0.1234567890123456789012345", "3.14159265358979323846264338327950288",
+    NULL
+};
+
+/**
+ Read each number which ends exactly at a page boundary, the next page is
+ protected with `mprotect()`. The function is called in a child process,
+ so a crash (reading the guard page) can be reported.
+ */
+static bounded_result strtod_func_probe_bounded(strtod_func func) {
+#if BOUNDED_PROBE_ENABLED
+    usize page = (usize)sysconf(_SC_PAGESIZE);
+    u8 *mem = mmap(NULL, page * 2, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mem == MAP_FAILED) return bounded_unknown;
+    if (mprotect(mem + page, page, PROT_NONE) != 0) {
+        munmap(mem, page * 2);
+        return bounded_unknown;
+    }
+    
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid == 0) {
+        for (int i = 0; bounded_probe_strs[i]; i++) {
+            usize len = strlen(bounded_probe_strs[i]);
+            char *str = (char *)mem + page - len;
+            char *end;
+            memset(mem, '9', page); /* no terminator before the guard page */
+            memcpy(str, bounded_probe_strs[i], len);
+            func(str, len, &end);
+            if (end != str + len) _exit(bounded_wrong_len);
+        }
+        _exit(bounded_safe);
+    }
+    
+    int status = 0;
+    bounded_result res = bounded_unknown;
+    if (pid > 0 && waitpid(pid, &status, 0) == pid) {
+        if (WIFSIGNALED(status)) res = bounded_out_of_range;
+        else if (WIFEXITED(status)) res = (bounded_result)WEXITSTATUS(status);
+    }
+    munmap(mem, page * 2);
+    return res;
+#else
+    (void)func;
+    return bounded_unknown;
+#endif
+}
+
+static void strtod_func_verify_bounded_all(void) {
+    for (int i = 1; i < func_count; i++) { // skip null func
+        bounded_result res = strtod_func_probe_bounded(func_arr[i]);
+        func_bounded_arr[i] = (res == bounded_safe);
+        printf("verify bounded %s %s\n",
+               get_name_aligned(func_name_arr[i], false), bounded_result_desc(res));
+    }
+    for (int i = 0; i < bounded_func_count; i++) {
+        bounded_result res = strtod_func_probe_bounded(bounded_func_arr[i]);
+        printf("verify bounded %s %s\n",
+               get_name_aligned(bounded_func_name_arr[i], false), bounded_result_desc(res));
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ Write hex-float string with all 13 hex digits of significand,
+ for example: 0x1.8000000000000p+3, 0x0.0000000000001p-1022.
+ */
+static int hex_write_full(u64 raw, char *buf) {
+    u64 sig = raw & UINT64_MAX >> 12;
+    int exp = (int)((raw >> 52) & 0x7FF);
+    int lead = exp != 0;
+    exp = exp ? exp - 1023 : -1022;
+    return snprintf(buf, 40, "%s0x%d.%013" PRIx64 "p%+d",
+                    (raw >> 63) ? "-" : "", lead, sig, exp);
+}
+
+/**
+ Verify the hex-float readers with bit-exact comparison, the expected value
+ of each test string is known without any reference reader.
+ */
+static void strtod_func_verify_hex_all(void) {
+    int count = 100000;
+    
+    /* "0x" without hex digit is read as "0", the exponent without digit is
+       not read (same as C strtod) */
+    static const struct { const char *str; u64 raw; int end; } edge_arr[] = {
+        { "0x", 0, 1 },
+        { "+0x", 0, 2 },
+        { "-0x", (u64)1 << 63, 2 },
+        { "-0x.p1", (u64)1 << 63, 2 },
+        { "+0x1p", 0x3FF0000000000000ULL, 4 },
+        { "-0x.8", 0xBFE0000000000000ULL, 5 },
+    };
+    
+    for (int i = 0; i < hex_func_count; i++) {
+        const char *name = hex_func_name_arr[i];
+        strtod_func func = hex_func_arr[i];
+        int func_err = 0;
+        
+        printf("verify hex %s ", get_name_aligned(name, false));
+        for (int e = 0; e < (int)(sizeof(edge_arr) / sizeof(edge_arr[0])); e++) {
+            char *end;
+            const char *str = edge_arr[e].str;
+            f64 val = func(str, strlen(str), &end);
+            if (f64_to_u64_raw(val) != edge_arr[e].raw || end != str + edge_arr[e].end) {
+                printf("\n    error: %s -> %.17g (end %d)", str, val, (int)(end - str));
+                func_err++;
+            }
+        }
+        yy_random_reset();
+        for (int v = 0; v < count; v++) {
+            u64 raw = yy_random64();
+            if (v % 4 == 1) raw &= UINT64_MAX >> 12 | (u64)1 << 63; /* subnormal */
+            if (v % 4 == 2) raw &= ~(UINT64_MAX >> 32); /* short significand */
+            if (!isfinite(f64_from_u64_raw(raw))) continue;
+            
+            char str[6][64];
+            u64 expect[6];
+            char full[40];
+            hex_write_full(raw, full);
+            const char *exp_str = strchr(full, 'p');
+            int sig_len = (int)(exp_str - full);
+            
+            /* libc, exact */
+            snprintf(str[0], 64, "%a", f64_from_u64_raw(raw));
+            expect[0] = raw;
+            /* all digits, exact */
+            snprintf(str[1], 64, "%s", full);
+            expect[1] = raw;
+            /* halfway, round to even */
+            snprintf(str[2], 64, "%.*s8%s", sig_len, full, exp_str);
+            expect[2] = (raw & 1) ? raw + 1 : raw;
+            /* above halfway, round up (max double to inf) */
+            snprintf(str[3], 64, "%.*s80000000001%s", sig_len, full, exp_str);
+            expect[3] = raw + 1;
+            /* below halfway, round down */
+            snprintf(str[4], 64, "%.*s7ff%s", sig_len, full, exp_str);
+            expect[4] = raw;
+            /* integer significand, upper case, such as 0X18P-1 */
+            int exp = (int)((raw >> 52) & 0x7FF);
+            u64 sig = (raw & UINT64_MAX >> 12) | ((u64)(exp != 0) << 52);
+            snprintf(str[5], 64, "%s0X%" PRIX64 "P%+d", (raw >> 63) ? "-" : "",
+                     sig, (exp ? exp - 1023 : -1022) - 52);
+            expect[5] = raw;
+            
+            for (int c = 0; c < 6; c++) {
+                char *end;
+                usize str_len = strlen(str[c]);
+                f64 val = func(str[c], str_len, &end);
+                if (f64_to_u64_raw(val) != expect[c] || end != str[c] + str_len) {
+                    func_err++;
+                }
+            }
+        }
+        if (!func_err) printf(" [OK]\n");
+        else printf(" [not_match:%d]\n", func_err);
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+
+/** Write a random test string for the rounding modes, returns the length. */
+static int round_write_case(char *buf, int idx) {
+    if (idx % 2 == 0) {
+        /* decimal of a random double with random precision, exact if long enough */
+        u64 raw = yy_random64();
+        if (idx % 8 == 0) raw &= UINT64_MAX >> 12 | (u64)1 << 63; /* subnormal */
+        if (idx % 8 == 2) raw &= ~(((u64)1 << yy_random32_uniform(52)) - 1); /* short significand */
+        f64 val = f64_from_u64_raw(raw);
+        if (!isfinite(val)) val = 0.0;
+        return snprintf(buf, 128, "%.*e", (int)yy_random32_uniform(80), val);
+    } else {
+        /* random digits (1-40), exponent in range [-360, 340] */
+        int len = 0, dig = (int)yy_random32_range(1, idx % 4 == 1 ? 19 : 40);
+        int dot = (int)yy_random32_uniform((u32)dig + 1);
+        if (yy_random32() & 1) buf[len++] = '-';
+        for (int i = 0; i < dig; i++) {
+            if (i == dot && i) buf[len++] = '.';
+            buf[len++] = (char)(i ? yy_random32_range(0, 9) : yy_random32_range(1, 9)) + '0';
+        }
+        return len + snprintf(buf + len, 32, "e%d", (int)yy_random32_range(0, 700) - 360);
+    }
+}
+
+/**
+ Verify the readers with rounding mode under all IEEE-754 rounding modes,
+ compared with the first registered reader (bit-exact, including signed zero).
+ The reference is glibc strtod() if available: david_gay_round rounds a few
+ inputs of the test data incorrectly in the directed modes (halfway to
+ overflow, long exact integers), so it is verified as the other readers.
+ Without glibc, david_gay_round is the reference and these inputs are reported
+ as mismatches of the other readers.
+ */
+static void strtod_func_verify_round_all(void) {
+    static const char *exact_cases[] = {
+        "0.5", "1e22", "1e23", "9007199254740993", "-9007199254740993",
+        "0.1", "-0.1", "1e-400", "-1e-400", "1e400", "-1e400",
+        "4.9406564584124654e-324", "2.4703282292062328e-324",
+        "1.7976931348623157e308", "1.7976931348623158e308", "-0.0",
+        "123456789012345678901234567890", "1.00000000000000000000000000000000000001"
+    };
+    int count = 100000;
+    
+    char data_path[YY_MAX_PATH];
+    yy_path_combine(data_path, BENCHMARK_DATA_PATH, "data", NULL);
+    int line_count = 0;
+    char **lines = bench_search_read_lines(data_path, "real_pass", &line_count);
+    
+    strtod_round_func ref = round_func_arr[0];
+    for (int i = 1; i < round_func_count; i++) {
+        const char *name = round_func_name_arr[i];
+        strtod_round_func func = round_func_arr[i];
+        int mode_err[4] = { 0 };
+        
+        printf("verify round %s ", get_name_aligned(name, false));
+        for (int m = 0; m < 4; m++) {
+            int mode = round_mode_arr[m];
+            int case_count = (int)(sizeof(exact_cases) / sizeof(exact_cases[0]));
+            yy_random_reset();
+            for (int v = 0; v < case_count + line_count + count; v++) {
+                char buf[128];
+                const char *str = buf;
+                if (v < case_count) str = exact_cases[v];
+                else if (v < case_count + line_count) str = lines[v - case_count];
+                else round_write_case(buf, v);
+                
+                usize len = strlen(str);
+                char *end1, *end2;
+                f64 val1 = ref(str, len, &end1, mode);
+                f64 val2 = func(str, len, &end2, mode);
+                if (f64_to_u64_raw(val1) != f64_to_u64_raw(val2) || end1 != end2) {
+                    mode_err[m]++;
+                }
+            }
+        }
+        if (!mode_err[0] && !mode_err[1] && !mode_err[2] && !mode_err[3]) {
+            printf(" [OK]\n");
+        } else {
+            for (int m = 0; m < 4; m++) {
+                if (mode_err[m]) printf(" [%s:%d]", round_mode_name_arr[m], mode_err[m]);
+            }
+            printf("\n");
+        }
+    }
+    bench_search_free_lines(lines, line_count);
+}
+
+/*----------------------------------------------------------------------------*/
+
 #define NUM_STR_LEN_MAX 32
 
 typedef void (*fill_func)(char *buf, int count);
@@ -331,12 +645,113 @@ static void fill_integer_fix_len(char *buf, int count, int len) {
     }
 }
 
+static void fill_hex_double(char *buf, int count) {
+    for (int i = 0; i < count; i++) {
+        char *s = buf + i * NUM_STR_LEN_MAX;
+        snprintf(s, NUM_STR_LEN_MAX, "%a", random_f64());
+    }
+}
+
+static void fill_hex_nomalized(char *buf, int count) {
+    for (int i = 0; i < count; i++) {
+        char *s = buf + i * NUM_STR_LEN_MAX;
+        f64 val = (f64)yy_random64() / (f64)UINT64_MAX;
+        val = (yy_random32() & 1) ? -val : val;
+        snprintf(s, NUM_STR_LEN_MAX, "%a", val);
+    }
+}
+
+static void fill_hex_nomalized_f32(char *buf, int count) {
+    for (int i = 0; i < count; i++) {
+        char *s = buf + i * NUM_STR_LEN_MAX;
+        f64 val = (f64)yy_random64() / (f64)UINT64_MAX;
+        val = (yy_random32() & 1) ? -val : val;
+        snprintf(s, NUM_STR_LEN_MAX, "%a", (f64)(f32)val);
+    }
+}
+
+/* worst-case inputs in data/worst_strtod_*.txt, generated by search mode */
+static char **worst_lines = NULL;
+static int worst_count = 0;
+
+static void fill_worst(char *buf, int count) {
+    for (int i = 0; i < count; i++) {
+        char *s = buf + i * NUM_STR_LEN_MAX;
+        snprintf(s, NUM_STR_LEN_MAX, "%s", worst_lines[yy_random32_uniform((u32)worst_count)]);
+    }
+}
+
+
+
+/*----------------------------------------------------------------------------*/
+
+/* context of co-run, adaptive sampling and direct-call measurement */
+typedef struct {
+    strtod_func func;
+    int num;
+    int meansure_count;
+} strtod_corun_ctx;
+
+/* measure a function with strings in `data`, returns min ticks */
+static u64 strtod_corun_measure(void *ctx, const void *data) {
+    strtod_corun_ctx *c = (strtod_corun_ctx *)ctx;
+    const char *buf = (const char *)data;
+    u64 ticks_min = UINT64_MAX;
+    for (int r = 0; r < c->meansure_count; r++) {
+        u64 t1 = yy_time_get_ticks();
+        for (int v = 0; v < c->num; v++) {
+            char *str = (char *)buf + v * NUM_STR_LEN_MAX;
+            c->func(str, NUM_STR_LEN_MAX, &str);
+        }
+        u64 t2 = yy_time_get_ticks();
+        u64 t = t2 - t1;
+        if (t < ticks_min) ticks_min = t;
+    }
+    return ticks_min;
+}
+
+/* the loop of direct-call measurement, `call` is a function pointer or name,
+   the result is kept alive, as an inlined call may be removed otherwise */
+#define STRTOD_DIRECT_LOOP(call) \
+    strtod_corun_ctx *c = (strtod_corun_ctx *)ctx; \
+    const char *buf = (const char *)data; \
+    u64 ticks_min = UINT64_MAX; \
+    for (int r = 0; r < c->meansure_count; r++) { \
+        u64 t1 = yy_time_get_ticks(); \
+        for (int v = 0; v < c->num; v++) { \
+            char *str = (char *)buf + v * NUM_STR_LEN_MAX; \
+            f64 val = call(str, NUM_STR_LEN_MAX, &str); \
+            bench_direct_escape(&val); \
+        } \
+        u64 t2 = yy_time_get_ticks(); \
+        u64 t = t2 - t1; \
+        if (t < ticks_min) ticks_min = t; \
+    } \
+    return ticks_min;
+
+/* measure a function through the pointer in context, returns min ticks */
+static u64 strtod_indirect_measure(void *ctx, const void *data) {
+    STRTOD_DIRECT_LOOP(c->func)
+}
+
+/* measure a function by name, returns min ticks */
+#define STRTOD_DIRECT_MEASURE(name) \
+extern double strtod_##name(const char *str, size_t len, char **endptr); \
+static u64 strtod_direct_measure_##name(void *ctx, const void *data) { \
+    STRTOD_DIRECT_LOOP(strtod_##name) \
+}
+
+/* one for each function in `strtod_func_register_all()` */
+STRTOD_DIRECT_MEASURE(null)
+STRTOD_FUNC_LIST(STRTOD_DIRECT_MEASURE)
+
+
+
+/*----------------------------------------------------------------------------*/
 
 static void strtod_func_benchmark_all(const char *output_path) {
     printf("initialize...\n");
-    yy_cpu_setup_priority();
-    yy_cpu_spin(1.0);
-    yy_cpu_measure_freq();
+    bench_cpu_setup();
     
     int num_per_case = 5000;
     int meansure_count = 16;
@@ -409,9 +824,21 @@ static void strtod_func_benchmark_all(const char *output_path) {
     };
     
     
+    /* worst-case inputs found by search mode (-w), if exists */
+    char data_path[YY_MAX_PATH];
+    yy_path_combine(data_path, BENCHMARK_DATA_PATH, "data", NULL);
+    worst_lines = bench_search_read_lines(data_path, "worst_strtod_", &worst_count);
+    if (worst_count) {
+        dataset_arr[dataset_num++] = (dataset_t) {
+            "worst case",
+            "slow inputs of each function found by search, in data/worst_strtod_*.txt",
+            fill_worst, false
+        };
+    }
+    
     char *buf = malloc(num_per_case * NUM_STR_LEN_MAX);
     yy_report *report = yy_report_new();
-    yy_report_add_env_info(report);
+    bench_report_add_env_info(report);
     
     for (int d = 0; d < dataset_num; d++) {
         dataset_t dataset = dataset_arr[d];
@@ -447,18 +874,22 @@ static void strtod_func_benchmark_all(const char *output_path) {
                     yy_random_reset();
                     ((fill_len_func)dataset.fill_func)(buf, num_per_case, len);
                     
-                    u64 ticks_min = UINT64_MAX;
-                    for (int r = 0; r < meansure_count; r++) {
-                        u64 t1 = yy_time_get_ticks();
-                        for (int v = 0; v < num_per_case; v++) {
-                            char *str = buf + v * NUM_STR_LEN_MAX;
-                            func(str, NUM_STR_LEN_MAX, &str);
+                    u64 ticks_min;
+                    for (int retry = 0; ; retry++) {
+                        ticks_min = UINT64_MAX;
+                        for (int r = 0; r < meansure_count; r++) {
+                            u64 t1 = yy_time_get_ticks();
+                            for (int v = 0; v < num_per_case; v++) {
+                                char *str = buf + v * NUM_STR_LEN_MAX;
+                                func(str, NUM_STR_LEN_MAX, &str);
+                            }
+                            u64 t2 = yy_time_get_ticks();
+                            u64 t = t2 - t1;
+                            if (t < ticks_min) ticks_min = t;
                         }
-                        u64 t2 = yy_time_get_ticks();
-                        u64 t = t2 - t1;
-                        if (t < ticks_min) ticks_min = t;
+                        if (bench_cpu_check_freq(retry)) break;
                     }
-                    f64 cycle = (f64)ticks_min / (f64)num_per_case * yy_cpu_get_cycle_per_tick();
+                    f64 cycle = (f64)ticks_min / (f64)num_per_case * bench_cpu_get_cycle_per_tick();
                     yy_chart_item_add_float(chart, (f32)cycle);
                 }
                 
@@ -484,7 +915,141 @@ static void strtod_func_benchmark_all(const char *output_path) {
             
             for (int f = 0; f < func_count; f++) {
                 strtod_func func = func_arr[f];
-                u64 ticks_min = UINT64_MAX;
+                u64 ticks_min;
+                for (int retry = 0; ; retry++) {
+                    ticks_min = UINT64_MAX;
+                    for (int r = 0; r < meansure_count; r++) {
+                        u64 t1 = yy_time_get_ticks();
+                        for (int v = 0; v < num_per_case; v++) {
+                            char *str = buf + v * NUM_STR_LEN_MAX;
+                            func(str, NUM_STR_LEN_MAX, &str);
+                        }
+                        u64 t2 = yy_time_get_ticks();
+                        u64 t = t2 - t1;
+                        if (t < ticks_min) ticks_min = t;
+                    }
+                    if (bench_cpu_check_freq(retry)) break;
+                }
+                f64 cycle = (f64)ticks_min / (f64)num_per_case * bench_cpu_get_cycle_per_tick();
+                yy_chart_item_with_float(chart, func_name_arr[f], (f32)cycle);
+                
+            }
+        }
+        yy_chart_sort_items_with_value(chart, false);
+        yy_chart_set_options(chart, &op);
+        yy_report_add_chart(report, chart);
+        yy_chart_free(chart);
+        
+        printf("[OK]\n");
+    }
+    
+    /* exact length: numbers are packed without separator or null-terminator,
+       as read from a memory-mapped file, only the bounded functions are used */
+    {
+        printf("run benchmark exact length (no padding)...");
+        
+        char *packed = malloc(num_per_case * NUM_STR_LEN_MAX);
+        u32 *offs = malloc((num_per_case + 1) * sizeof(u32));
+        yy_random_reset();
+        fill_double_rnd_len(buf, num_per_case);
+        u32 pos = 0;
+        for (int v = 0; v < num_per_case; v++) {
+            char *str = buf + v * NUM_STR_LEN_MAX;
+            u32 len = (u32)strlen(str);
+            offs[v] = pos;
+            memcpy(packed + pos, str, len);
+            pos += len;
+        }
+        offs[num_per_case] = pos;
+        
+        yy_chart *chart = yy_chart_new();
+        yy_chart_options op;
+        yy_chart_options_init(&op);
+        op.title = "random length (exact length, no padding)";
+        op.subtitle = "random significant digit count (1-17), numbers are not null-terminated";
+        op.type = YY_CHART_BAR;
+        op.h_axis.title = "CPU cycles";
+        op.plot.value_labels_enabled = true;
+        op.plot.value_labels_decimals = 2;
+        op.plot.color_by_point = true;
+        op.plot.group_padding = 0.0f;
+        op.plot.point_padding = 0.1f;
+        op.plot.border_width = 0.0f;
+        op.legend.enabled = false;
+        op.tooltip.value_decimals = 2;
+        op.width = 640;
+        op.height = 420;
+        
+        for (int f = 0; f < func_count + bounded_func_count; f++) {
+            bool is_bounded = f >= func_count;
+            if (!is_bounded && !func_bounded_arr[f]) continue;
+            strtod_func func = is_bounded ? bounded_func_arr[f - func_count] : func_arr[f];
+            const char *name = is_bounded ? bounded_func_name_arr[f - func_count] : func_name_arr[f];
+            u64 ticks_min;
+            for (int retry = 0; ; retry++) {
+                ticks_min = UINT64_MAX;
+                for (int r = 0; r < meansure_count; r++) {
+                    u64 t1 = yy_time_get_ticks();
+                    for (int v = 0; v < num_per_case; v++) {
+                        char *str = packed + offs[v];
+                        func(str, offs[v + 1] - offs[v], &str);
+                    }
+                    u64 t2 = yy_time_get_ticks();
+                    u64 t = t2 - t1;
+                    if (t < ticks_min) ticks_min = t;
+                }
+                if (bench_cpu_check_freq(retry)) break;
+            }
+            f64 cycle = (f64)ticks_min / (f64)num_per_case * bench_cpu_get_cycle_per_tick();
+            yy_chart_item_with_float(chart, name, (f32)cycle);
+        }
+        yy_chart_sort_items_with_value(chart, false);
+        yy_chart_set_options(chart, &op);
+        yy_report_add_chart(report, chart);
+        yy_chart_free(chart);
+        free(packed);
+        free(offs);
+        
+        printf("[OK]\n");
+    }
+    
+    /* hex-float: such as `0x1.8p+3`, only the hex functions are used */
+    dataset_t hex_dataset_arr[] = {
+        { "hex (random)", "random double number in all binary range, written by %a", fill_hex_double, false },
+        { "hex (normalized)", "random double number in range 0.0-1.0, written by %a", fill_hex_nomalized, false },
+        { "hex (float)", "random float number in range 0.0-1.0, written by %a", fill_hex_nomalized_f32, false },
+    };
+    for (int d = 0; d < (int)(sizeof(hex_dataset_arr) / sizeof(dataset_t)); d++) {
+        dataset_t dataset = hex_dataset_arr[d];
+        
+        printf("run benchmark %s...", dataset.name);
+        
+        yy_chart *chart = yy_chart_new();
+        yy_chart_options op;
+        yy_chart_options_init(&op);
+        op.title = dataset.name;
+        op.subtitle = dataset.desc;
+        op.type = YY_CHART_BAR;
+        op.h_axis.title = "CPU cycles";
+        op.plot.value_labels_enabled = true;
+        op.plot.value_labels_decimals = 2;
+        op.plot.color_by_point = true;
+        op.plot.group_padding = 0.0f;
+        op.plot.point_padding = 0.1f;
+        op.plot.border_width = 0.0f;
+        op.legend.enabled = false;
+        op.tooltip.value_decimals = 2;
+        op.width = 640;
+        op.height = 420;
+        
+        yy_random_reset();
+        ((fill_func)dataset.fill_func)(buf, num_per_case);
+        
+        for (int f = 0; f < hex_func_count; f++) {
+            strtod_func func = hex_func_arr[f];
+            u64 ticks_min;
+            for (int retry = 0; ; retry++) {
+                ticks_min = UINT64_MAX;
                 for (int r = 0; r < meansure_count; r++) {
                     u64 t1 = yy_time_get_ticks();
                     for (int v = 0; v < num_per_case; v++) {
@@ -495,10 +1060,10 @@ static void strtod_func_benchmark_all(const char *output_path) {
                     u64 t = t2 - t1;
                     if (t < ticks_min) ticks_min = t;
                 }
-                f64 cycle = (f64)ticks_min / (f64)num_per_case * yy_cpu_get_cycle_per_tick();
-                yy_chart_item_with_float(chart, func_name_arr[f], (f32)cycle);
-                
+                if (bench_cpu_check_freq(retry)) break;
             }
+            f64 cycle = (f64)ticks_min / (f64)num_per_case * bench_cpu_get_cycle_per_tick();
+            yy_chart_item_with_float(chart, hex_func_name_arr[f], (f32)cycle);
         }
         yy_chart_sort_items_with_value(chart, false);
         yy_chart_set_options(chart, &op);
@@ -508,6 +1073,171 @@ static void strtod_func_benchmark_all(const char *output_path) {
         printf("[OK]\n");
     }
     
+    /* rounding modes: the cost of directed rounding, compared with the nearest only reader */
+    for (int d = 0; d < 2; d++) {
+        dataset_t dataset = dataset_arr[d]; /* random, random length */
+        char title[64];
+        snprintf(title, sizeof(title), "%s (rounding modes)", dataset.name);
+        
+        printf("run benchmark %s...", title);
+        
+        yy_chart *chart = yy_chart_new();
+        yy_chart_options op;
+        yy_chart_options_init(&op);
+        op.title = title;
+        op.subtitle = "read with rounding mode, swar is the nearest only reader";
+        op.type = YY_CHART_BAR;
+        op.h_axis.title = "CPU cycles";
+        op.plot.value_labels_enabled = true;
+        op.plot.value_labels_decimals = 2;
+        op.plot.color_by_point = true;
+        op.plot.group_padding = 0.0f;
+        op.plot.point_padding = 0.1f;
+        op.plot.border_width = 0.0f;
+        op.legend.enabled = false;
+        op.tooltip.value_decimals = 2;
+        op.width = 640;
+        op.height = 640;
+        
+        yy_random_reset();
+        ((fill_func)dataset.fill_func)(buf, num_per_case);
+        
+        for (int f = -1; f < round_func_count; f++) {
+            for (int m = 0; m < 4; m++) {
+                if (f < 0 && m > 0) break;
+                strtod_func func = NULL;
+                strtod_round_func round_func = NULL;
+                int mode = round_mode_arr[m];
+                char name[64];
+                if (f < 0) {
+                    for (int i = 0; i < func_count; i++) {
+                        if (strcmp(func_name_arr[i], "swar") == 0) func = func_arr[i];
+                    }
+                    if (!func) break;
+                    snprintf(name, sizeof(name), "swar");
+                } else {
+                    round_func = round_func_arr[f];
+                    snprintf(name, sizeof(name), "%s (%s)",
+                             round_func_name_arr[f], round_mode_name_arr[m]);
+                }
+                
+                u64 ticks_min;
+                for (int retry = 0; ; retry++) {
+                    ticks_min = UINT64_MAX;
+                    for (int r = 0; r < meansure_count; r++) {
+                        u64 t1 = yy_time_get_ticks();
+                        if (func) {
+                            for (int v = 0; v < num_per_case; v++) {
+                                char *str = buf + v * NUM_STR_LEN_MAX;
+                                func(str, NUM_STR_LEN_MAX, &str);
+                            }
+                        } else {
+                            for (int v = 0; v < num_per_case; v++) {
+                                char *str = buf + v * NUM_STR_LEN_MAX;
+                                round_func(str, NUM_STR_LEN_MAX, &str, mode);
+                            }
+                        }
+                        u64 t2 = yy_time_get_ticks();
+                        u64 t = t2 - t1;
+                        if (t < ticks_min) ticks_min = t;
+                    }
+                    if (bench_cpu_check_freq(retry)) break;
+                }
+                f64 cycle = (f64)ticks_min / (f64)num_per_case * bench_cpu_get_cycle_per_tick();
+                yy_chart_item_with_float(chart, name, (f32)cycle);
+            }
+        }
+        yy_chart_set_options(chart, &op);
+        yy_report_add_chart(report, chart);
+        yy_chart_free(chart);
+        
+        printf("[OK]\n");
+    }
+    
+    /* adaptive sampling mode: run each function with several dataset seeds */
+    if (bench_sample_get_seeds()) {
+        printf("run benchmark random length (adaptive sampling)...");
+        
+        yy_chart *chart = bench_sample_chart_new("random length (adaptive sampling)");
+        int seed_count = bench_sample_get_seeds();
+        
+        for (int f = 0; f < func_count; f++) {
+            strtod_corun_ctx ctx = { func_arr[f], num_per_case, 1 }; /* one sample per call */
+            bench_sample res[BENCH_SAMPLE_SEED_MAX];
+            for (int seed = 0; seed < seed_count; seed++) {
+                bench_sample_seed(seed);
+                fill_double_rnd_len(buf, num_per_case);
+                bench_sample_run(strtod_corun_measure, &ctx, buf, &res[seed]);
+            }
+            bench_sample_chart_add(chart, func_name_arr[f], res, seed_count,
+                                   (usize)num_per_case);
+        }
+        yy_chart_sort_items_with_value(chart, false);
+        yy_report_add_chart(report, chart);
+        yy_chart_free(chart);
+        bench_report_add_sample_info(report);
+        
+        printf("[OK]\n");
+    }
+    
+    /* direct-call mode: run each function with a loop calling it by name */
+    if (bench_direct_get_enabled()) {
+        printf("run benchmark random length (direct call)...");
+        
+        const char *names[128];
+        bench_direct res[128], base = { 0 };
+        int count = 0;
+        
+        yy_random_reset();
+        fill_double_rnd_len(buf, num_per_case);
+        
+        for (int f = 0; f < func_count; f++) {
+            strtod_corun_ctx ctx = { func_arr[f], num_per_case, meansure_count };
+            bench_direct cur;
+            bench_direct_run(strtod_indirect_measure, func_direct_arr[f], &ctx, buf, &cur);
+            if (strcmp(func_name_arr[f], "null") == 0) {
+                base = cur; /* the loop overhead */
+            } else {
+                names[count] = func_name_arr[f];
+                res[count++] = cur;
+            }
+        }
+        yy_chart *chart = bench_direct_chart_new("random length (direct call)", names, res,
+                                                 count, &base, (usize)num_per_case);
+        yy_report_add_chart(report, chart);
+        yy_chart_free(chart);
+        bench_report_add_direct_info(report);
+        
+        printf("[OK]\n");
+    }
+    
+    /* co-run mode: run each function with an antagonist on the sibling core */
+    if (bench_corun_start()) {
+        printf("run benchmark random length (co-runner slowdown)...");
+        
+        yy_chart *chart = bench_corun_chart_new("random length (co-runner slowdown)");
+        
+        yy_random_reset();
+        fill_double_rnd_len(buf, num_per_case);
+        
+        for (int f = 0; f < func_count; f++) {
+            strtod_corun_ctx ctx = { func_arr[f], num_per_case, meansure_count };
+            u64 ticks_alone, ticks_corun;
+            bench_corun_run(strtod_corun_measure, &ctx, buf, &ticks_alone, &ticks_corun);
+            bench_corun_chart_add(chart, func_name_arr[f], ticks_alone, ticks_corun,
+                                  (usize)num_per_case);
+        }
+        yy_chart_sort_items_with_value(chart, false);
+        yy_report_add_chart(report, chart);
+        yy_chart_free(chart);
+        bench_report_add_corun_info(report);
+        bench_corun_stop();
+        
+        printf("[OK]\n");
+    }
+    
+    bench_report_add_drift_info(report);
+    
     bool suc = yy_report_write_html_file(report, output_path);
     if (!suc) {
         printf("write report file failed: %s\n", output_path);
@@ -515,11 +1245,83 @@ static void strtod_func_benchmark_all(const char *output_path) {
     
     yy_report_free(report);
     free(buf);
+    bench_search_free_lines(worst_lines, worst_count);
+    worst_lines = NULL;
+    worst_count = 0;
+}
+
+
+
+/*----------------------------------------------------------------------------*/
+
+/* context of worst-case search */
+typedef struct {
+    strtod_func func;
+} strtod_search_ctx;
+
+/* measure one input, returns 0 if the input is not fully consumed */
+static u64 strtod_search_measure(void *ctx, const char *input, usize len) {
+    strtod_func func = ((strtod_search_ctx *)ctx)->func;
+    char str[BENCH_SEARCH_INPUT_MAX + 1];
+    memcpy(str, input, len);
+    str[len] = '\0';
+    char *end;
+    f64 val = func(str, len, &end);
+    if (end != str + len || !isfinite(val)) return 0;
+    
+    u64 t1 = yy_time_get_ticks();
+    for (int i = 0; i < BENCH_SEARCH_CALLS; i++) {
+        func(str, len, &end);
+    }
+    u64 t2 = yy_time_get_ticks();
+    return t2 > t1 ? t2 - t1 : 1;
+}
+
+/* search the slow inputs of a function, seeded with the test data */
+static void strtod_func_search(const char *name, const char *output_path) {
+    strtod_search_ctx ctx = { NULL };
+    for (int f = 0; f < func_count; f++) {
+        if (strcmp(func_name_arr[f], name) == 0) ctx.func = func_arr[f];
+    }
+    for (int f = 0; f < bounded_func_count; f++) {
+        if (strcmp(bounded_func_name_arr[f], name) == 0) ctx.func = bounded_func_arr[f];
+    }
+    if (!ctx.func) {
+        printf("[ERROR] unknown function: %s, available:", name);
+        for (int f = 0; f < func_count; f++) printf(" %s", func_name_arr[f]);
+        for (int f = 0; f < bounded_func_count; f++) printf(" %s", bounded_func_name_arr[f]);
+        printf("\n");
+        return;
+    }
+    
+    printf("initialize...\n");
+    bench_cpu_setup();
+    
+    char data_path[YY_MAX_PATH];
+    yy_path_combine(data_path, BENCHMARK_DATA_PATH, "data", NULL);
+    int seed_count = 0;
+    char **seeds = bench_search_read_lines(data_path, "real_pass", &seed_count);
+    
+    char title[128];
+    snprintf(title, sizeof(title), "strtod %s", name);
+    bench_search_options op = { 0 };
+    op.name = title;
+    op.kind = BENCH_SEARCH_TEXT;
+    op.len_max = NUM_STR_LEN_MAX - 1; /* same as the benchmark datasets */
+    op.measure = strtod_search_measure;
+    op.ctx = &ctx;
+    op.seeds = (const char **)seeds;
+    op.seed_count = seed_count;
+    bench_search_run(&op, output_path);
+    bench_search_free_lines(seeds, seed_count);
 }
 
 static void strtod_func_cleanup(void) {
     func_count = 0;
     func_name_max = 0;
+    bounded_func_count = 0;
+    hex_func_count = 0;
+    round_func_count = 0;
 }
 
 static void strtod_func_register_all(void) {
@@ -527,25 +1329,72 @@ static void strtod_func_register_all(void) {
     extern double strtod_##name(const char *str, size_t len, char **endptr); \
     func_arr[func_count] = strtod_##name; \
     func_name_arr[func_count] = #name; \
+    func_direct_arr[func_count] = strtod_direct_measure_##name; \
     func_count++; \
     if ((int)strlen(#name) > func_name_max) func_name_max = (int)strlen(#name);
     
     strtod_func_register(null) /* used to meansure the benchmark overhead */
-    strtod_func_register(libc)
-    strtod_func_register(david_gay)
-    strtod_func_register(google)
-    strtod_func_register(lemire)
+    STRTOD_FUNC_LIST(strtod_func_register) /* see strtod_funcs.h */
+    
+    func_bounded_arr[0] = true; /* null func reads nothing */
+    
+#define strtod_func_register_bounded(name) \
+    extern double strtod_##name##_bounded(const char *str, size_t len, char **endptr); \
+    bounded_func_arr[bounded_func_count] = strtod_##name##_bounded; \
+    bounded_func_name_arr[bounded_func_count] = #name "_bounded"; \
+    bounded_func_count++; \
+    if ((int)strlen(#name "_bounded") > func_name_max) func_name_max = (int)strlen(#name "_bounded");
+    
+    strtod_func_register_bounded(libc)
+    strtod_func_register_bounded(david_gay)
+    strtod_func_register_bounded(lemire)
 #ifndef _MSC_VER
-    strtod_func_register(ryu)
+    strtod_func_register_bounded(ryu)
 #endif
-    strtod_func_register(yy)
-    strtod_func_register(yy_fast)
+    strtod_func_register_bounded(yy)
+    strtod_func_register_bounded(yy_fast)
+    
+#define strtod_func_register_hex(name) \
+    extern double strtod_##name(const char *str, size_t len, char **endptr); \
+    hex_func_arr[hex_func_count] = strtod_##name; \
+    hex_func_name_arr[hex_func_count] = #name; \
+    hex_func_count++; \
+    if ((int)strlen(#name) > func_name_max) func_name_max = (int)strlen(#name);
+    
+    strtod_func_register_hex(libc) /* C99 strtod() reads hex-float */
+    strtod_func_register_hex(hex_yy)
+    
+#define strtod_func_register_round(name) \
+    extern double strtod_##name##_round(const char *str, size_t len, char **endptr, int mode); \
+    round_func_arr[round_func_count] = strtod_##name##_round; \
+    round_func_name_arr[round_func_count] = #name "_round"; \
+    round_func_count++; \
+    if ((int)strlen(#name "_round") > func_name_max) func_name_max = (int)strlen(#name "_round");
+    
+#if defined(__GLIBC__)
+    strtod_func_register_round(libc) /* reference, glibc rounds correctly in all modes */
+    strtod_func_register_round(david_gay) /* with fesetround() */
+#else
+    strtod_func_register_round(david_gay) /* reference, with fesetround() */
+    strtod_func_register_round(libc) /* with fesetround() */
+#endif
+    strtod_func_register_round(swar)
 }
 
 void benchmark(const char *output_path) {
     strtod_func_register_all();
+    if (bench_search_get_target()) {
+        printf("------[search]---------\n");
+        strtod_func_search(bench_search_get_target(), output_path);
+        printf("------[finish]---------\n");
+        strtod_func_cleanup();
+        return;
+    }
     printf("------[verify]---------\n");
     strtod_func_verify_all();
+    strtod_func_verify_bounded_all();
+    strtod_func_verify_hex_all();
+    strtod_func_verify_round_all();
     printf("------[benchmark]------\n");
     strtod_func_benchmark_all(output_path);
     printf("------[finish]---------\n");
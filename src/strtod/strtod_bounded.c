@@ -0,0 +1,39 @@
+/*
+ Bounded wrappers for the functions which ignore `len` and read the string
+ until a null-terminator (or a non-number character).
+ The string is copied to a null-terminated buffer, so the input can be read
+ directly from a memory-mapped file without padding.
+ */
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+/** Stack buffer size, longer string is copied to heap. */
+#define BOUNDED_BUF_LEN 64
+
+#define strtod_bounded_wrap(name) \
+extern double strtod_##name(const char *str, size_t len, char **endptr); \
+double strtod_##name##_bounded(const char *str, size_t len, char **endptr) { \
+    char buf[BOUNDED_BUF_LEN], *tmp = buf, *end; \
+    double val; \
+    if (len >= BOUNDED_BUF_LEN) { \
+        tmp = (char *)malloc(len + 1); \
+        if (!tmp) { \
+            *endptr = (char *)str; \
+            return 0.0; \
+        } \
+    } \
+    memcpy(tmp, str, len); \
+    tmp[len] = '\0'; \
+    val = strtod_##name(tmp, len, &end); \
+    *endptr = (char *)str + (end - tmp); \
+    if (tmp != buf) free(tmp); \
+    return val; \
+}
+
+strtod_bounded_wrap(libc)
+strtod_bounded_wrap(david_gay)
+strtod_bounded_wrap(lemire)
+strtod_bounded_wrap(yy)
+strtod_bounded_wrap(yy_fast)
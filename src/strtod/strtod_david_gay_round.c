@@ -0,0 +1,27 @@
+/*
+ David Gay's strtod compiled with `Honor_FLT_ROUNDS`, the result is rounded
+ with the current rounding mode (fegetround()), used as the reference of the
+ directed rounding modes. The symbols are renamed to avoid conflicting with
+ the david_gay library. The bigcomp is disabled, as it does not round correctly
+ with the directed rounding modes.
+ */
+#include <stddef.h>
+#include <fenv.h>
+
+#define Honor_FLT_ROUNDS
+#define NO_STRTOD_BIGCOMP
+#define strtod_gay strtod_gay_honor_rounds
+#define dtoa_gay dtoa_gay_honor_rounds
+#define dtoa_divmax dtoa_divmax_honor_rounds
+#include "david_gay_dtoa.c"
+
+double strtod_david_gay_round(const char *str, size_t len, char **endptr, int mode) {
+    int old = fegetround();
+    double val;
+    fesetround(mode);
+    val = strtod_gay(str, endptr);
+    fesetround(old);
+    /* the underflow result is -0.0 in FE_DOWNWARD mode, fix the sign */
+    if (val == 0.0) val = (*str == '-') ? -0.0 : 0.0;
+    return val;
+}
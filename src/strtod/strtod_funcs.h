@@ -0,0 +1,31 @@
+#ifndef strtod_funcs_h
+#define strtod_funcs_h
+
+/**
+ The registered functions which read double, shared by the runs which use them
+ (strtod, roundtrip), so the lists can not drift apart.
+ Function prototype: double strtod_<name>(const char *str, size_t len, char **endptr);
+ 
+ Expand the list with a macro which takes the name, for example:
+ #define register(name) func_arr[func_count++] = strtod_##name;
+ STRTOD_FUNC_LIST(register)
+ 
+ The "null" function (benchmark overhead) is not in the list.
+ */
+#define STRTOD_FUNC_LIST(X) \
+    X(libc) \
+    X(david_gay) \
+    X(google) \
+    X(lemire) \
+    STRTOD_FUNC_LIST_NO_MSC(X) \
+    X(yy) \
+    X(yy_fast) \
+    X(swar)
+
+#ifndef _MSC_VER
+#   define STRTOD_FUNC_LIST_NO_MSC(X) X(ryu)
+#else
+#   define STRTOD_FUNC_LIST_NO_MSC(X)
+#endif
+
+#endif /* strtod_funcs_h */
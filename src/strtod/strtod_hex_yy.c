@@ -0,0 +1,150 @@
+/*
+ Read C99 hex-float string (such as `0x1.8p+3`) by ibireme.
+ The input is never read beyond `len`, the result is correctly rounded
+ (round to nearest, ties to even).
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+/** Hex digit value, or 0xFF if not a hex digit. */
+static const uint8_t hex_value_table[256] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+};
+
+/** Returns the number of leading 0-bits in value (input should not be 0). */
+static inline int u64_lz_bits(uint64_t v) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_clzll(v);
+#else
+    int n = 0;
+    while (!(v >> 63)) { v <<= 1; n++; }
+    return n;
+#endif
+}
+
+static inline double f64_from_raw(uint64_t raw, bool sign) {
+    double val;
+    raw |= (uint64_t)sign << 63;
+    memcpy(&val, &raw, 8);
+    return val;
+}
+
+double strtod_hex_yy(const char *str, size_t len, char **endptr) {
+    const uint8_t *hdr = (const uint8_t *)str;
+    const uint8_t *cur = hdr, *end = hdr + len, *num_hdr, *num_end;
+    uint64_t sig = 0, mant, raw;
+    int64_t exp = 0; /* value = sig * 2^exp */
+    bool sign = false, sticky = false, any = false, round, exp_sign;
+    uint32_t d;
+    int shift;
+    
+    if (cur < end && (*cur == '-' || *cur == '+')) sign = (*cur++ == '-');
+    num_hdr = cur; /* after the optional sign */
+    if (end - cur < 2 || cur[0] != '0' || (cur[1] | 0x20) != 'x') {
+        *endptr = (char *)str;
+        return 0.0;
+    }
+    cur += 2;
+    
+    /* read at most 16 significant hex digits, the rest are sticky bits */
+    while (cur < end && (d = hex_value_table[*cur]) < 16) {
+        if (sig >> 60) {
+            sticky |= (d != 0);
+            exp += 4;
+        } else {
+            sig = (sig << 4) | d;
+        }
+        any = true;
+        cur++;
+    }
+    if (cur < end && *cur == '.') {
+        cur++;
+        while (cur < end && (d = hex_value_table[*cur]) < 16) {
+            if (sig >> 60) {
+                sticky |= (d != 0);
+            } else {
+                sig = (sig << 4) | d;
+                exp -= 4;
+            }
+            any = true;
+            cur++;
+        }
+    }
+    if (!any) { /* "0x" without digits, read as "0" */
+        *endptr = (char *)num_hdr + 1;
+        return f64_from_raw(0, sign);
+    }
+    
+    /* binary exponent is optional */
+    num_end = cur;
+    if (cur < end && (*cur | 0x20) == 'p') {
+        int64_t exp_lit = 0;
+        cur++;
+        exp_sign = (cur < end && *cur == '-');
+        if (cur < end && (*cur == '-' || *cur == '+')) cur++;
+        if (cur < end && (uint8_t)(*cur - '0') <= 9) {
+            while (cur < end && (d = (uint8_t)(*cur - '0')) <= 9) {
+                if (exp_lit < 100000) exp_lit = exp_lit * 10 + d;
+                cur++;
+            }
+            exp += exp_sign ? -exp_lit : exp_lit;
+        } else {
+            cur = num_end;
+        }
+    }
+    *endptr = (char *)cur;
+    if (sig == 0) return f64_from_raw(0, sign);
+    
+    /* normalize: the highest bit of sig is 1, value = 1.xxx * 2^exp */
+    shift = u64_lz_bits(sig);
+    sig <<= shift;
+    exp += 63 - shift;
+    if (exp > 1023) return f64_from_raw(0x7FF0000000000000ULL, sign);
+    
+    /* keep 53 bits for normal number, less bits for subnormal number */
+    shift = 11;
+    if (exp < -1022) {
+        if (exp < -1022 - 53) return f64_from_raw(0, sign);
+        shift += (int)(-1022 - exp);
+    }
+    if (shift < 64) {
+        mant = sig >> shift;
+        round = (sig >> (shift - 1)) & 1;
+        sticky |= (sig & ((1ULL << (shift - 1)) - 1)) != 0;
+    } else { /* shift == 64 */
+        mant = 0;
+        round = (sig >> 63) & 1;
+        sticky |= (sig & ~(1ULL << 63)) != 0;
+    }
+    mant += round & (sticky | (mant & 1)); /* ties to even */
+    
+    if (exp < -1022) {
+        raw = mant; /* subnormal, may be rounded up to the minimum normal */
+    } else {
+        if (mant >> 53) { /* rounded up to next power of 2 */
+            mant >>= 1;
+            exp++;
+            if (exp > 1023) return f64_from_raw(0x7FF0000000000000ULL, sign);
+        }
+        raw = ((uint64_t)(exp + 1023) << 52) | (mant & 0x000FFFFFFFFFFFFFULL);
+    }
+    return f64_from_raw(raw, sign);
+}
@@ -1,5 +1,15 @@
 #include <stdlib.h>
+#include <fenv.h>
 
 double strtod_libc(const char *str, size_t len, char **endptr) {
     return strtod(str, endptr);
 }
+
+double strtod_libc_round(const char *str, size_t len, char **endptr, int mode) {
+    int old = fegetround();
+    double val;
+    fesetround(mode);
+    val = strtod(str, endptr);
+    fesetround(old);
+    return val;
+}
@@ -19,4 +19,17 @@ double strtod_ryu(const char *str, size_t len, char **endptr) {
     }
 }
 
+/* ryu's s2d_n() reads exactly `len` bytes, the string may not be null-terminated */
+double strtod_ryu_bounded(const char *str, size_t len, char **endptr) {
+    double val = 0.0;
+    enum Status ret = s2d_n(str, (int)len, &val);
+    if (ret == SUCCESS) {
+        *endptr = (char *)str + len;
+        return val;
+    } else {
+        *endptr = (char *)str;
+        return 0.0;
+    }
+}
+
 #endif
\ No newline at end of file
@@ -0,0 +1,656 @@
+/*
+ * Copyright (c) 2018 YaoYuan <ibireme@gmail.com>.
+ * Released under the MIT license (MIT).
+ */
+
+#include "token.h"
+#include "../atoi/benchmark.h"
+#include "yybench.h"
+#include "bench_cpu.h"
+#include <inttypes.h>
+
+/*----------------------------------------------------------------------------*/
+/**
+ This benchmark classifies the number tokens of a document (e.g.
+ `[1.5,2,-3e-7]`) as integer, decimal, exponent form or invalid, then
+ dispatches each token to the parser of its type, with the exact length known.
+ It's compared with direct parsing: try `atoi_i64_yy()` first, then
+ `strtod_yy_fast()` if the token is not an integer, and with the one pass
+ type-detecting reader `parse_number_yy()`.
+ */
+
+/* the classifiers */
+extern token_type token_classify_yy(const char *str, token_info *info);
+extern token_type token_classify_sse42(const char *str, token_info *info);
+extern token_type token_classify_avx2(const char *str, token_info *info);
+extern bool token_simd_has_sse42(void);
+extern bool token_simd_has_avx2(void);
+
+/* the parsers */
+extern double strtod_yy_fast(const char *str, size_t len, char **end);
+extern i64 atoi_i64_yy(const char *str, size_t len, char **endptr, atoi_result *res);
+extern i64 atoi_i64_swar_exact(const char *str, size_t len, char **endptr, atoi_result *res);
+extern number_type parse_number_yy(const char *str, size_t len, char **end, number_val *val);
+
+/** Document size (the tokens are appended until the size is reached). */
+#define TOKEN_DOC_SIZE (1024 * 1024)
+
+/** Padding after the document for the 64-byte window. */
+#define TOKEN_DOC_PADDING 64
+
+/** Max length of a token passed to the direct parsers (as an upper bound). */
+#define TOKEN_LEN_MAX 64
+
+
+
+/*----------------------------------------------------------------------------*/
+
+typedef union {
+    f64 f; u64 u;
+} f64_uni;
+
+static yy_inline f64 f64_from_u64_raw(u64 u) {
+    f64_uni uni;
+    uni.u = u;
+    return uni.f;
+}
+
+static const u64 pow10_table[] = {
+    1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL,
+    10000000ULL, 100000000ULL, 1000000000ULL, 10000000000ULL,
+    100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+    100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,
+    100000000000000000ULL, 1000000000000000000ULL
+};
+
+/** Get random int64 with random digit count (1-19). */
+static usize write_int(char *buf) {
+    u32 len = yy_random32_range(1, 19);
+    u64 min = len == 1 ? 0 : pow10_table[len - 1];
+    u64 max = len == 19 ? INT64_MAX : pow10_table[len] - 1;
+    i64 val = (i64)yy_random64_range(min, max);
+    if (yy_random32() & 1) val = -val;
+    return (usize)snprintf(buf, 32, "%" PRId64, val);
+}
+
+/** Get random decimal with 1 to 8 fraction digits, such as "-123.45". */
+static usize write_dec(char *buf) {
+    f64 f = (f64)yy_random64() / (f64)UINT64_MAX * 1e6;
+    if (yy_random32() & 1) f = -f;
+    return (usize)snprintf(buf, 32, "%.*f", (int)yy_random32_range(1, 8), f);
+}
+
+/** Get random double in all binary range with exponent, such as "1.5e-300". */
+static usize write_exp(char *buf) {
+    while (true) {
+        f64 f = f64_from_u64_raw(yy_random64());
+        if (isfinite(f)) {
+            return (usize)snprintf(buf, 32, "%.*e", (int)yy_random32_range(0, 16), f);
+        }
+    }
+}
+
+/** Get invalid token. */
+static usize write_invalid(char *buf) {
+    static const char *strs[] = {
+        "01", "-01", "1.", ".5", "-", "+1", "1e", "1e+", "1.2.3", "--1",
+        "1e5.0", "1-2", "1.e5", "-.5", "1ee5", "00.5"
+    };
+    const char *str = strs[yy_random32_uniform(sizeof(strs) / sizeof(strs[0]))];
+    usize len = strlen(str);
+    memcpy(buf, str, len + 1);
+    return len;
+}
+
+/** Get random token: 32% integer, 32% decimal, 32% exponent, 4% invalid. */
+static usize write_mixed(char *buf) {
+    u32 r = yy_random32_uniform(100);
+    if (r < 32) return write_int(buf);
+    if (r < 64) return write_dec(buf);
+    if (r < 96) return write_exp(buf);
+    return write_invalid(buf);
+}
+
+typedef usize (*write_token_func)(char *buf);
+
+typedef struct {
+    const char *name;
+    const char *desc;
+    write_token_func func;
+} dataset_t;
+
+static dataset_t dataset_arr[] = {
+    { "mixed", "32% integer, 32% decimal, 32% exponent form, 4% invalid", write_mixed },
+    { "integer", "random int64 with random digit count", write_int },
+    { "decimal", "random decimal with 1 to 8 fraction digits", write_dec },
+    { "exponent", "random double in all binary range with exponent", write_exp },
+};
+static const int dataset_num = (int)(sizeof(dataset_arr) / sizeof(dataset_t));
+
+/** A document of tokens, the start of each token is known. */
+typedef struct {
+    char *str;
+    usize len;
+    usize count;
+    u32 *offs;
+} token_doc;
+
+/** Create a document (null-terminated and padded) with about `size` bytes. */
+static bool token_doc_create(token_doc *doc, dataset_t dataset, usize size) {
+    usize cap = size + 64 + TOKEN_DOC_PADDING, max = size / 2 + 1;
+    doc->str = malloc(cap);
+    doc->offs = malloc(max * sizeof(u32));
+    doc->len = 0;
+    doc->count = 0;
+    if (!doc->str || !doc->offs) return false;
+    memset(doc->str, 0, cap);
+
+    yy_random_reset();
+    char *cur = doc->str;
+    *cur++ = '[';
+    while ((usize)(cur - doc->str) < size) {
+        if (doc->count) *cur++ = ',';
+        doc->offs[doc->count++] = (u32)(cur - doc->str);
+        cur += dataset.func(cur);
+    }
+    *cur++ = ']';
+    *cur = '\0';
+    doc->len = (usize)(cur - doc->str);
+    return true;
+}
+
+static void token_doc_release(token_doc *doc) {
+    free(doc->str);
+    free(doc->offs);
+    doc->str = NULL;
+    doc->offs = NULL;
+}
+
+
+
+/*----------------------------------------------------------------------------*/
+
+/** The parsed value of a token. */
+typedef struct {
+    token_type type; /* int, exp (double) or invalid */
+    union {
+        i64 i;
+        f64 f;
+    } v;
+} token_val;
+
+/** Returns true if the character is a token boundary. */
+static yy_inline bool token_is_boundary(char c) {
+    return !((c >= '0' && c <= '9') || c == '.' || c == 'e' || c == 'E' ||
+             c == '+' || c == '-');
+}
+
+/** Parse a classified token with the parser of its type. */
+static yy_inline void token_dispatch(const char *str, const token_info *info,
+                                     token_val *val) {
+    char *end;
+    atoi_result res;
+    switch (info->type) {
+        case token_type_int:
+            if (info->digits <= 18) {
+                /* no overflow, the exact length is known */
+                val->type = token_type_int;
+                val->v.i = atoi_i64_swar_exact(str, info->len, &end, &res);
+                return;
+            }
+            val->v.i = atoi_i64_yy(str, info->len, &end, &res);
+            if (res == atoi_result_suc) {
+                val->type = token_type_int;
+                return;
+            }
+            /* fallthrough: out of int64 range, read as double */
+        case token_type_dec:
+        case token_type_exp:
+            val->type = token_type_exp;
+            val->v.f = strtod_yy_fast(str, info->len, &end);
+            return;
+        default:
+            val->type = token_type_invalid;
+            return;
+    }
+}
+
+/** Parse a token directly: try integer first, then double. */
+static yy_inline void token_parse_direct(const char *str, token_val *val) {
+    char *end;
+    atoi_result res;
+    i64 i = atoi_i64_yy(str, TOKEN_LEN_MAX, &end, &res);
+    if (res == atoi_result_suc && token_is_boundary(*end)) {
+        val->type = token_type_int;
+        val->v.i = i;
+        return;
+    }
+    f64 f = strtod_yy_fast(str, TOKEN_LEN_MAX, &end);
+    if (end != str && token_is_boundary(*end)) {
+        val->type = token_type_exp;
+        val->v.f = f;
+    } else {
+        val->type = token_type_invalid;
+    }
+}
+
+/** Parse a token with the type-detecting reader, in one pass. */
+static yy_inline void token_parse_number(const char *str, token_val *val) {
+    char *end;
+    number_val num;
+    number_type type = parse_number_yy(str, TOKEN_LEN_MAX, &end, &num);
+    if (type == number_type_fail || !token_is_boundary(*end)) {
+        val->type = token_type_invalid;
+    } else if (type == number_type_f64) {
+        val->type = token_type_exp;
+        val->v.f = num.v.f;
+    } else if (type == number_type_u64 && num.v.u > (u64)INT64_MAX) {
+        /* out of int64 range, as the other parsers */
+        val->type = token_type_exp;
+        val->v.f = (f64)num.v.u;
+    } else {
+        val->type = token_type_int;
+        val->v.i = num.v.i;
+    }
+}
+
+/** A benchmark method, returns a checksum. */
+typedef u64 (*token_run_func)(token_func func, const token_doc *doc, token_val *vals);
+
+static u64 token_run_classify(token_func func, const token_doc *doc, token_val *vals) {
+    token_info info;
+    u64 sum = 0;
+    (void)vals;
+    for (usize i = 0; i < doc->count; i++) {
+        sum += func(doc->str + doc->offs[i], &info) + info.len;
+    }
+    return sum;
+}
+
+static u64 token_run_dispatch(token_func func, const token_doc *doc, token_val *vals) {
+    token_info info;
+    for (usize i = 0; i < doc->count; i++) {
+        const char *str = doc->str + doc->offs[i];
+        func(str, &info);
+        token_dispatch(str, &info, vals + i);
+    }
+    return (u64)vals[doc->count - 1].v.i;
+}
+
+static u64 token_run_direct(token_func func, const token_doc *doc, token_val *vals) {
+    (void)func;
+    for (usize i = 0; i < doc->count; i++) {
+        token_parse_direct(doc->str + doc->offs[i], vals + i);
+    }
+    return (u64)vals[doc->count - 1].v.i;
+}
+
+static u64 token_run_number(token_func func, const token_doc *doc, token_val *vals) {
+    (void)func;
+    for (usize i = 0; i < doc->count; i++) {
+        token_parse_number(doc->str + doc->offs[i], vals + i);
+    }
+    return (u64)vals[doc->count - 1].v.i;
+}
+
+static u64 token_run_strtod(token_func func, const token_doc *doc, token_val *vals) {
+    char *end;
+    (void)func;
+    for (usize i = 0; i < doc->count; i++) {
+        vals[i].type = token_type_exp;
+        vals[i].v.f = strtod_yy_fast(doc->str + doc->offs[i], TOKEN_LEN_MAX, &end);
+    }
+    return (u64)vals[doc->count - 1].v.i;
+}
+
+
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct {
+    const char *name;
+    token_func func;
+} classify_item;
+
+static classify_item classify_arr[8];
+static int classify_num = 0;
+
+static void token_func_register_all(void) {
+    classify_num = 0;
+    classify_arr[classify_num].name = "yy";
+    classify_arr[classify_num++].func = token_classify_yy;
+    if (token_simd_has_sse42()) {
+        classify_arr[classify_num].name = "sse42";
+        classify_arr[classify_num++].func = token_classify_sse42;
+    }
+    if (token_simd_has_avx2()) {
+        classify_arr[classify_num].name = "avx2";
+        classify_arr[classify_num++].func = token_classify_avx2;
+    }
+}
+
+static bool token_info_equal(const token_info *a, const token_info *b) {
+    if (a->type != b->type || a->len != b->len) return false;
+    if (a->type == token_type_invalid) return true;
+    return a->digits == b->digits && a->dot == b->dot && a->exp == b->exp;
+}
+
+static void token_func_verify_all(void) {
+    typedef struct {
+        const char *str;
+        token_type type;
+        u32 len;
+        u32 digits;
+    } token_case;
+    static const token_case case_arr[] = {
+        { "0", token_type_int, 1, 1 },
+        { "-0", token_type_int, 2, 1 },
+        { "123,", token_type_int, 3, 3 },
+        { "-9223372036854775808]", token_type_int, 20, 19 },
+        { "1.5", token_type_dec, 3, 2 },
+        { "-0.001 ", token_type_dec, 6, 4 },
+        { "1e5", token_type_exp, 3, 1 },
+        { "1E+5", token_type_exp, 4, 1 },
+        { "-1.25e-300,", token_type_exp, 10, 3 },
+        { "01", token_type_invalid, 2, 0 },
+        { "-01", token_type_invalid, 3, 0 },
+        { "1.", token_type_invalid, 2, 0 },
+        { ".5", token_type_invalid, 2, 0 },
+        { "-", token_type_invalid, 1, 0 },
+        { "+1", token_type_invalid, 2, 0 },
+        { "1e", token_type_invalid, 2, 0 },
+        { "1e+", token_type_invalid, 3, 0 },
+        { "1.2.3", token_type_invalid, 5, 0 },
+        { "1-2", token_type_invalid, 3, 0 },
+        { "1.e5", token_type_invalid, 4, 0 },
+        { "1e5.0", token_type_invalid, 5, 0 },
+        { "1e5e5", token_type_invalid, 5, 0 },
+        { "1e+-5", token_type_invalid, 5, 0 },
+        { "", token_type_invalid, 0, 0 },
+        { "x", token_type_invalid, 0, 0 },
+    };
+    int case_num = (int)(sizeof(case_arr) / sizeof(token_case));
+    char buf[256];
+
+    for (int f = 0; f < classify_num; f++) {
+        classify_item item = classify_arr[f];
+        bool suc = true;
+        token_info info;
+
+        /* the cases at different offsets of the window */
+        for (int c = 0; c < case_num; c++) {
+            token_case tc = case_arr[c];
+            for (int off = 0; off < 64; off++) {
+                memset(buf, '1', sizeof(buf));
+                memcpy(buf + off, tc.str, strlen(tc.str) + 1);
+                if (item.func(buf + off, &info) != tc.type || info.type != tc.type ||
+                    info.len != tc.len || info.digits != tc.digits) {
+                    printf("verify %s \"%s\" [FAIL], return %s len:%u digits:%u\n",
+                           item.name, tc.str, token_type_desc(info.type),
+                           info.len, info.digits);
+                    suc = false;
+                    break;
+                }
+            }
+        }
+
+        /* long tokens (fallback) and tokens across the blocks */
+        for (int len = 1; len < 160 && suc; len++) {
+            token_info expect;
+            for (int i = 0; i < len; i++) buf[i] = (char)('1' + i % 9);
+            for (int dot = -1; dot < len && suc; dot += 7) {
+                if (dot >= 0) buf[dot] = '.';
+                buf[len] = ',';
+                memset(buf + len + 1, 0, 80);
+                token_classify_yy(buf, &expect);
+                item.func(buf, &info);
+                if (!token_info_equal(&info, &expect)) {
+                    printf("verify %s length %d [FAIL]\n", item.name, len);
+                    suc = false;
+                }
+                if (dot >= 0) buf[dot] = (char)('1' + dot % 9);
+            }
+        }
+
+        /* the datasets, compare with the scalar classifier */
+        for (int d = 0; d < dataset_num && suc; d++) {
+            token_doc doc;
+            if (!token_doc_create(&doc, dataset_arr[d], 256 * 1024)) {
+                printf("memory allocation failed.\n");
+                return;
+            }
+            for (usize i = 0; i < doc.count; i++) {
+                token_info expect;
+                const char *str = doc.str + doc.offs[i];
+                token_classify_yy(str, &expect);
+                item.func(str, &info);
+                if (!token_info_equal(&info, &expect)) {
+                    printf("verify %s %s \"%.*s\" [FAIL]\n", item.name,
+                           dataset_arr[d].name, (int)expect.len, str);
+                    suc = false;
+                    break;
+                }
+            }
+            token_doc_release(&doc);
+        }
+        printf("verify classify %s [%s]\n", item.name, suc ? "OK" : "FAIL");
+    }
+
+    /* the type-detecting reader, integers should be exact */
+    {
+        typedef struct {
+            const char *str;
+            number_type type;
+            u64 u; /* expected value of integer (two's complement for i64) */
+            f64 f; /* expected value of double */
+            u32 len;
+        } number_case;
+        static const number_case num_arr[] = {
+            { "0", number_type_u64, 0, 0, 1 },
+            { "-0", number_type_i64, 0, 0, 2 },
+            { "123,", number_type_u64, 123, 0, 3 },
+            { "-123]", number_type_i64, (u64)-123, 0, 4 },
+            { "9007199254740993", number_type_u64, 9007199254740993ULL, 0, 16 },
+            { "-9007199254740993", number_type_i64, (u64)-9007199254740993LL, 0, 17 },
+            { "9223372036854775807", number_type_u64, 9223372036854775807ULL, 0, 19 },
+            { "9223372036854775808", number_type_u64, 9223372036854775808ULL, 0, 19 },
+            { "-9223372036854775808", number_type_i64, 9223372036854775808ULL, 0, 20 },
+            { "-9223372036854775809", number_type_f64, 0, -9223372036854775809.0, 20 },
+            { "18446744073709551615", number_type_u64, UINT64_MAX, 0, 20 },
+            { "18446744073709551616", number_type_f64, 0, 18446744073709551616.0, 20 },
+            { "100000000000000000000", number_type_f64, 0, 1e20, 21 },
+            { "0.5", number_type_f64, 0, 0.5, 3 },
+            { "-1.5 ", number_type_f64, 0, -1.5, 4 },
+            { "1e2", number_type_f64, 0, 100.0, 3 },
+            { "0e5", number_type_f64, 0, 0.0, 3 },
+            { "1.0", number_type_f64, 0, 1.0, 3 },
+            { "12345678901234567890.5", number_type_f64, 0, 12345678901234567890.5, 22 },
+            { "01", number_type_fail, 0, 0, 0 },
+            { "1.", number_type_fail, 0, 0, 0 },
+            { ".5", number_type_fail, 0, 0, 0 },
+            { "-", number_type_fail, 0, 0, 0 },
+            { "+1", number_type_fail, 0, 0, 0 },
+            { "1e", number_type_fail, 0, 0, 0 },
+            { "", number_type_fail, 0, 0, 0 },
+        };
+        bool suc = true;
+        for (usize c = 0; c < sizeof(num_arr) / sizeof(num_arr[0]); c++) {
+            number_case nc = num_arr[c];
+            number_val val;
+            char *end;
+            memset(buf, 0, sizeof(buf));
+            memcpy(buf, nc.str, strlen(nc.str));
+            number_type type = parse_number_yy(buf, TOKEN_LEN_MAX, &end, &val);
+            bool ok = type == nc.type && val.type == nc.type &&
+                      (usize)(end - buf) == nc.len;
+            if (ok && type == number_type_f64) ok = val.v.f == nc.f;
+            else if (ok && type != number_type_fail) ok = val.v.u == nc.u;
+            if (!ok) {
+                printf("verify number \"%s\" [FAIL], return %s len:%d\n",
+                       nc.str, number_type_desc(type), (int)(end - buf));
+                suc = false;
+            }
+        }
+        printf("verify number cases [%s]\n", suc ? "OK" : "FAIL");
+    }
+
+    /* classify then dispatch should match direct parsing, the one pass reader
+       should match dispatch (also for the invalid tokens) */
+    for (int d = 0; d < dataset_num; d++) {
+        token_doc doc;
+        token_val *vals1 = malloc(256 * 1024 * sizeof(token_val));
+        token_val *vals2 = malloc(256 * 1024 * sizeof(token_val));
+        token_val *vals3 = malloc(256 * 1024 * sizeof(token_val));
+        bool suc = vals1 && vals2 && vals3 &&
+                   token_doc_create(&doc, dataset_arr[d], 256 * 1024);
+        bool num_suc = suc;
+        if (suc) {
+            token_run_dispatch(token_classify_yy, &doc, vals1);
+            token_run_direct(NULL, &doc, vals2);
+            token_run_number(NULL, &doc, vals3);
+            for (usize i = 0; i < doc.count && suc; i++) {
+                /* the direct parsers may accept some invalid JSON numbers */
+                if (vals1[i].type == token_type_invalid) continue;
+                if (vals1[i].type != vals2[i].type) suc = false;
+                else if (vals1[i].type != token_type_invalid &&
+                         vals1[i].v.i != vals2[i].v.i) suc = false;
+                if (!suc) {
+                    printf("verify dispatch %s \"%.*s\" [FAIL]\n", dataset_arr[d].name,
+                           16, doc.str + doc.offs[i]);
+                }
+            }
+            for (usize i = 0; i < doc.count && num_suc; i++) {
+                if (vals1[i].type != vals3[i].type) num_suc = false;
+                else if (vals1[i].type != token_type_invalid &&
+                         vals1[i].v.i != vals3[i].v.i) num_suc = false;
+                if (!num_suc) {
+                    printf("verify number %s \"%.*s\" [FAIL]\n", dataset_arr[d].name,
+                           16, doc.str + doc.offs[i]);
+                }
+            }
+            token_doc_release(&doc);
+        }
+        free(vals1);
+        free(vals2);
+        free(vals3);
+        printf("verify dispatch %s [%s]\n", dataset_arr[d].name, suc ? "OK" : "FAIL");
+        printf("verify number %s [%s]\n", dataset_arr[d].name, num_suc ? "OK" : "FAIL");
+    }
+}
+
+
+
+/*----------------------------------------------------------------------------*/
+
+static yy_chart *token_chart_new(const char *title, const char *subtitle) {
+    yy_chart_options op;
+    yy_chart *chart = yy_chart_new();
+    yy_chart_options_init(&op);
+    op.title = title;
+    op.subtitle = subtitle;
+    op.type = YY_CHART_BAR;
+    op.h_axis.title = "average CPU cycles per token";
+    op.plot.value_labels_enabled = true;
+    op.plot.value_labels_decimals = 2;
+    op.plot.color_by_point = true;
+    op.plot.group_padding = 0.0f;
+    op.plot.point_padding = 0.1f;
+    op.plot.border_width = 0.0f;
+    op.legend.enabled = false;
+    op.tooltip.value_decimals = 2;
+    op.width = 640;
+    op.height = 420;
+    yy_chart_set_options(chart, &op);
+    return chart;
+}
+
+/* the checksum of each run, so that the results are not discarded */
+static volatile u64 token_sink;
+
+/** Measure a method, returns the min ticks of the document. */
+static u64 token_measure(token_run_func run, token_func func,
+                         const token_doc *doc, token_val *vals) {
+    static const int measure_count = 16;
+    u64 ticks_min;
+    for (int retry = 0; ; retry++) {
+        ticks_min = UINT64_MAX;
+        for (int r = 0; r < measure_count; r++) {
+            u64 t1 = yy_time_get_ticks();
+            token_sink = run(func, doc, vals);
+            u64 t2 = yy_time_get_ticks();
+            u64 t = t2 - t1;
+            if (t < ticks_min) ticks_min = t;
+        }
+        if (bench_cpu_check_freq(retry)) break;
+    }
+    return ticks_min;
+}
+
+static void token_chart_add(yy_chart *chart, const char *name, u64 ticks, usize count) {
+    f64 cycles = (f64)ticks / (f64)count * bench_cpu_get_cycle_per_tick();
+    yy_chart_item_with_float(chart, name, (f32)cycles);
+}
+
+static void token_func_benchmark_all(const char *output_path) {
+    printf("initialize...\n");
+    bench_cpu_setup();
+
+    yy_report *report = yy_report_new();
+    bench_report_add_env_info(report);
+
+    for (int d = 0; d < dataset_num; d++) {
+        dataset_t dataset = dataset_arr[d];
+        char name[64];
+        printf("run benchmark %s...", dataset.name);
+
+        token_doc doc;
+        token_val *vals = malloc((TOKEN_DOC_SIZE / 2 + 1) * sizeof(token_val));
+        if (!vals || !token_doc_create(&doc, dataset, TOKEN_DOC_SIZE)) {
+            printf("memory allocation failed.\n");
+            free(vals);
+            return;
+        }
+
+        yy_chart *chart = token_chart_new(dataset.name, dataset.desc);
+        for (int f = 0; f < classify_num; f++) {
+            classify_item item = classify_arr[f];
+            u64 ticks = token_measure(token_run_classify, item.func, &doc, vals);
+            snprintf(name, sizeof(name), "%s (classify)", item.name);
+            token_chart_add(chart, name, ticks, doc.count);
+            ticks = token_measure(token_run_dispatch, item.func, &doc, vals);
+            snprintf(name, sizeof(name), "%s (classify + parse)", item.name);
+            token_chart_add(chart, name, ticks, doc.count);
+        }
+        token_chart_add(chart, "atoi then strtod (direct parse)",
+                        token_measure(token_run_direct, NULL, &doc, vals), doc.count);
+        token_chart_add(chart, "parse_number (one pass)",
+                        token_measure(token_run_number, NULL, &doc, vals), doc.count);
+        token_chart_add(chart, "strtod only (int not exact)",
+                        token_measure(token_run_strtod, NULL, &doc, vals), doc.count);
+        yy_chart_sort_items_with_value(chart, false);
+        yy_report_add_chart(report, chart);
+        yy_chart_free(chart);
+
+        token_doc_release(&doc);
+        free(vals);
+        printf("[OK]\n");
+    }
+
+    // export report to html
+    bench_report_add_drift_info(report);
+    bool suc = yy_report_write_html_file(report, output_path);
+    if (!suc) {
+        printf("write report file failed: %s\n", output_path);
+    }
+    yy_report_free(report);
+}
+
+void benchmark(const char *output_path) {
+    token_func_register_all();
+    printf("------[verify]---------\n");
+    token_func_verify_all();
+    printf("------[benchmark]------\n");
+    token_func_benchmark_all(output_path);
+    printf("------[finish]---------\n");
+    return;
+}
@@ -0,0 +1,175 @@
+#ifndef token_h
+#define token_h
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/**
+ Numeric token classification.
+
+ Before parsing, a JSON/CSV reader needs to know whether a token is an integer,
+ a decimal, an exponent form or invalid, and how many digits it has. The token
+ starts at `str` and ends at the first character which is not a digit, '.',
+ 'e', 'E', '+' or '-' (the token boundary). The token is validated with the
+ JSON number grammar: -?(0|[1-9][0-9]*)(\.[0-9]+)?([eE][+-]?[0-9]+)?
+
+ The SIMD classifiers read a 64-byte window, the input should be padded with
+ 64 readable bytes after `str`.
+ */
+
+typedef enum {
+    token_type_invalid = 0, /* not a JSON number: "01", "1.", "+1", "1e" */
+    token_type_int = 1,     /* integer: "-123" */
+    token_type_dec = 2,     /* decimal: "-1.23" */
+    token_type_exp = 3,     /* exponent form: "1.23e-4", "1E5" */
+} token_type;
+
+typedef struct {
+    token_type type;
+    uint32_t len;       /* token length, also for the invalid token */
+    uint32_t digits;    /* digit count of the significand (0 if invalid) */
+    int32_t dot;        /* position of '.', -1 if none (or invalid) */
+    int32_t exp;        /* position of 'e' or 'E', -1 if none (or invalid) */
+} token_info;
+
+/** Classify a token, returns the token type. */
+typedef token_type (*token_func)(const char *str, token_info *info);
+
+static inline const char *token_type_desc(token_type type) {
+    switch (type) {
+        case token_type_invalid: return "invalid";
+        case token_type_int: return "int";
+        case token_type_dec: return "dec";
+        case token_type_exp: return "exp";
+        default: return "unknown";
+    }
+}
+
+
+
+/*----------------------------------------------------------------------------*/
+/**
+ Type-detecting number reader (JSON number semantics).
+
+ Reads a number in one pass and returns the type of the value: an integer is
+ read exactly as uint64 (non-negative) or int64 (negative), a number with a
+ fraction or exponent, or an integer out of the range, is read as double.
+ "-0" is read as int64 0. The `len` is an upper bound as `strtod_yy_fast()`,
+ the number ends at the first character which is not part of it, `end` is set
+ to that position, or to `str` if the input is not a valid number.
+ */
+
+typedef enum {
+    number_type_fail = 0,
+    number_type_u64 = 1,
+    number_type_i64 = 2,
+    number_type_f64 = 3,
+} number_type;
+
+typedef struct {
+    number_type type;
+    union {
+        uint64_t u;
+        int64_t i;
+        double f;
+    } v;
+} number_val;
+
+typedef number_type (*number_func)(const char *str, size_t len, char **end, number_val *val);
+
+static inline const char *number_type_desc(number_type type) {
+    switch (type) {
+        case number_type_fail: return "fail";
+        case number_type_u64: return "u64";
+        case number_type_i64: return "i64";
+        case number_type_f64: return "f64";
+        default: return "unknown";
+    }
+}
+
+
+
+/*----------------------------------------------------------------------------*/
+/**
+ Character masks of a 64-byte window (bit i for byte i), one mask for each
+ digit type of the `digi_table` in atoi_yy.c and strtod_yy_fast.c, so that
+ the table lookups of a whole window are done with a few SIMD compares.
+ */
+typedef struct {
+    uint64_t zero;      /* DIGI_TYPE_ZERO: '0' */
+    uint64_t nonzero;   /* DIGI_TYPE_NONZERO: [1-9] */
+    uint64_t pos;       /* DIGI_TYPE_POS: '+' */
+    uint64_t neg;       /* DIGI_TYPE_NEG: '-' */
+    uint64_t dot;       /* DIGI_TYPE_DOT: '.' */
+    uint64_t exp;       /* DIGI_TYPE_EXP: 'e', 'E' */
+} token_masks;
+
+static inline uint32_t token_u64_ctz(uint64_t v) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (uint32_t)__builtin_ctzll(v);
+#else
+    uint32_t n = 0;
+    while (!(v & 1)) { v >>= 1; n++; }
+    return n;
+#endif
+}
+
+static inline uint32_t token_u64_popcnt(uint64_t v) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (uint32_t)__builtin_popcountll(v);
+#else
+    v = v - ((v >> 1) & 0x5555555555555555ULL);
+    v = (v & 0x3333333333333333ULL) + ((v >> 2) & 0x3333333333333333ULL);
+    v = (v + (v >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return (uint32_t)((v * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+/**
+ Classify a token with the masks of its window, all the grammar rules are
+ checked with bit operations, without a branch for each character.
+ Returns false if the token is not terminated in the window (64 bytes or more).
+ */
+static inline bool token_info_from_masks(const token_masks *m, token_info *info) {
+    uint64_t digit = m->zero | m->nonzero;
+    uint64_t sign = m->pos | m->neg;
+    uint64_t num = digit | sign | m->dot | m->exp;
+    if (num == ~(uint64_t)0) return false;
+
+    uint32_t len = token_u64_ctz(~num);
+    uint64_t in = ((uint64_t)1 << len) - 1;
+    uint64_t dot = m->dot & in, exp = m->exp & in;
+    uint64_t lead = m->neg & 1; /* '-' at the start */
+    uint64_t first = (uint64_t)1 << lead; /* the first digit */
+    uint64_t exp_sign = sign & (exp << 1);
+    uint64_t bad = 0;
+    digit &= in;
+    sign &= in;
+
+    bad |= first & ~digit;                          /* no digit: "-", ".5" */
+    bad |= (m->zero & first) && (digit & (first << 1)); /* leading zero: "01" */
+    bad |= (dot & (dot - 1)) | (exp & (exp - 1));   /* two '.' or 'e' */
+    bad |= sign & ~(lead | exp_sign);               /* sign in other place */
+    bad |= dot & ~((digit << 1) & (digit >> 1));    /* digits around '.' */
+    bad |= exp & ~(digit << 1);                     /* digit before 'e' */
+    bad |= exp & ~((digit | exp_sign) >> 1);        /* digit or sign after 'e' */
+    bad |= exp_sign & ~(digit >> 1);                /* digit after sign */
+    bad |= exp && dot > exp;                        /* '.' after 'e' */
+
+    info->len = len;
+    if (bad) {
+        info->type = token_type_invalid;
+        info->digits = 0;
+        info->dot = -1;
+        info->exp = -1;
+        return true;
+    }
+    info->type = exp ? token_type_exp : (dot ? token_type_dec : token_type_int);
+    info->digits = token_u64_popcnt(digit & (exp ? exp - 1 : in));
+    info->dot = dot ? (int32_t)token_u64_ctz(dot) : -1;
+    info->exp = exp ? (int32_t)token_u64_ctz(exp) : -1;
+    return true;
+}
+
+#endif /* token_h */
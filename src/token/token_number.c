@@ -0,0 +1,487 @@
+/*
+ Type-detecting number reader based on atoi_yy.c and strtod_yy_fast.c, returns
+ uint64, int64 or double in one pass.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <limits.h>
+#include <float.h>
+#include <math.h>
+
+#include "token.h"
+
+/* compiler builtin check (clang) */
+#ifndef has_builtin
+#   ifdef __has_builtin
+#       define has_builtin(x) __has_builtin(x)
+#   else
+#       define has_builtin(x) 0
+#   endif
+#endif
+
+/* compiler attribute check (gcc/clang) */
+#ifndef yy_has_attribute
+#   ifdef __has_attribute
+#       define yy_has_attribute(x) __has_attribute(x)
+#   else
+#       define yy_has_attribute(x) 0
+#   endif
+#endif
+
+/* inline */
+#ifndef always_inline
+#   if _MSC_VER >= 1200
+#       define always_inline __forceinline
+#   elif defined(_MSC_VER)
+#       define always_inline __inline
+#   elif yy_has_attribute(always_inline) || __GNUC__ >= 4
+#       define always_inline __inline__ __attribute__((always_inline))
+#   elif defined(__clang__) || defined(__GNUC__)
+#       define always_inline __inline__
+#   elif defined(__cplusplus) || (__STDC__ >= 1 && __STDC_VERSION__ >= 199901L)
+#       define always_inline inline
+#   else
+#       define always_inline
+#   endif
+#endif
+
+#define static_inline static always_inline
+
+/* likely */
+#ifndef likely
+#   if has_builtin(__builtin_expect) || __GNUC__ >= 4
+#       define likely(expr) __builtin_expect(!!(expr), 1)
+#   else
+#       define likely(expr) (expr)
+#   endif
+#endif
+
+/* unlikely */
+#ifndef unlikely
+#   if has_builtin(__builtin_expect) || __GNUC__ >= 4
+#       define unlikely(expr) __builtin_expect(!!(expr), 0)
+#   else
+#       define unlikely(expr) (expr)
+#   endif
+#endif
+
+
+#define repeat_in_1_18(x) { x(1) x(2) x(3) x(4) x(5) x(6) x(7) \
+                            x(8) x(9) x(10) x(11) x(12) x(13) x(14) x(15) \
+                            x(16) x(17) x(18) }
+
+
+/** Type define for primitive types. */
+typedef float       f32;
+typedef double      f64;
+typedef int8_t      i8;
+typedef uint8_t     u8;
+typedef int16_t     i16;
+typedef uint16_t    u16;
+typedef int32_t     i32;
+typedef uint32_t    u32;
+typedef int64_t     i64;
+typedef uint64_t    u64;
+typedef size_t      usize;
+
+
+
+/*==============================================================================
+ * Integer Constants
+ *============================================================================*/
+
+/* Used to write u64 literal for C89 which doesn't support "ULL" suffix. */
+#undef  U64
+#define U64(hi, lo) ((((u64)hi##UL) << 32U) + lo##UL)
+
+/* U64 constant values */
+#undef  U64_MAX
+#define U64_MAX         U64(0xFFFFFFFF, 0xFFFFFFFF)
+#undef  I64_MAX
+#define I64_MAX         U64(0x7FFFFFFF, 0xFFFFFFFF)
+#undef  USIZE_MAX
+#define USIZE_MAX       ((usize)(~(usize)0))
+
+/* Maximum number of digits for reading u64 safety. */
+#undef  U64_SAFE_DIG
+#define U64_SAFE_DIG    19
+
+/* maximum decimal power of normal number (1.7976931348623157e308) */
+#define F64_MAX_DEC_EXP 308
+
+/* minimum decimal power of normal number (4.9406564584124654e-324) */
+#define F64_MIN_DEC_EXP (-324)
+
+
+
+/*==============================================================================
+ * JSON Number Reader (IEEE-754)
+ *============================================================================*/
+
+/** Maximum pow10 exponent cached (same as F64_MAX_DEC_EXP). */
+#define F64_POW10_EXP_MAX 308
+
+/** Cached pow10 table (size: 2.4KB) (generate with misc/make_tables.c). */
+static const f64 f64_pow10_table[F64_POW10_EXP_MAX + 1] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9,
+    1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19,
+    1e20, 1e21, 1e22, 1e23, 1e24, 1e25, 1e26, 1e27, 1e28, 1e29,
+    1e30, 1e31, 1e32, 1e33, 1e34, 1e35, 1e36, 1e37, 1e38, 1e39,
+    1e40, 1e41, 1e42, 1e43, 1e44, 1e45, 1e46, 1e47, 1e48, 1e49,
+    1e50, 1e51, 1e52, 1e53, 1e54, 1e55, 1e56, 1e57, 1e58, 1e59,
+    1e60, 1e61, 1e62, 1e63, 1e64, 1e65, 1e66, 1e67, 1e68, 1e69,
+    1e70, 1e71, 1e72, 1e73, 1e74, 1e75, 1e76, 1e77, 1e78, 1e79,
+    1e80, 1e81, 1e82, 1e83, 1e84, 1e85, 1e86, 1e87, 1e88, 1e89,
+    1e90, 1e91, 1e92, 1e93, 1e94, 1e95, 1e96, 1e97, 1e98, 1e99,
+    1e100, 1e101, 1e102, 1e103, 1e104, 1e105, 1e106, 1e107, 1e108, 1e109,
+    1e110, 1e111, 1e112, 1e113, 1e114, 1e115, 1e116, 1e117, 1e118, 1e119,
+    1e120, 1e121, 1e122, 1e123, 1e124, 1e125, 1e126, 1e127, 1e128, 1e129,
+    1e130, 1e131, 1e132, 1e133, 1e134, 1e135, 1e136, 1e137, 1e138, 1e139,
+    1e140, 1e141, 1e142, 1e143, 1e144, 1e145, 1e146, 1e147, 1e148, 1e149,
+    1e150, 1e151, 1e152, 1e153, 1e154, 1e155, 1e156, 1e157, 1e158, 1e159,
+    1e160, 1e161, 1e162, 1e163, 1e164, 1e165, 1e166, 1e167, 1e168, 1e169,
+    1e170, 1e171, 1e172, 1e173, 1e174, 1e175, 1e176, 1e177, 1e178, 1e179,
+    1e180, 1e181, 1e182, 1e183, 1e184, 1e185, 1e186, 1e187, 1e188, 1e189,
+    1e190, 1e191, 1e192, 1e193, 1e194, 1e195, 1e196, 1e197, 1e198, 1e199,
+    1e200, 1e201, 1e202, 1e203, 1e204, 1e205, 1e206, 1e207, 1e208, 1e209,
+    1e210, 1e211, 1e212, 1e213, 1e214, 1e215, 1e216, 1e217, 1e218, 1e219,
+    1e220, 1e221, 1e222, 1e223, 1e224, 1e225, 1e226, 1e227, 1e228, 1e229,
+    1e230, 1e231, 1e232, 1e233, 1e234, 1e235, 1e236, 1e237, 1e238, 1e239,
+    1e240, 1e241, 1e242, 1e243, 1e244, 1e245, 1e246, 1e247, 1e248, 1e249,
+    1e250, 1e251, 1e252, 1e253, 1e254, 1e255, 1e256, 1e257, 1e258, 1e259,
+    1e260, 1e261, 1e262, 1e263, 1e264, 1e265, 1e266, 1e267, 1e268, 1e269,
+    1e270, 1e271, 1e272, 1e273, 1e274, 1e275, 1e276, 1e277, 1e278, 1e279,
+    1e280, 1e281, 1e282, 1e283, 1e284, 1e285, 1e286, 1e287, 1e288, 1e289,
+    1e290, 1e291, 1e292, 1e293, 1e294, 1e295, 1e296, 1e297, 1e298, 1e299,
+    1e300, 1e301, 1e302, 1e303, 1e304, 1e305, 1e306, 1e307, 1e308
+};
+
+
+
+/*==============================================================================
+ * Digit Character Matcher
+ *============================================================================*/
+
+/** Digit type */
+typedef u8 digi_type;
+
+/** Digit: '0'. */
+static const digi_type DIGI_TYPE_ZERO       = 1 << 0;
+
+/** Digit: [1-9]. */
+static const digi_type DIGI_TYPE_NONZERO    = 1 << 1;
+
+/** Plus sign (positive): '+'. */
+static const digi_type DIGI_TYPE_POS        = 1 << 2;
+
+/** Minus sign (negative): '-'. */
+static const digi_type DIGI_TYPE_NEG        = 1 << 3;
+
+/** Decimal point: '.' */
+static const digi_type DIGI_TYPE_DOT        = 1 << 4;
+
+/** Exponent sign: 'e, 'E'. */
+static const digi_type DIGI_TYPE_EXP        = 1 << 5;
+
+/** Digit type table (generate with misc/make_tables.c) */
+static const digi_type digi_table[256] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0x10, 0x00,
+    0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+/** Match a character with specified type. */
+static_inline bool digi_is_type(u8 d, digi_type type) {
+    return (digi_table[d] & type) != 0;
+}
+
+/** Match a sign: '+', '-' */
+static_inline bool digi_is_sign(u8 d) {
+    return digi_is_type(d, DIGI_TYPE_POS | DIGI_TYPE_NEG);
+}
+
+/** Match a none zero digit: [1-9] */
+static_inline bool digi_is_nonzero(u8 d) {
+    return digi_is_type(d, DIGI_TYPE_NONZERO);
+}
+
+/** Match a digit: [0-9] */
+static_inline bool digi_is_digit(u8 d) {
+    return digi_is_type(d, DIGI_TYPE_ZERO | DIGI_TYPE_NONZERO);
+}
+
+/** Match an exponent sign: 'e', 'E'. */
+static_inline bool digi_is_exp(u8 d) {
+    return digi_is_type(d, DIGI_TYPE_EXP);
+}
+
+/** Match a floating point indicator: '.', 'e', 'E'. */
+static_inline bool digi_is_fp(u8 d) {
+    return digi_is_type(d, DIGI_TYPE_DOT | DIGI_TYPE_EXP);
+}
+
+/** Match a digit or floating point indicator: [0-9], '.', 'e', 'E'. */
+static_inline bool digi_is_digit_or_fp(u8 d) {
+    return digi_is_type(d, DIGI_TYPE_ZERO | DIGI_TYPE_NONZERO |
+                           DIGI_TYPE_DOT | DIGI_TYPE_EXP);
+}
+
+
+
+
+
+
+/*==============================================================================
+ * Number Reader
+ *============================================================================*/
+
+/*
+ The same as `strtod_yy_fast()`, but an integer is returned as uint64 or int64
+ where `strtod_yy_fast()` converts the significand to double, so the integer
+ part is read only once for both integers and real numbers.
+ */
+number_type parse_number_yy(const char *str, size_t len, char **end,
+                            number_val *val) {
+    
+#define return_err() do { \
+    *end = (char *)str; \
+    val->type = number_type_fail; \
+    return number_type_fail; \
+} while(false)
+    
+#define return_f64(_v) do { \
+    *end = (char *)cur; \
+    val->type = number_type_f64; \
+    val->v.f = sign ? -(f64)(_v) : (f64)(_v); \
+    return number_type_f64; \
+} while(false)
+    
+#define return_int(_v) do { \
+    *end = (char *)cur; \
+    if (likely(!sign)) { \
+        val->type = number_type_u64; \
+        val->v.u = (u64)(_v); \
+        return number_type_u64; \
+    } \
+    if (likely((u64)(_v) <= I64_MAX + 1)) { \
+        val->type = number_type_i64; \
+        val->v.i = (i64)((u64)0 - (u64)(_v)); \
+        return number_type_i64; \
+    } \
+    return_f64(_v); /* less than INT64_MIN */ \
+} while(false)
+    
+    const u8 *sig_cut = NULL; /* significant part cutting position for long number */
+    const u8 *dot_pos = NULL; /* decimal point position */
+    
+    u64 sig = 0; /* significant part of the number */
+    i32 exp = 0; /* exponent part of the number */
+    
+    bool exp_sign = false; /* temporary exponent sign from literal part */
+    i64 exp_sig = 0; /* temporary exponent number from significant part */
+    i64 exp_lit = 0; /* temporary exponent number from exponent literal part */
+    u64 num; /* temporary number for reading */
+    const u8 *tmp; /* temporary cursor for reading */
+    
+    const u8 *cur = (const u8 *)str;
+    const u8 *hdr = cur;
+    bool sign = (*hdr == '-');
+    (void)len;
+    cur += sign;
+    
+    if (unlikely(!digi_is_nonzero(*cur))) { /* 0 or non-digit char */
+        if (unlikely(*cur != '0')) return_err();
+        /* begin with 0 */
+        if (likely(!digi_is_digit_or_fp(*++cur))) {
+            /* "0" is uint64, "-0" is int64 */
+            *end = (char *)cur;
+            val->type = sign ? number_type_i64 : number_type_u64;
+            val->v.u = 0;
+            return val->type;
+        }
+        if (likely(*cur == '.')) {
+            dot_pos = cur++;
+            if (unlikely(!digi_is_digit(*cur))) return_err();
+            while (unlikely(*cur == '0')) cur++;
+            if (likely(digi_is_digit(*cur))) {
+                /* first non-zero digit after decimal point */
+                sig = (u64)(*cur - '0'); /* read first digit */
+                cur--;
+                goto digi_frac_1; /* continue read fraction part */
+            }
+        }
+        if (unlikely(digi_is_digit(*cur))) return_err();
+        if (unlikely(digi_is_exp(*cur))) { /* 0 with any exponent is still 0 */
+            cur += (usize)1 + digi_is_sign(cur[1]);
+            if (unlikely(!digi_is_digit(*cur))) return_err();
+            while (digi_is_digit(*++cur));
+        }
+        return_f64(0);
+    }
+    
+    /* begin with non-zero digit,  */
+    sig = (u64)(*cur - '0');
+    
+    /* read integral part, see `strtod_yy_fast()` */
+#define expr_intg(i) \
+    if (likely((num = (u64)(cur[i] - (u8)'0')) <= 9)) sig = num + sig * 10; \
+    else { goto digi_sepr_##i; }
+    repeat_in_1_18(expr_intg);
+#undef expr_intg
+    
+    cur += 19; /* skip continuous 19 digits */
+    if (!digi_is_digit_or_fp(*cur)) return_int(sig);
+    goto digi_intg_more; /* read more digits in integral part */
+    
+    /* process first non-digit character, an integer is returned here */
+#define expr_sepr(i) \
+    digi_sepr_##i: \
+    if (likely(!digi_is_fp(cur[i]))) { cur += i; return_int(sig); } \
+    dot_pos = cur + i; \
+    if (likely(cur[i] == '.')) goto digi_frac_##i; \
+    cur += i; goto digi_exp_more;
+    repeat_in_1_18(expr_sepr)
+#undef expr_sepr
+    
+    /* read fraction part */
+#define expr_frac(i) \
+    digi_frac_##i: \
+    if (likely((num = (u64)(cur[i + 1] - (u8)'0')) <= 9)) \
+        sig = num + sig * 10; \
+    else { goto digi_stop_##i; }
+    repeat_in_1_18(expr_frac)
+#undef expr_frac
+    
+    cur += 20; /* skip 19 digits and 1 decimal point */
+    if (!digi_is_digit(*cur)) goto digi_frac_end; /* fraction part end */
+    goto digi_frac_more; /* read more digits in fraction part */
+    
+    /* significant part end */
+#define expr_stop(i) \
+    digi_stop_##i: \
+    cur += i + 1; \
+    goto digi_frac_end;
+    repeat_in_1_18(expr_stop)
+#undef expr_stop
+    
+digi_intg_more: /* read more digits in integral part */
+    if (digi_is_digit(*cur)) {
+        if (!digi_is_digit_or_fp(cur[1])) {
+            /* this number is an integer with 20 digits */
+            num = (u64)(*cur - '0');
+            if ((sig < (U64_MAX / 10)) ||
+                (sig == (U64_MAX / 10) && num <= (U64_MAX % 10))) {
+                sig = num + sig * 10;
+                cur++;
+                return_int(sig);
+            }
+        }
+    }
+    
+    /* the integer is out of uint64 range, read as double */
+    if (digi_is_exp(*cur)) {
+        dot_pos = cur;
+        goto digi_exp_more;
+    }
+    
+    if (*cur == '.') {
+        dot_pos = cur++;
+        if (!digi_is_digit(*cur)) return_err();
+    }
+    
+digi_frac_more: /* read more digits in fraction part */
+    sig_cut = cur; /* too large to fit in u64, excess digits need to be cut */
+    sig += (*cur >= '5'); /* round */
+    while (digi_is_digit(*++cur));
+    if (!dot_pos) {
+        dot_pos = cur;
+        if (*cur == '.') {
+            if (!digi_is_digit(*++cur)) return_err();
+            while (digi_is_digit(*cur)) cur++;
+        }
+    }
+    exp_sig = (i64)(dot_pos - sig_cut);
+    exp_sig += (dot_pos < sig_cut);
+    
+    if (digi_is_exp(*cur)) goto digi_exp_more;
+    goto digi_exp_finish;
+    
+digi_frac_end: /* fraction part end */
+    if (unlikely(dot_pos + 1 == cur)) return_err();
+    exp_sig = -(i64)((u64)(cur - dot_pos) - 1);
+    if (likely(!digi_is_exp(*cur))) {
+        if (unlikely(exp_sig < F64_MIN_DEC_EXP - 19)) {
+            return_f64(0); /* underflow */
+        }
+        exp = (i32)exp_sig;
+        goto digi_finish;
+    } else {
+        goto digi_exp_more;
+    }
+    
+digi_exp_more: /* read exponent part */
+    exp_sign = (*++cur == '-');
+    cur += digi_is_sign(*cur);
+    if (unlikely(!digi_is_digit(*cur))) return_err();
+    while (*cur == '0') cur++;
+    
+    /* read exponent literal */
+    tmp = cur;
+    while (digi_is_digit(*cur)) {
+        exp_lit = (*cur++ - '0') + (u64)exp_lit * 10;
+    }
+    if (unlikely(cur - tmp >= U64_SAFE_DIG)) {
+        if (exp_sign) {
+            return_f64(0); /* underflow */
+        } else {
+            return_f64(INFINITY); /* overflow */
+        }
+    }
+    exp_sig += exp_sign ? -exp_lit : exp_lit;
+    
+digi_exp_finish: /* validate exponent value */
+    if (unlikely(exp_sig < F64_MIN_DEC_EXP - 19)) {
+        return_f64(0); /* underflow */
+    }
+    if (unlikely(exp_sig > F64_MAX_DEC_EXP)) {
+        return_f64(INFINITY); /* overflow */
+    }
+    exp = (i32)exp_sig;
+    
+digi_finish: /* all digit read finished */
+    
+    /* Fast return (0-2 ulp error) */
+    {
+        f64 ret = (f64)sig;
+        if (likely(exp >= -F64_POW10_EXP_MAX)) {
+            if (likely(exp < 0)) {
+                ret = ret / f64_pow10_table[-exp];
+            } else {
+                ret = ret * f64_pow10_table[exp];
+            }
+        } else {
+            ret = ret / f64_pow10_table[F64_MAX_DEC_EXP];
+            ret = ret / f64_pow10_table[-(exp + F64_MAX_DEC_EXP)];
+        }
+        return_f64(ret);
+    }
+    
+#undef return_err
+#undef return_f64
+#undef return_int
+}
@@ -0,0 +1,251 @@
+/*
+ SIMD numeric token classifiers: the 64-byte window of a token is converted to
+ character masks (see `token_masks` in token.h), then the token is classified
+ with bit operations. The kernels are compiled with function target attributes
+ and selected at runtime, tokens of 64 bytes or more fall back to the scalar
+ classifier.
+ 
+ SSE4.2: 16-byte blocks, PCMPISTRM range compare for the digits.
+ AVX2: 32-byte blocks, unsigned min compare for the digits.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "token.h"
+
+/* compiler builtin check (clang) */
+#ifndef yy_has_builtin
+#   ifdef __has_builtin
+#       define yy_has_builtin(x) __has_builtin(x)
+#   else
+#       define yy_has_builtin(x) 0
+#   endif
+#endif
+
+/* compiler attribute check (gcc/clang) */
+#ifndef yy_has_attribute
+#   ifdef __has_attribute
+#       define yy_has_attribute(x) __has_attribute(x)
+#   else
+#       define yy_has_attribute(x) 0
+#   endif
+#endif
+
+/* inline */
+#ifndef yy_inline
+#   if _MSC_VER >= 1200
+#       define yy_inline __forceinline
+#   elif defined(_MSC_VER)
+#       define yy_inline __inline
+#   elif yy_has_attribute(always_inline) || __GNUC__ >= 4
+#       define yy_inline __inline__ __attribute__((always_inline))
+#   elif defined(__clang__) || defined(__GNUC__)
+#       define yy_inline __inline__
+#   elif defined(__cplusplus) || (__STDC__ >= 1 && __STDC_VERSION__ >= 199901L)
+#       define yy_inline inline
+#   else
+#       define yy_inline
+#   endif
+#endif
+
+/* likely */
+#ifndef yy_likely
+#   if yy_has_builtin(__builtin_expect) || __GNUC__ >= 4
+#       define yy_likely(expr) __builtin_expect(!!(expr), 1)
+#   else
+#       define yy_likely(expr) (expr)
+#   endif
+#endif
+
+/* unlikely */
+#ifndef yy_unlikely
+#   if yy_has_builtin(__builtin_expect) || __GNUC__ >= 4
+#       define yy_unlikely(expr) __builtin_expect(!!(expr), 0)
+#   else
+#       define yy_unlikely(expr) (expr)
+#   endif
+#endif
+
+
+/* x86 SIMD kernels */
+#ifndef TOKEN_SIMD_X86
+#   if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#       define TOKEN_SIMD_X86 1
+#   else
+#       define TOKEN_SIMD_X86 0
+#   endif
+#endif
+
+#if TOKEN_SIMD_X86
+#   if defined(_MSC_VER)
+#       include <intrin.h>
+#   endif
+#   include <immintrin.h>
+#   include <nmmintrin.h>
+#endif
+
+/* target attribute (MSVC can use the intrinsics without compiler flags) */
+#if TOKEN_SIMD_X86 && (defined(__GNUC__) || defined(__clang__))
+#   define yy_target(x) __attribute__((target(x)))
+#else
+#   define yy_target(x)
+#endif
+
+extern token_type token_classify_yy(const char *str, token_info *info);
+
+
+
+/*==============================================================================
+ * CPU Features
+ *============================================================================*/
+
+#if TOKEN_SIMD_X86 && defined(_MSC_VER)
+static bool token_cpu_has(int leaf, int reg, int bit) {
+    int info[4];
+    __cpuidex(info, leaf, 0);
+    return (info[reg] >> bit) & 1;
+}
+#endif
+
+bool token_simd_has_sse42(void) {
+#if TOKEN_SIMD_X86 && (defined(__GNUC__) || defined(__clang__))
+    return __builtin_cpu_supports("sse4.2");
+#elif TOKEN_SIMD_X86 && defined(_MSC_VER)
+    return token_cpu_has(1, 2, 20);
+#else
+    return false;
+#endif
+}
+
+bool token_simd_has_avx2(void) {
+#if TOKEN_SIMD_X86 && (defined(__GNUC__) || defined(__clang__))
+    return __builtin_cpu_supports("avx2");
+#elif TOKEN_SIMD_X86 && defined(_MSC_VER)
+    /* OSXSAVE and the OS saves YMM registers */
+    if (!token_cpu_has(1, 2, 27) || (_xgetbv(0) & 6) != 6) return false;
+    return token_cpu_has(7, 1, 5);
+#else
+    return false;
+#endif
+}
+
+
+
+/*==============================================================================
+ * SSE4.2
+ *============================================================================*/
+
+#if TOKEN_SIMD_X86
+
+yy_target("sse4.2")
+static yy_inline void token_masks_sse42(const char *str, token_masks *m) {
+    const __m128i range = _mm_setr_epi8('0', '9', 0, 0, 0, 0, 0, 0,
+                                        0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i c_zero = _mm_set1_epi8('0');
+    const __m128i c_pos = _mm_set1_epi8('+');
+    const __m128i c_neg = _mm_set1_epi8('-');
+    const __m128i c_dot = _mm_set1_epi8('.');
+    const __m128i c_exp = _mm_set1_epi8('e');
+    const __m128i c_low = _mm_set1_epi8(0x20);
+    memset(m, 0, sizeof(token_masks));
+    for (int i = 0; i < 4; i++) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(const void *)(str + i * 16));
+        /* the range compare stops at '\0', it's a token boundary anyway */
+        __m128i d = _mm_cmpistrm(range, v, _SIDD_UBYTE_OPS | _SIDD_CMP_RANGES |
+                                 _SIDD_UNIT_MASK);
+        uint64_t digit = (uint32_t)_mm_movemask_epi8(d);
+        uint64_t zero = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(v, c_zero));
+        uint64_t pos = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(v, c_pos));
+        uint64_t neg = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(v, c_neg));
+        uint64_t dot = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(v, c_dot));
+        uint64_t exp = (uint32_t)_mm_movemask_epi8(
+            _mm_cmpeq_epi8(_mm_or_si128(v, c_low), c_exp));
+        m->zero |= zero << (i * 16);
+        m->nonzero |= (digit & ~zero) << (i * 16);
+        m->pos |= pos << (i * 16);
+        m->neg |= neg << (i * 16);
+        m->dot |= dot << (i * 16);
+        m->exp |= exp << (i * 16);
+        /* the token boundary is in this block */
+        if ((digit | pos | neg | dot | exp) != 0xFFFF) break;
+    }
+}
+
+yy_target("sse4.2")
+token_type token_classify_sse42(const char *str, token_info *info) {
+    token_masks m;
+    token_masks_sse42(str, &m);
+    if (yy_unlikely(!token_info_from_masks(&m, info))) {
+        return token_classify_yy(str, info);
+    }
+    return info->type;
+}
+
+#else
+
+token_type token_classify_sse42(const char *str, token_info *info) {
+    return token_classify_yy(str, info);
+}
+
+#endif
+
+
+
+/*==============================================================================
+ * AVX2
+ *============================================================================*/
+
+#if TOKEN_SIMD_X86
+
+yy_target("avx2")
+static yy_inline void token_masks_avx2(const char *str, token_masks *m) {
+    const __m256i c_zero = _mm256_set1_epi8('0');
+    const __m256i c_nine = _mm256_set1_epi8(9);
+    const __m256i c_pos = _mm256_set1_epi8('+');
+    const __m256i c_neg = _mm256_set1_epi8('-');
+    const __m256i c_dot = _mm256_set1_epi8('.');
+    const __m256i c_exp = _mm256_set1_epi8('e');
+    const __m256i c_low = _mm256_set1_epi8(0x20);
+    memset(m, 0, sizeof(token_masks));
+    for (int i = 0; i < 2; i++) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(const void *)(str + i * 32));
+        /* (c - '0') <= 9 (unsigned) */
+        __m256i n = _mm256_sub_epi8(v, c_zero);
+        __m256i d = _mm256_cmpeq_epi8(_mm256_min_epu8(n, c_nine), n);
+        uint64_t digit = (uint32_t)_mm256_movemask_epi8(d);
+        uint64_t zero = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, c_zero));
+        uint64_t pos = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, c_pos));
+        uint64_t neg = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, c_neg));
+        uint64_t dot = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, c_dot));
+        uint64_t exp = (uint32_t)_mm256_movemask_epi8(
+            _mm256_cmpeq_epi8(_mm256_or_si256(v, c_low), c_exp));
+        m->zero |= zero << (i * 32);
+        m->nonzero |= (digit & ~zero) << (i * 32);
+        m->pos |= pos << (i * 32);
+        m->neg |= neg << (i * 32);
+        m->dot |= dot << (i * 32);
+        m->exp |= exp << (i * 32);
+        /* the token boundary is in this block */
+        if ((digit | pos | neg | dot | exp) != 0xFFFFFFFF) break;
+    }
+}
+
+yy_target("avx2")
+token_type token_classify_avx2(const char *str, token_info *info) {
+    token_masks m;
+    token_masks_avx2(str, &m);
+    if (yy_unlikely(!token_info_from_masks(&m, info))) {
+        return token_classify_yy(str, info);
+    }
+    return info->type;
+}
+
+#else
+
+token_type token_classify_avx2(const char *str, token_info *info) {
+    return token_classify_yy(str, info);
+}
+
+#endif
@@ -0,0 +1,190 @@
+/*
+ Scalar numeric token classifier with the `digi_table` of atoi_yy.c and
+ strtod_yy_fast.c, one table lookup for each character.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "token.h"
+
+/* compiler builtin check (clang) */
+#ifndef yy_has_builtin
+#   ifdef __has_builtin
+#       define yy_has_builtin(x) __has_builtin(x)
+#   else
+#       define yy_has_builtin(x) 0
+#   endif
+#endif
+
+/* compiler attribute check (gcc/clang) */
+#ifndef yy_has_attribute
+#   ifdef __has_attribute
+#       define yy_has_attribute(x) __has_attribute(x)
+#   else
+#       define yy_has_attribute(x) 0
+#   endif
+#endif
+
+/* inline */
+#ifndef yy_inline
+#   if _MSC_VER >= 1200
+#       define yy_inline __forceinline
+#   elif defined(_MSC_VER)
+#       define yy_inline __inline
+#   elif yy_has_attribute(always_inline) || __GNUC__ >= 4
+#       define yy_inline __inline__ __attribute__((always_inline))
+#   elif defined(__clang__) || defined(__GNUC__)
+#       define yy_inline __inline__
+#   elif defined(__cplusplus) || (__STDC__ >= 1 && __STDC_VERSION__ >= 199901L)
+#       define yy_inline inline
+#   else
+#       define yy_inline
+#   endif
+#endif
+
+/* likely */
+#ifndef yy_likely
+#   if yy_has_builtin(__builtin_expect) || __GNUC__ >= 4
+#       define yy_likely(expr) __builtin_expect(!!(expr), 1)
+#   else
+#       define yy_likely(expr) (expr)
+#   endif
+#endif
+
+/* unlikely */
+#ifndef yy_unlikely
+#   if yy_has_builtin(__builtin_expect) || __GNUC__ >= 4
+#       define yy_unlikely(expr) __builtin_expect(!!(expr), 0)
+#   else
+#       define yy_unlikely(expr) (expr)
+#   endif
+#endif
+
+
+/** Digit type */
+typedef uint8_t digi_type;
+
+/** Digit: '0'. */
+static const digi_type DIGI_TYPE_ZERO       = 1 << 0;
+
+/** Digit: [1-9]. */
+static const digi_type DIGI_TYPE_NONZERO    = 1 << 1;
+
+/** Plus sign (positive): '+'. */
+static const digi_type DIGI_TYPE_POS        = 1 << 2;
+
+/** Minus sign (negative): '-'. */
+static const digi_type DIGI_TYPE_NEG        = 1 << 3;
+
+/** Decimal point: '.' */
+static const digi_type DIGI_TYPE_DOT        = 1 << 4;
+
+/** Exponent sign: 'e, 'E'. */
+static const digi_type DIGI_TYPE_EXP        = 1 << 5;
+
+/** Digit type table (generate with misc/make_tables.c) */
+static const digi_type digi_table[256] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0x10, 0x00,
+    0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+/** Match a character with specified type. */
+static yy_inline bool digi_is_type(uint8_t d, digi_type type) {
+    return (digi_table[d] & type) != 0;
+}
+
+/** Match a sign: '+', '-' */
+static yy_inline bool digi_is_sign(uint8_t d) {
+    return digi_is_type(d, DIGI_TYPE_POS | DIGI_TYPE_NEG);
+}
+
+/** Match a digit: [0-9] */
+static yy_inline bool digi_is_digit(uint8_t d) {
+    return digi_is_type(d, DIGI_TYPE_ZERO | DIGI_TYPE_NONZERO);
+}
+
+/** Match a decimal point: '.' */
+static yy_inline bool digi_is_dot(uint8_t d) {
+    return digi_is_type(d, DIGI_TYPE_DOT);
+}
+
+/** Match an exponent sign: 'e', 'E'. */
+static yy_inline bool digi_is_exp(uint8_t d) {
+    return digi_is_type(d, DIGI_TYPE_EXP);
+}
+
+/** Match any character of a number token: [0-9], '+', '-', '.', 'e', 'E'. */
+static yy_inline bool digi_is_token(uint8_t d) {
+    return digi_table[d] != 0;
+}
+
+token_type token_classify_yy(const char *str, token_info *info) {
+    const uint8_t *hdr = (const uint8_t *)str, *cur = hdr;
+    uint32_t digits = 0;
+    int32_t dot = -1, exp = -1;
+    token_type type = token_type_int;
+    
+    cur += (*cur == '-');
+    if (yy_unlikely(!digi_is_digit(*cur))) goto invalid;
+    if (*cur == '0') {
+        cur++;
+        digits++;
+        if (yy_unlikely(digi_is_digit(*cur))) goto invalid;
+    } else {
+        while (digi_is_digit(*cur)) {
+            cur++;
+            digits++;
+        }
+    }
+    if (digi_is_dot(*cur)) {
+        dot = (int32_t)(cur - hdr);
+        type = token_type_dec;
+        cur++;
+        if (yy_unlikely(!digi_is_digit(*cur))) goto invalid;
+        while (digi_is_digit(*cur)) {
+            cur++;
+            digits++;
+        }
+    }
+    if (digi_is_exp(*cur)) {
+        exp = (int32_t)(cur - hdr);
+        type = token_type_exp;
+        cur++;
+        cur += digi_is_sign(*cur);
+        if (yy_unlikely(!digi_is_digit(*cur))) goto invalid;
+        while (digi_is_digit(*cur)) cur++;
+    }
+    if (yy_unlikely(digi_is_token(*cur))) goto invalid; /* "1.2.3", "1-2" */
+    
+    info->type = type;
+    info->len = (uint32_t)(cur - hdr);
+    info->digits = digits;
+    info->dot = dot;
+    info->exp = exp;
+    return type;
+    
+invalid:
+    while (digi_is_token(*cur)) cur++;
+    info->type = token_type_invalid;
+    info->len = (uint32_t)(cur - hdr);
+    info->digits = 0;
+    info->dot = -1;
+    info->exp = -1;
+    return token_type_invalid;
+}